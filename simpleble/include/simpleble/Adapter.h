@@ -15,6 +15,23 @@ namespace SimpleBLE {
 
 class AdapterBase;
 
+/**
+ * Peripheral delivered through Adapter::set_callback_on_scan_updated_batch(), along with the advertising
+ * fields that changed since it was last reported.
+ */
+struct ScanUpdate {
+    enum Field : uint8_t {
+        IDENTIFIER = 1 << 0,
+        RSSI = 1 << 1,
+        TX_POWER = 1 << 2,
+        MANUFACTURER_DATA = 1 << 3,
+        SERVICES = 1 << 4,
+    };
+
+    Peripheral peripheral;
+    uint8_t changed = 0;
+};
+
 /**
  * Bluetooth Adapter.
  *
@@ -63,11 +80,50 @@ class SIMPLEBLE_EXPORT Adapter {
     bool scan_is_active();
     std::vector<Peripheral> scan_get_results();
 
+    /**
+     * Restrict the peripherals reported by the next scan_start() or scan_for().
+     *
+     * NOTE: On Linux the filter is handed to BlueZ, which merges it with the filters of other
+     *       clients, so results are still checked before they are reported.
+     */
+    void set_scan_filter(const ScanFilter& filter);
+
     void set_callback_on_scan_start(std::function<void()> on_scan_start);
     void set_callback_on_scan_stop(std::function<void()> on_scan_stop);
     void set_callback_on_scan_updated(std::function<void(Peripheral)> on_scan_updated);
     void set_callback_on_scan_found(std::function<void(Peripheral)> on_scan_found);
 
+    /**
+     * Coalesce scan updates instead of reporting every advertisement through on_scan_updated.
+     *
+     * Updates for the same peripheral received within interval_ms are merged, and every interval the
+     * peripherals whose advertising data actually changed are delivered as a single batch. While a batch
+     * callback is set, on_scan_updated is not called. Passing an empty callback restores per-update
+     * delivery.
+     *
+     * NOTE: Must not be called from within the batch callback itself.
+     */
+    void set_callback_on_scan_updated_batch(std::function<void(std::vector<ScanUpdate>)> on_scan_updated_batch,
+                                            int interval_ms = 100);
+
+    /**
+     * Bound the peripherals the adapter keeps track of while scanning.
+     *
+     * Peripherals not heard from for ttl_ms are dropped, and once more than max_entries are known the least
+     * recently heard from are dropped as well. Connected and pinned peripherals are never dropped. A limit of
+     * zero disables it, which is the default for both. Dropped peripherals that had been reported through
+     * on_scan_found are reported through on_scan_lost, and are reported as found again if they reappear.
+     *
+     * NOTE: Limits are enforced whenever an advertisement is received, not on a timer.
+     */
+    void set_scan_cache_limits(size_t max_entries, int ttl_ms);
+
+    /**
+     * Keep the peripheral with the given address in the scan cache. The address is matched regardless of case.
+     */
+    void set_scan_cache_pinned(BluetoothAddress address, bool pinned);
+    void set_callback_on_scan_lost(std::function<void(Peripheral)> on_scan_lost);
+
     /**
      * Retrieve a list of all paired peripherals.
      *
@@ -95,6 +151,19 @@ class SIMPLEBLE_EXPORT Adapter {
      */
     static std::vector<Adapter> get_adapters();
 
+    /**
+     * Combine several adapters into one that scans on all of them at once.
+     *
+     * Peripherals heard by more than one adapter are reported once, by address, and keep the RSSI and last-seen
+     * time of each adapter that heard them (see Peripheral::sightings()). Connecting goes through the adapter that
+     * heard the peripheral with the fewest connections made through the aggregate, preferring the strongest RSSI
+     * among equally loaded ones. The adapters can come from any backend.
+     *
+     * NOTE: The aggregate installs its own listener on each adapter, so their user callbacks keep working, but
+     *       scanning on them directly while the aggregate scans is not supported.
+     */
+    static Adapter aggregate(std::vector<Adapter> adapters);
+
   protected:
     AdapterBase* operator->();
     const AdapterBase* operator->() const;
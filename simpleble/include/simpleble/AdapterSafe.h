@@ -33,16 +33,23 @@ class SIMPLEBLE_EXPORT Adapter {
     bool scan_for(int timeout_ms) noexcept;
     std::optional<bool> scan_is_active() noexcept;
     std::optional<std::vector<SimpleBLE::Safe::Peripheral>> scan_get_results() noexcept;
+    bool set_scan_filter(const ScanFilter& filter) noexcept;
 
     bool set_callback_on_scan_start(std::function<void()> on_scan_start) noexcept;
     bool set_callback_on_scan_stop(std::function<void()> on_scan_stop) noexcept;
     bool set_callback_on_scan_updated(std::function<void(SimpleBLE::Safe::Peripheral)> on_scan_updated) noexcept;
     bool set_callback_on_scan_found(std::function<void(SimpleBLE::Safe::Peripheral)> on_scan_found) noexcept;
+    bool set_callback_on_scan_updated_batch(std::function<void(std::vector<ScanUpdate>)> on_scan_updated_batch,
+                                            int interval_ms = 100) noexcept;
+    bool set_scan_cache_limits(size_t max_entries, int ttl_ms) noexcept;
+    bool set_scan_cache_pinned(BluetoothAddress address, bool pinned) noexcept;
+    bool set_callback_on_scan_lost(std::function<void(SimpleBLE::Safe::Peripheral)> on_scan_lost) noexcept;
 
     std::optional<std::vector<SimpleBLE::Safe::Peripheral>> get_paired_peripherals() noexcept;
 
     static std::optional<bool> bluetooth_enabled() noexcept;
     static std::optional<std::vector<SimpleBLE::Safe::Adapter>> get_adapters() noexcept;
+    static std::optional<SimpleBLE::Safe::Adapter> aggregate(std::vector<SimpleBLE::Adapter> adapters) noexcept;
 
     /**
      * Cast to the underlying adapter object.
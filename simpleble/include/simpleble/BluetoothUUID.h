@@ -0,0 +1,158 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace SimpleBLE {
+
+/**
+ * @brief 128-bit Bluetooth UUID held by value.
+ *
+ * Text in the 16-bit ("180f"), 32-bit ("0000180f") or 128-bit form is accepted in any case, with the short
+ * forms expanded onto the Bluetooth Base UUID, so that all of them compare equal. The UUID converts implicitly
+ * from and to strings, and is always formatted as the lowercase 128-bit form. Empty text gives the nil UUID,
+ * same as the default constructor.
+ *
+ * @throws std::invalid_argument when constructed from text that is not a UUID.
+ */
+class BluetoothUUID {
+  public:
+    constexpr BluetoothUUID() = default;
+    constexpr BluetoothUUID(uint64_t high, uint64_t low) : high_(high), low_(low) {}
+
+    constexpr BluetoothUUID(const char* text) : BluetoothUUID(parse(std::string_view(text))) {}
+    constexpr BluetoothUUID(std::string_view text) : BluetoothUUID(parse(text)) {}
+    BluetoothUUID(const std::string& text) : BluetoothUUID(parse(text)) {}
+
+    static constexpr BluetoothUUID from_uuid16(uint16_t uuid16) { return from_uuid32(uuid16); }
+    static constexpr BluetoothUUID from_uuid32(uint32_t uuid32) {
+        return BluetoothUUID((static_cast<uint64_t>(uuid32) << 32) | BASE_HIGH, BASE_LOW);
+    }
+
+    /**
+     * @brief Builds the UUID from its bytes, most significant first.
+     */
+    static constexpr BluetoothUUID from_bytes(const uint8_t bytes[16]) {
+        uint64_t high = 0;
+        uint64_t low = 0;
+        for (size_t i = 0; i < 8; i++) {
+            high = (high << 8) | bytes[i];
+            low = (low << 8) | bytes[i + 8];
+        }
+        return BluetoothUUID(high, low);
+    }
+
+    constexpr std::array<uint8_t, 16> bytes() const {
+        std::array<uint8_t, 16> bytes = {};
+        for (size_t i = 0; i < 8; i++) {
+            bytes[i] = static_cast<uint8_t>(high_ >> (56 - 8 * i));
+            bytes[i + 8] = static_cast<uint8_t>(low_ >> (56 - 8 * i));
+        }
+        return bytes;
+    }
+
+    constexpr uint64_t high() const { return high_; }
+    constexpr uint64_t low() const { return low_; }
+
+    constexpr bool is_nil() const { return high_ == 0 && low_ == 0; }
+
+    /**
+     * @brief Whether the UUID is derived from the Bluetooth Base UUID, in which case uuid32() identifies it.
+     */
+    constexpr bool is_short() const { return low_ == BASE_LOW && (high_ & 0xFFFFFFFF) == BASE_HIGH; }
+    constexpr uint32_t uuid32() const { return static_cast<uint32_t>(high_ >> 32); }
+
+    std::string str() const {
+        static constexpr char HEX[] = "0123456789abcdef";
+
+        std::string text;
+        text.reserve(36);
+        std::array<uint8_t, 16> data = bytes();
+        for (size_t i = 0; i < data.size(); i++) {
+            if (i == 4 || i == 6 || i == 8 || i == 10) text += '-';
+            text += HEX[data[i] >> 4];
+            text += HEX[data[i] & 0x0F];
+        }
+        return text;
+    }
+
+    operator std::string() const { return str(); }
+
+    friend constexpr bool operator==(const BluetoothUUID& a, const BluetoothUUID& b) {
+        return a.high_ == b.high_ && a.low_ == b.low_;
+    }
+    friend constexpr bool operator!=(const BluetoothUUID& a, const BluetoothUUID& b) { return !(a == b); }
+    friend constexpr bool operator<(const BluetoothUUID& a, const BluetoothUUID& b) {
+        return a.high_ < b.high_ || (a.high_ == b.high_ && a.low_ < b.low_);
+    }
+    friend constexpr bool operator>(const BluetoothUUID& a, const BluetoothUUID& b) { return b < a; }
+    friend constexpr bool operator<=(const BluetoothUUID& a, const BluetoothUUID& b) { return !(b < a); }
+    friend constexpr bool operator>=(const BluetoothUUID& a, const BluetoothUUID& b) { return !(a < b); }
+
+    friend std::ostream& operator<<(std::ostream& os, const BluetoothUUID& uuid) { return os << uuid.str(); }
+
+    // Picked up by fmt, so that UUIDs can be formatted like strings.
+    friend std::string format_as(const BluetoothUUID& uuid) { return uuid.str(); }
+
+  private:
+    // Bluetooth Base UUID 0000xxxx-0000-1000-8000-00805f9b34fb, without the bits of the short UUID.
+    static constexpr uint64_t BASE_HIGH = 0x0000000000001000;
+    static constexpr uint64_t BASE_LOW = 0x800000805F9B34FB;
+
+    uint64_t high_ = 0;
+    uint64_t low_ = 0;
+
+    static constexpr uint8_t parse_nibble(char c) {
+        if (c >= '0' && c <= '9') return static_cast<uint8_t>(c - '0');
+        if (c >= 'a' && c <= 'f') return static_cast<uint8_t>(c - 'a' + 10);
+        if (c >= 'A' && c <= 'F') return static_cast<uint8_t>(c - 'A' + 10);
+        throw std::invalid_argument("Invalid Bluetooth UUID");
+    }
+
+    static constexpr uint64_t parse_hex(std::string_view text) {
+        uint64_t value = 0;
+        for (char c : text) {
+            value = (value << 4) | parse_nibble(c);
+        }
+        return value;
+    }
+
+    static constexpr BluetoothUUID parse(std::string_view text) {
+        switch (text.size()) {
+            case 0:
+                return BluetoothUUID();
+            case 4:
+            case 8:
+                return from_uuid32(static_cast<uint32_t>(parse_hex(text)));
+            case 32:
+                return BluetoothUUID(parse_hex(text.substr(0, 16)), parse_hex(text.substr(16, 16)));
+            case 36:
+                if (text[8] != '-' || text[13] != '-' || text[18] != '-' || text[23] != '-') break;
+                return BluetoothUUID((parse_hex(text.substr(0, 8)) << 32) | (parse_hex(text.substr(9, 4)) << 16) |
+                                         parse_hex(text.substr(14, 4)),
+                                     (parse_hex(text.substr(19, 4)) << 48) | parse_hex(text.substr(24, 12)));
+        }
+        throw std::invalid_argument("Invalid Bluetooth UUID");
+    }
+};
+
+}  // namespace SimpleBLE
+
+namespace std {
+
+template <>
+struct hash<SimpleBLE::BluetoothUUID> {
+    size_t operator()(const SimpleBLE::BluetoothUUID& uuid) const noexcept {
+        // Short UUIDs only differ in the upper bits of the high half, which therefore have to be spread out.
+        uint64_t value = uuid.high() * 0x9E3779B97F4A7C15ULL ^ uuid.low();
+        return static_cast<size_t>(value ^ (value >> 32));
+    }
+};
+
+}  // namespace std
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <memory>
+
+#include <simpleble/export.h>
+
+#include <simpleble/Exceptions.h>
+#include <simpleble/Types.h>
+
+namespace SimpleBLE {
+
+class CharacteristicHandleBase;
+class Peripheral;
+
+/**
+ * Characteristic looked up once through Peripheral::resolve(), for code that accesses it over and over.
+ *
+ * Where the backend supports it, the handle is bound to the backend's own object, so operations through it
+ * skip the service and characteristic lookup entirely. It becomes invalid once the peripheral disconnects or
+ * its services change, after which it has to be resolved again.
+ */
+class SIMPLEBLE_EXPORT CharacteristicHandle {
+  public:
+    CharacteristicHandle() = default;
+    virtual ~CharacteristicHandle() = default;
+
+    bool initialized() const;
+    bool is_valid() const;
+
+    BluetoothUUID service() const;
+    BluetoothUUID characteristic() const;
+
+  protected:
+    friend class Peripheral;
+
+    CharacteristicHandleBase* operator->();
+    const CharacteristicHandleBase* operator->() const;
+
+    std::shared_ptr<CharacteristicHandleBase> internal_;
+};
+
+}  // namespace SimpleBLE
@@ -1,5 +1,6 @@
 #pragma once
 #include <chrono>
+#include <cstddef>
 
 //clang-format off
 namespace SimpleBLE {
@@ -16,12 +17,14 @@ namespace SimpleBluez {
     extern bool use_system_bus; // NOTE: This is only available in the new Bluez backend.
     extern std::chrono::steady_clock::duration connection_timeout;
     extern std::chrono::steady_clock::duration disconnection_timeout;
+    extern size_t dispatch_workers; // Threads running D-Bus handlers, 0 runs them on the event loop thread.
 
     static void reset() {
         use_legacy_bluez_backend = true;
         use_system_bus = true;
         connection_timeout = std::chrono::seconds(2);
         disconnection_timeout = std::chrono::seconds(1);
+        dispatch_workers = 0;
     }
 }  // namespace SimpleBluez
 
@@ -53,7 +56,12 @@ namespace Dongl {
 }  // namespace Dongl
 
 namespace Base {
+    extern size_t async_workers; // Threads running asynchronous operations and their callbacks.
+
+    static void reset() { async_workers = 4; }
+
     static void reset_all() {
+        reset();
         SimpleBluez::reset();
         WinRT::reset();
         CoreBluetooth::reset();
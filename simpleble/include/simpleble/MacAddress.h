@@ -0,0 +1,130 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace SimpleBLE {
+
+/**
+ * @brief 48-bit Bluetooth device address held by value.
+ *
+ * Text is accepted as six hexadecimal octets in any case, separated by colons, and is always formatted back as
+ * uppercase "AA:BB:CC:DD:EE:FF". Comparing, ordering and hashing addresses does not touch any string, which makes
+ * them cheap keys for tables that are looked up for every advertisement received.
+ *
+ * This only covers actual MAC addresses. BluetoothAddress stays a string, as some platforms identify peripherals
+ * by other means.
+ *
+ * @throws std::invalid_argument when constructed from text that is not an address.
+ */
+class MacAddress {
+  public:
+    constexpr MacAddress() = default;
+    constexpr explicit MacAddress(uint64_t value) : value_(value & 0xFFFFFFFFFFFF) {}
+
+    constexpr MacAddress(const char* text) : MacAddress(parse(std::string_view(text))) {}
+    constexpr MacAddress(std::string_view text) : MacAddress(parse(text)) {}
+    MacAddress(const std::string& text) : MacAddress(parse(text)) {}
+
+    /**
+     * @brief Builds the address from its octets, most significant first.
+     */
+    static constexpr MacAddress from_bytes(const uint8_t bytes[6]) {
+        uint64_t value = 0;
+        for (size_t i = 0; i < 6; i++) {
+            value = (value << 8) | bytes[i];
+        }
+        return MacAddress(value);
+    }
+
+    /**
+     * @brief Same as constructing from text, but returns nothing instead of throwing when it is not an address.
+     */
+    static constexpr std::optional<MacAddress> try_parse(std::string_view text) {
+        if (text.size() != 17) return std::nullopt;
+
+        uint64_t value = 0;
+        for (size_t i = 0; i < 6; i++) {
+            if (i > 0 && text[3 * i - 1] != ':') return std::nullopt;
+            int high = parse_nibble(text[3 * i]);
+            int low = parse_nibble(text[3 * i + 1]);
+            if (high < 0 || low < 0) return std::nullopt;
+            value = (value << 8) | static_cast<uint64_t>((high << 4) | low);
+        }
+        return MacAddress(value);
+    }
+
+    constexpr std::array<uint8_t, 6> bytes() const {
+        std::array<uint8_t, 6> bytes = {};
+        for (size_t i = 0; i < 6; i++) {
+            bytes[i] = static_cast<uint8_t>(value_ >> (40 - 8 * i));
+        }
+        return bytes;
+    }
+
+    constexpr uint64_t value() const { return value_; }
+
+    std::string str() const {
+        static constexpr char HEX[] = "0123456789ABCDEF";
+
+        std::string text(17, ':');
+        for (size_t i = 0; i < 6; i++) {
+            uint8_t octet = static_cast<uint8_t>(value_ >> (40 - 8 * i));
+            text[3 * i] = HEX[octet >> 4];
+            text[3 * i + 1] = HEX[octet & 0x0F];
+        }
+        return text;
+    }
+
+    operator std::string() const { return str(); }
+
+    friend constexpr bool operator==(const MacAddress& a, const MacAddress& b) { return a.value_ == b.value_; }
+    friend constexpr bool operator!=(const MacAddress& a, const MacAddress& b) { return a.value_ != b.value_; }
+    friend constexpr bool operator<(const MacAddress& a, const MacAddress& b) { return a.value_ < b.value_; }
+    friend constexpr bool operator>(const MacAddress& a, const MacAddress& b) { return a.value_ > b.value_; }
+    friend constexpr bool operator<=(const MacAddress& a, const MacAddress& b) { return a.value_ <= b.value_; }
+    friend constexpr bool operator>=(const MacAddress& a, const MacAddress& b) { return a.value_ >= b.value_; }
+
+    friend std::ostream& operator<<(std::ostream& os, const MacAddress& address) { return os << address.str(); }
+
+    // Picked up by fmt, so that addresses can be formatted like strings.
+    friend std::string format_as(const MacAddress& address) { return address.str(); }
+
+  private:
+    uint64_t value_ = 0;
+
+    static constexpr int parse_nibble(char c) {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        return -1;
+    }
+
+    static constexpr MacAddress parse(std::string_view text) {
+        std::optional<MacAddress> address = try_parse(text);
+        if (!address) throw std::invalid_argument("Invalid MAC address");
+        return *address;
+    }
+};
+
+}  // namespace SimpleBLE
+
+namespace std {
+
+template <>
+struct hash<SimpleBLE::MacAddress> {
+    size_t operator()(const SimpleBLE::MacAddress& address) const noexcept {
+        // Vendors share the upper octets, so the bits are mixed before being used as a bucket index.
+        uint64_t value = address.value() * 0x9E3779B97F4A7C15ULL;
+        return static_cast<size_t>(value ^ (value >> 32));
+    }
+};
+
+}  // namespace std
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <simpleble/export.h>
+
+#include <simpleble/Exceptions.h>
+#include <simpleble/Types.h>
+
+namespace SimpleBLE {
+
+class NotificationQueueBase;
+
+/**
+ * What a full NotificationQueue does with a new notification.
+ */
+enum class OverflowPolicy {
+    DROP_OLDEST,
+    DROP_NEWEST,
+};
+
+struct Notification {
+    ByteArray payload;
+    std::chrono::steady_clock::time_point timestamp;
+};
+
+/**
+ * Bounded buffer of the notifications of a single characteristic, see Peripheral::notify_queue().
+ *
+ * Notifications are stored by the backend's event thread without ever blocking it, and are picked up by
+ * polling drain(). Once the queue is full, notifications are dropped according to the overflow policy and
+ * counted by dropped().
+ */
+class SIMPLEBLE_EXPORT NotificationQueue {
+  public:
+    NotificationQueue() = default;
+    virtual ~NotificationQueue() = default;
+
+    bool initialized() const;
+
+    size_t capacity();
+
+    /**
+     * Number of queued notifications, which may already be outdated when returned.
+     */
+    size_t size();
+
+    /**
+     * Number of notifications lost to overflow since the queue was opened.
+     */
+    uint64_t dropped();
+
+    /**
+     * Move up to max queued notifications to the end of the given vector, oldest first, returning how
+     * many were moved.
+     */
+    size_t drain(std::vector<Notification>& notifications, size_t max = std::numeric_limits<size_t>::max());
+    size_t drain(std::vector<ByteArray>& payloads, size_t max = std::numeric_limits<size_t>::max());
+
+    /**
+     * Block until a notification is queued, the queue is closed or the timeout elapses. Returns true if
+     * there are notifications to drain.
+     */
+    bool wait_for(int timeout_ms);
+
+    bool is_open();
+
+    /**
+     * Unsubscribe from the characteristic. Notifications that were already queued can still be drained.
+     */
+    void close();
+
+  protected:
+    NotificationQueueBase* operator->();
+    const NotificationQueueBase* operator->() const;
+
+    std::shared_ptr<NotificationQueueBase> internal_;
+};
+
+}  // namespace SimpleBLE
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <cstdint>
+#include <exception>
 #include <functional>
+#include <future>
 #include <map>
 #include <memory>
 #include <string>
@@ -12,6 +14,9 @@
 #include <simpleble/Exceptions.h>
 #include <simpleble/Service.h>
 #include <simpleble/Types.h>
+#include <simpleble/CharacteristicHandle.h>
+#include <simpleble/NotificationQueue.h>
+#include <simpleble/WriteStream.h>
 
 namespace SimpleBLE {
 
@@ -55,6 +60,13 @@ class SIMPLEBLE_EXPORT Peripheral {
     std::vector<Service> services();
     std::map<uint16_t, ByteArray> manufacturer_data();
 
+    /**
+     * @brief Adapters that heard the peripheral, for peripherals reported by an aggregate adapter.
+     *
+     * @note Peripherals reported by a regular adapter return an empty list.
+     */
+    std::vector<PeripheralSighting> sightings();
+
     /* Calling any of the methods below when the device is not connected will throw
        Exception::NotConnected */
     // clang-format off
@@ -69,6 +81,64 @@ class SIMPLEBLE_EXPORT Peripheral {
     void write(BluetoothUUID const& service, BluetoothUUID const& characteristic, BluetoothUUID const& descriptor, ByteArray const& data);
     // clang-format on
 
+    /**
+     * @brief Looks up a characteristic once, for use with the handle overloads below.
+     *
+     * @note Operations through a handle that is no longer valid throw Exception::InvalidReference.
+     */
+    CharacteristicHandle resolve(BluetoothUUID const& service, BluetoothUUID const& characteristic);
+
+    // clang-format off
+    ByteArray read(CharacteristicHandle const& handle);
+    void write_request(CharacteristicHandle const& handle, ByteArray const& data);
+    void write_command(CharacteristicHandle const& handle, ByteArray const& data);
+    void notify(CharacteristicHandle const& handle, std::function<void(ByteArray payload)> callback);
+    void indicate(CharacteristicHandle const& handle, std::function<void(ByteArray payload)> callback);
+    void unsubscribe(CharacteristicHandle const& handle);
+    // clang-format on
+
+    /**
+     * @brief Non-blocking variants of the operations above, which can be issued on many peripherals at once.
+     *
+     * Operations on the same peripheral are started in the order they were issued, but backends that keep several
+     * of them in flight (such as Linux) complete them in the order the device answers. When one operation has to
+     * finish before the next, issue the next one from its callback. Callbacks run on SimpleBLE's worker threads
+     * (see Config::Base::async_workers) and receive any failure as the error, which is null on success. The
+     * future variants report failures by throwing from get().
+     *
+     * @note Exception::NotConnected is still thrown right away when the device is not connected.
+     */
+    // clang-format off
+    std::future<ByteArray> read_async(BluetoothUUID const& service, BluetoothUUID const& characteristic);
+    void read_async(BluetoothUUID const& service, BluetoothUUID const& characteristic, std::function<void(ByteArray value, std::exception_ptr error)> callback);
+    std::future<void> write_request_async(BluetoothUUID const& service, BluetoothUUID const& characteristic, ByteArray const& data);
+    void write_request_async(BluetoothUUID const& service, BluetoothUUID const& characteristic, ByteArray const& data, std::function<void(std::exception_ptr error)> callback);
+    std::future<void> write_command_async(BluetoothUUID const& service, BluetoothUUID const& characteristic, ByteArray const& data);
+    void write_command_async(BluetoothUUID const& service, BluetoothUUID const& characteristic, ByteArray const& data, std::function<void(std::exception_ptr error)> callback);
+
+    std::future<ByteArray> read_async(BluetoothUUID const& service, BluetoothUUID const& characteristic, BluetoothUUID const& descriptor);
+    void read_async(BluetoothUUID const& service, BluetoothUUID const& characteristic, BluetoothUUID const& descriptor, std::function<void(ByteArray value, std::exception_ptr error)> callback);
+    std::future<void> write_async(BluetoothUUID const& service, BluetoothUUID const& characteristic, BluetoothUUID const& descriptor, ByteArray const& data);
+    void write_async(BluetoothUUID const& service, BluetoothUUID const& characteristic, BluetoothUUID const& descriptor, ByteArray const& data, std::function<void(std::exception_ptr error)> callback);
+    // clang-format on
+
+    /**
+     * @brief Opens a channel for bulk write commands to the given characteristic.
+     *
+     * @note On Linux this uses a BlueZ AcquireWrite socket, which avoids a D-Bus round trip per packet.
+     *       Other backends send every packet through write_command().
+     */
+    WriteStream open_write_stream(BluetoothUUID const& service, BluetoothUUID const& characteristic);
+
+    /**
+     * @brief Subscribes to notifications of the given characteristic, buffering them to be polled instead of
+     *        invoking a callback.
+     *
+     * @note The queue replaces any callback set through notify() or indicate() on the same characteristic.
+     */
+    NotificationQueue notify_queue(BluetoothUUID const& service, BluetoothUUID const& characteristic, size_t capacity,
+                                   OverflowPolicy policy = OverflowPolicy::DROP_OLDEST);
+
     void set_callback_on_connected(std::function<void()> on_connected);
     void set_callback_on_disconnected(std::function<void()> on_disconnected);
 
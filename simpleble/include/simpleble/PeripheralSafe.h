@@ -34,6 +34,7 @@ class SIMPLEBLE_EXPORT Peripheral {
 
     std::optional<std::vector<Service>> services() noexcept;
     std::optional<std::map<uint16_t, ByteArray>> manufacturer_data() noexcept;
+    std::optional<std::vector<PeripheralSighting>> sightings() noexcept;
 
     // clang-format off
     std::optional<ByteArray> read(BluetoothUUID const& service, BluetoothUUID const& characteristic) noexcept;
@@ -45,8 +46,29 @@ class SIMPLEBLE_EXPORT Peripheral {
 
     std::optional<ByteArray> read(BluetoothUUID const& service, BluetoothUUID const& characteristic, BluetoothUUID const& descriptor) noexcept;
     bool write(BluetoothUUID const& service, BluetoothUUID const& characteristic, BluetoothUUID const& descriptor, ByteArray const& data) noexcept;
+
+    std::optional<CharacteristicHandle> resolve(BluetoothUUID const& service, BluetoothUUID const& characteristic) noexcept;
+    std::optional<ByteArray> read(CharacteristicHandle const& handle) noexcept;
+    bool write_request(CharacteristicHandle const& handle, ByteArray const& data) noexcept;
+    bool write_command(CharacteristicHandle const& handle, ByteArray const& data) noexcept;
+    bool notify(CharacteristicHandle const& handle, std::function<void(ByteArray payload)> callback) noexcept;
+    bool indicate(CharacteristicHandle const& handle, std::function<void(ByteArray payload)> callback) noexcept;
+    bool unsubscribe(CharacteristicHandle const& handle) noexcept;
+
+    /**
+     * Callbacks receive std::nullopt or false if the operation failed. The return value only tells whether it was issued.
+     */
+    bool read_async(BluetoothUUID const& service, BluetoothUUID const& characteristic, std::function<void(std::optional<ByteArray> value)> callback) noexcept;
+    bool write_request_async(BluetoothUUID const& service, BluetoothUUID const& characteristic, ByteArray const& data, std::function<void(bool success)> callback) noexcept;
+    bool write_command_async(BluetoothUUID const& service, BluetoothUUID const& characteristic, ByteArray const& data, std::function<void(bool success)> callback) noexcept;
+    bool read_async(BluetoothUUID const& service, BluetoothUUID const& characteristic, BluetoothUUID const& descriptor, std::function<void(std::optional<ByteArray> value)> callback) noexcept;
+    bool write_async(BluetoothUUID const& service, BluetoothUUID const& characteristic, BluetoothUUID const& descriptor, ByteArray const& data, std::function<void(bool success)> callback) noexcept;
     // clang-format on
 
+    std::optional<WriteStream> open_write_stream(BluetoothUUID const& service, BluetoothUUID const& characteristic) noexcept;
+    std::optional<NotificationQueue> notify_queue(BluetoothUUID const& service, BluetoothUUID const& characteristic, size_t capacity,
+                                                  OverflowPolicy policy = OverflowPolicy::DROP_OLDEST) noexcept;
+
     bool set_callback_on_connected(std::function<void()> on_connected) noexcept;
     bool set_callback_on_disconnected(std::function<void()> on_disconnected) noexcept;
 
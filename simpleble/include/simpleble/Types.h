@@ -1,10 +1,14 @@
 #pragma once
 
+#include <chrono>
 #include <cstdint>
+#include <optional>
 #include <string>
 #include <vector>
 #include "kvn/kvn_bytearray.h"
 
+#include <simpleble/BluetoothUUID.h>
+
 /**
  * @file Types.h
  * @brief Defines types and enumerations used throughout the SimpleBLE library.
@@ -14,10 +18,6 @@ namespace SimpleBLE {
 
 using BluetoothAddress = std::string;
 
-// IDEA: Extend BluetoothUUID to include a `uuid` function that
-// returns the same string, but provides a homogeneous interface.
-using BluetoothUUID = std::string;
-
 /**
  * @typedef ByteArray
  * @brief Represents a byte array using kvn::bytearray from the external library.
@@ -46,4 +46,42 @@ enum class OperatingSystem {
 // TODO: Add to_string functions for all enums.
 enum BluetoothAddressType : int32_t { PUBLIC = 0, RANDOM = 1, UNSPECIFIED = 2 };
 
+/**
+ * @brief Criteria narrowing down the peripherals reported by a scan.
+ *
+ * Fields left at their default value do not filter anything. Backends push whatever their platform supports down
+ * to the OS and check the rest themselves before reporting a peripheral.
+ */
+struct ScanFilter {
+    enum class Transport { AUTO, LE, BREDR };
+
+    /** Only report peripherals advertising at least one of these services. */
+    std::vector<BluetoothUUID> service_uuids;
+
+    /** Minimum RSSI in dBm. */
+    std::optional<int16_t> rssi_threshold;
+
+    /** Maximum pathloss in dB, computed as advertised TX power minus RSSI. */
+    std::optional<uint16_t> pathloss_threshold;
+
+    /** Only honored by backends that also scan BR/EDR. */
+    Transport transport = Transport::AUTO;
+
+    /** Report every advertisement, even if its data did not change since the last one. */
+    bool duplicate_data = true;
+
+    /** Prefix of either the address or the name of the peripheral. */
+    std::string pattern;
+};
+
+/**
+ * @brief Last advertisement of a peripheral received by one of the adapters of an aggregate adapter.
+ */
+struct PeripheralSighting {
+    std::string adapter_identifier;
+    BluetoothAddress adapter_address;
+    int16_t rssi;
+    std::chrono::steady_clock::time_point last_seen;
+};
+
 }  // namespace SimpleBLE
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <simpleble/export.h>
+
+#include <simpleble/Exceptions.h>
+#include <simpleble/Types.h>
+
+namespace SimpleBLE {
+
+class WriteStreamBase;
+
+/**
+ * Channel for unacknowledged writes to a single characteristic, see Peripheral::open_write_stream().
+ *
+ * Data is split into packets of at most mtu() bytes, each sent as a write command. Backends with a
+ * dedicated channel queue the packets without waiting on the OS, and report a full queue through
+ * write() accepting fewer bytes than provided.
+ */
+class SIMPLEBLE_EXPORT WriteStream {
+  public:
+    WriteStream() = default;
+    virtual ~WriteStream() = default;
+
+    bool initialized() const;
+
+    /**
+     * Maximum payload of a single packet.
+     */
+    uint16_t mtu();
+
+    /**
+     * Send as many whole packets as the link accepts right now, returning the number of bytes sent. Any
+     * remainder should be retried once wait_writable() returns true.
+     */
+    size_t write(ByteArray const& data);
+
+    /**
+     * Block until write() can make progress again or the timeout elapses.
+     */
+    bool wait_writable(int timeout_ms);
+
+    bool is_open();
+    void close();
+
+  protected:
+    WriteStreamBase* operator->();
+    const WriteStreamBase* operator->() const;
+
+    std::shared_ptr<WriteStreamBase> internal_;
+};
+
+}  // namespace SimpleBLE
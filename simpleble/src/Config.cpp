@@ -7,6 +7,7 @@ namespace Config {
         bool use_system_bus = true;
         std::chrono::steady_clock::duration connection_timeout = std::chrono::seconds(2);
         std::chrono::steady_clock::duration disconnection_timeout = std::chrono::seconds(1);
+        size_t dispatch_workers = 0;
     }  // namespace SimpleBluez
 
     namespace WinRT {
@@ -22,5 +23,9 @@ namespace Config {
         bool use_dongl_backend = false;
     }  // namespace Dongl
 
+    namespace Base {
+        size_t async_workers = 4;
+    }  // namespace Base
+
 }  // namespace Config
 }  // namespace SimpleBLE
\ No newline at end of file
@@ -18,28 +18,31 @@ bool AdapterAndroid::bluetooth_enabled() { return BackendAndroid::get()->bluetoo
 
 AdapterAndroid::AdapterAndroid() {
     _btScanCallback.set_callback_onScanResult([this](Android::ScanResult scan_result) {
-        std::string address = scan_result.getDevice().getAddress();
+        MacAddress address = scan_result.getDevice().getAddress();
 
-        if (this->peripherals_.count(address) == 0) {
+        auto it = this->peripherals_.find(address);
+        if (it == this->peripherals_.end()) {
             // If the incoming peripheral has never been seen before, create and save a reference to it.
             auto base_peripheral = std::make_shared<PeripheralAndroid>(scan_result.getDevice());
-            this->peripherals_.insert(std::make_pair(address, base_peripheral));
+            it = this->peripherals_.insert(std::make_pair(address, base_peripheral)).first;
         }
 
         // Update the received advertising data.
-        auto base_peripheral = this->peripherals_.at(address);
+        auto base_peripheral = it->second;
         base_peripheral->update_advertising_data(scan_result);
+        scan_cache_touch(base_peripheral);
+
+        if (!scan_filter_accepts(*base_peripheral)) return;
+        bool duplicate = scan_filter_is_duplicate(*base_peripheral);
 
-        // Convert the base object into an external-facing Peripheral object
-        Peripheral peripheral = Factory::build(base_peripheral);
 
         // Check if the device has been seen before, to forward the correct call to the user.
         if (this->seen_peripherals_.count(address) == 0) {
             // Store it in our table of seen peripherals
             this->seen_peripherals_.insert(std::make_pair(address, base_peripheral));
-            SAFE_CALLBACK_CALL(this->_callback_on_scan_found, peripheral);
-        } else {
-            SAFE_CALLBACK_CALL(this->_callback_on_scan_updated, peripheral);
+            scan_found(base_peripheral);
+        } else if (!duplicate) {
+            scan_updated(base_peripheral);
         }
     });
 }
@@ -89,6 +92,12 @@ bool AdapterAndroid::scan_is_active() { return scanning_; }
 
 SharedPtrVector<PeripheralBase> AdapterAndroid::scan_get_results() { return Util::values(seen_peripherals_); }
 
+void AdapterAndroid::scan_cache_evict(const BluetoothAddress& address, const std::shared_ptr<PeripheralBase>& peripheral) {
+    MacAddress key = address;
+    seen_peripherals_.erase(key);
+    peripherals_.erase(key);
+}
+
 SharedPtrVector<PeripheralBase> AdapterAndroid::get_paired_peripherals() {
     SharedPtrVector<PeripheralBase> peripherals;
 
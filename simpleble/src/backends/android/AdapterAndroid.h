@@ -1,6 +1,7 @@
 #pragma once
 
 #include <simpleble/Exceptions.h>
+#include <simpleble/MacAddress.h>
 #include <simpleble/Types.h>
 
 #include "../common/AdapterBase.h"
@@ -54,12 +55,14 @@ class AdapterAndroid : public AdapterBase {
     void onScanFailedCallback(JNIEnv* env, jobject thiz, jint error_code);
 
   private:
+    void scan_cache_evict(const BluetoothAddress& address, const std::shared_ptr<PeripheralBase>& peripheral) override;
+
     Android::BluetoothAdapter _btAdapter = Android::BluetoothAdapter::getDefaultAdapter();
     Android::BluetoothScanner _btScanner = _btAdapter.getBluetoothLeScanner();
     Android::Bridge::ScanCallback _btScanCallback;
 
-    std::map<BluetoothAddress, std::shared_ptr<PeripheralAndroid>> peripherals_;
-    std::map<BluetoothAddress, std::shared_ptr<PeripheralAndroid>> seen_peripherals_;
+    std::map<MacAddress, std::shared_ptr<PeripheralAndroid>> peripherals_;
+    std::map<MacAddress, std::shared_ptr<PeripheralAndroid>> seen_peripherals_;
 
     std::atomic<bool> scanning_{false};
 };
@@ -0,0 +1,208 @@
+#include "AdapterAggregate.h"
+
+#include "CommonUtils.h"
+#include "PeripheralAggregate.h"
+#include "PeripheralBase.h"
+
+#include <simpleble/Exceptions.h>
+
+#include <algorithm>
+#include <chrono>
+#include <set>
+#include <thread>
+
+using namespace SimpleBLE;
+
+AdapterAggregate::AdapterAggregate(std::vector<std::shared_ptr<AdapterBase>> adapters)
+    : _adapters(std::move(adapters)), _connections(std::make_shared<AggregateConnections>()) {
+    if (_adapters.empty()) throw Exception::OperationFailed("No adapters to aggregate");
+
+    _connections->per_adapter.resize(_adapters.size(), 0);
+    for (size_t i = 0; i < _adapters.size(); i++) {
+        _adapters[i]->set_scan_listener(
+            [this, i](std::shared_ptr<PeripheralBase> peripheral) { on_seen(i, std::move(peripheral)); },
+            [this, i](BluetoothAddress address) { on_lost(i, address); });
+    }
+}
+
+AdapterAggregate::~AdapterAggregate() {
+    // Listeners are unloaded under their own lock, so none of them is running once this returns.
+    for (auto& adapter : _adapters) {
+        adapter->set_scan_listener(nullptr, nullptr);
+    }
+}
+
+void* AdapterAggregate::underlying() const { return nullptr; }
+
+std::string AdapterAggregate::identifier() {
+    std::string identifier;
+    for (auto& adapter : _adapters) {
+        if (!identifier.empty()) identifier += "+";
+        identifier += adapter->identifier();
+    }
+    return identifier;
+}
+
+BluetoothAddress AdapterAggregate::address() { return _adapters.front()->address(); }
+
+void AdapterAggregate::power_on() {
+    for (auto& adapter : _adapters) {
+        adapter->power_on();
+    }
+}
+
+void AdapterAggregate::power_off() {
+    for (auto& adapter : _adapters) {
+        adapter->power_off();
+    }
+}
+
+bool AdapterAggregate::is_powered() {
+    return std::all_of(_adapters.begin(), _adapters.end(), [](auto& adapter) { return adapter->is_powered(); });
+}
+
+void AdapterAggregate::scan_start() {
+    for (auto& adapter : _adapters) {
+        adapter->scan_start();
+    }
+    SAFE_CALLBACK_CALL(this->_callback_on_scan_start);
+}
+
+void AdapterAggregate::scan_stop() {
+    for (auto& adapter : _adapters) {
+        adapter->scan_stop();
+    }
+    SAFE_CALLBACK_CALL(this->_callback_on_scan_stop);
+}
+
+void AdapterAggregate::scan_for(int timeout_ms) {
+    // The adapters' own scan_for() blocks, which would scan on them one after the other.
+    scan_start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(timeout_ms));
+    scan_stop();
+}
+
+bool AdapterAggregate::scan_is_active() {
+    return std::any_of(_adapters.begin(), _adapters.end(), [](auto& adapter) { return adapter->scan_is_active(); });
+}
+
+std::vector<std::shared_ptr<PeripheralBase>> AdapterAggregate::scan_get_results() {
+    std::scoped_lock lock(_peripherals_mutex);
+
+    std::vector<std::shared_ptr<PeripheralBase>> peripherals;
+    for (auto& [address, peripheral] : _peripherals) {
+        peripherals.push_back(peripheral);
+    }
+    return peripherals;
+}
+
+void AdapterAggregate::set_scan_filter(const ScanFilter& filter) {
+    AdapterBase::set_scan_filter(filter);
+    for (auto& adapter : _adapters) {
+        adapter->set_scan_filter(filter);
+    }
+}
+
+void AdapterAggregate::set_scan_cache_limits(size_t max_entries, int ttl_ms) {
+    AdapterBase::set_scan_cache_limits(max_entries, ttl_ms);
+    for (auto& adapter : _adapters) {
+        adapter->set_scan_cache_limits(max_entries, ttl_ms);
+    }
+}
+
+void AdapterAggregate::set_scan_cache_pinned(const BluetoothAddress& address, bool pinned) {
+    AdapterBase::set_scan_cache_pinned(address, pinned);
+    for (auto& adapter : _adapters) {
+        adapter->set_scan_cache_pinned(address, pinned);
+    }
+}
+
+std::vector<std::shared_ptr<PeripheralBase>> AdapterAggregate::get_paired_peripherals() {
+    // Peripherals heard from during the scan are returned as they are, the others are merged here without being
+    // added to the results.
+    std::map<BluetoothAddress, std::shared_ptr<PeripheralAggregate>> paired;
+    std::set<BluetoothAddress> scanned;
+    for (size_t i = 0; i < _adapters.size(); i++) {
+        for (auto& peripheral : _adapters[i]->get_paired_peripherals()) {
+            BluetoothAddress address = peripheral->address();
+            auto it = paired.find(address);
+            if (it == paired.end()) {
+                std::scoped_lock lock(_peripherals_mutex);
+                auto known = _peripherals.find(address);
+                if (known != _peripherals.end()) {
+                    scanned.insert(address);
+                    it = paired.emplace(address, known->second).first;
+                } else {
+                    it = paired.emplace(address, std::make_shared<PeripheralAggregate>(address, _connections)).first;
+                }
+            }
+            if (scanned.count(address) == 0) it->second->sighting_update(i, _adapters[i], peripheral);
+        }
+    }
+
+    std::vector<std::shared_ptr<PeripheralBase>> peripherals;
+    for (auto& [address, peripheral] : paired) {
+        peripherals.push_back(peripheral);
+    }
+    return peripherals;
+}
+
+std::vector<std::shared_ptr<PeripheralBase>> AdapterAggregate::get_connected_peripherals() {
+    std::vector<std::shared_ptr<PeripheralBase>> peripherals = scan_get_results();
+    peripherals.erase(std::remove_if(peripherals.begin(), peripherals.end(),
+                                     [](auto& peripheral) { return !peripheral->is_connected(); }),
+                      peripherals.end());
+    return peripherals;
+}
+
+bool AdapterAggregate::bluetooth_enabled() {
+    return std::any_of(_adapters.begin(), _adapters.end(), [](auto& adapter) { return adapter->bluetooth_enabled(); });
+}
+
+void AdapterAggregate::on_seen(size_t index, std::shared_ptr<PeripheralBase> peripheral) {
+    BluetoothAddress address = peripheral->address();
+
+    std::shared_ptr<PeripheralAggregate> aggregate;
+    bool inserted;
+    {
+        std::scoped_lock lock(_peripherals_mutex);
+        auto it = _peripherals.find(address);
+        inserted = it == _peripherals.end();
+        if (inserted) {
+            it = _peripherals.emplace(address, std::make_shared<PeripheralAggregate>(address, _connections)).first;
+        }
+        aggregate = it->second;
+    }
+    aggregate->sighting_update(index, _adapters[index], std::move(peripheral));
+
+    // The underlying adapters already applied the filter, except for duplicate data, which is per adapter.
+    scan_cache_touch(aggregate);
+    if (inserted) {
+        scan_filter_is_duplicate(*aggregate);
+        scan_found(aggregate);
+    } else if (!scan_filter_is_duplicate(*aggregate)) {
+        scan_updated(aggregate);
+    }
+}
+
+void AdapterAggregate::on_lost(size_t index, const BluetoothAddress& address) {
+    std::shared_ptr<PeripheralAggregate> aggregate;
+    {
+        std::scoped_lock lock(_peripherals_mutex);
+        auto it = _peripherals.find(address);
+        if (it == _peripherals.end()) return;
+        aggregate = it->second;
+    }
+
+    // The peripheral itself is only dropped by this adapter's own scan cache.
+    aggregate->sighting_remove(index);
+}
+
+void AdapterAggregate::scan_cache_evict(const BluetoothAddress& address,
+                                        const std::shared_ptr<PeripheralBase>& peripheral) {
+    std::scoped_lock lock(_peripherals_mutex);
+    auto it = _peripherals.find(address);
+    if (it != _peripherals.end() && it->second == peripheral) {
+        _peripherals.erase(it);
+    }
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <simpleble/Types.h>
+#include "AdapterBase.h"
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace SimpleBLE {
+
+class PeripheralAggregate;
+struct AggregateConnections;
+
+/**
+ * Adapter spanning several adapters of any backend, built on the AdapterBase interface alone.
+ *
+ * Results of every adapter are merged by address into PeripheralAggregate objects, which go through this
+ * adapter's own filter state, scan cache and batching like the results of any backend. The filter and the scan
+ * cache settings are forwarded to the underlying adapters as well, so that they filter and expire their own
+ * results consistently.
+ */
+class AdapterAggregate : public AdapterBase {
+  public:
+    AdapterAggregate(std::vector<std::shared_ptr<AdapterBase>> adapters);
+    virtual ~AdapterAggregate();
+
+    void* underlying() const override;
+
+    /**
+     * Identifiers of the underlying adapters joined by '+'. The address is the one of the first adapter.
+     */
+    std::string identifier() override;
+    BluetoothAddress address() override;
+
+    void power_on() override;
+    void power_off() override;
+    bool is_powered() override;
+
+    void scan_start() override;
+    void scan_stop() override;
+    void scan_for(int timeout_ms) override;
+    bool scan_is_active() override;
+    std::vector<std::shared_ptr<PeripheralBase>> scan_get_results() override;
+
+    void set_scan_filter(const ScanFilter& filter) override;
+    void set_scan_cache_limits(size_t max_entries, int ttl_ms) override;
+    void set_scan_cache_pinned(const BluetoothAddress& address, bool pinned) override;
+
+    std::vector<std::shared_ptr<PeripheralBase>> get_paired_peripherals() override;
+    std::vector<std::shared_ptr<PeripheralBase>> get_connected_peripherals() override;
+
+    bool bluetooth_enabled() override;
+
+  protected:
+    void scan_cache_evict(const BluetoothAddress& address, const std::shared_ptr<PeripheralBase>& peripheral) override;
+
+  private:
+    void on_seen(size_t index, std::shared_ptr<PeripheralBase> peripheral);
+    void on_lost(size_t index, const BluetoothAddress& address);
+
+    const std::vector<std::shared_ptr<AdapterBase>> _adapters;
+    std::shared_ptr<AggregateConnections> _connections;
+
+    std::mutex _peripherals_mutex;
+    std::map<BluetoothAddress, std::shared_ptr<PeripheralAggregate>> _peripherals;
+};
+
+}  // namespace SimpleBLE
@@ -1,7 +1,81 @@
 #include "AdapterBase.h"
+#include "BuilderBase.h"
+#include "CommonUtils.h"
+#include "PeripheralBase.h"
+#include "ServiceBase.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
 
 namespace SimpleBLE {
 
+static bool same_bytes(const ByteArray& a, const ByteArray& b) {
+    return a.size() == b.size() && std::equal(a.data(), a.data() + a.size(), b.data());
+}
+
+// Works for any ordered container of (key, ByteArray) pairs.
+template <typename T>
+static bool same_keyed_bytes(const T& a, const T& b) {
+    return std::equal(a.begin(), a.end(), b.begin(), b.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.first == rhs.first && same_bytes(lhs.second, rhs.second);
+    });
+}
+
+AdapterBase::~AdapterBase() { scan_batch_stop(); }
+
+void AdapterBase::set_scan_filter(const ScanFilter& filter) {
+    std::scoped_lock lock(_scan_filter_mutex);
+    _scan_filter = filter;
+    _scan_filter_reported_data.clear();
+}
+
+bool AdapterBase::scan_filter_accepts(PeripheralBase& peripheral) {
+    std::scoped_lock lock(_scan_filter_mutex);
+
+    if (!_scan_filter.pattern.empty()) {
+        const std::string& pattern = _scan_filter.pattern;
+        if (peripheral.address().rfind(pattern, 0) != 0 && peripheral.identifier().rfind(pattern, 0) != 0) {
+            return false;
+        }
+    }
+
+    int16_t rssi = peripheral.rssi();
+    if (_scan_filter.rssi_threshold && rssi < *_scan_filter.rssi_threshold) {
+        return false;
+    }
+
+    if (_scan_filter.pathloss_threshold) {
+        // Without an advertised TX power the pathloss is unknown, which BlueZ treats as a mismatch as well.
+        if (!peripheral.has_tx_power() || peripheral.tx_power() - rssi > *_scan_filter.pathloss_threshold) {
+            return false;
+        }
+    }
+
+    if (!_scan_filter.service_uuids.empty()) {
+        auto services = peripheral.advertised_services();
+        bool found = std::any_of(services.begin(), services.end(), [this](const std::shared_ptr<ServiceBase>& service) {
+            auto& uuids = _scan_filter.service_uuids;
+            return std::find(uuids.begin(), uuids.end(), service->uuid()) != uuids.end();
+        });
+        if (!found) return false;
+    }
+
+    return true;
+}
+
+bool AdapterBase::scan_filter_is_duplicate(PeripheralBase& peripheral) {
+    std::scoped_lock lock(_scan_filter_mutex);
+    if (_scan_filter.duplicate_data) return false;
+
+    auto manufacturer_data = peripheral.manufacturer_data();
+    auto [it, inserted] = _scan_filter_reported_data.try_emplace(peripheral.scan_key(), manufacturer_data);
+    if (!inserted && same_keyed_bytes(it->second, manufacturer_data)) return true;
+
+    it->second = std::move(manufacturer_data);
+    return false;
+}
+
 void AdapterBase::set_callback_on_power_on(std::function<void()> on_power_on) {
     if (on_power_on) {
         _callback_on_power_on.load(on_power_on);
@@ -50,4 +124,219 @@ void AdapterBase::set_callback_on_scan_found(std::function<void(Peripheral)> on_
     }
 }
 
+void AdapterBase::set_callback_on_scan_updated_batch(
+    std::function<void(std::vector<ScanUpdate>)> on_scan_updated_batch, int interval_ms) {
+    scan_batch_stop();
+    if (!on_scan_updated_batch) {
+        _callback_on_scan_updated_batch.unload();
+        return;
+    }
+
+    _callback_on_scan_updated_batch.load(on_scan_updated_batch);
+
+    std::scoped_lock lock(_scan_batch_mutex);
+    _scan_batch_interval = std::chrono::milliseconds(std::max(interval_ms, 1));
+    _scan_batch_enabled = true;
+    _scan_batch_thread = std::thread(&AdapterBase::scan_batch_run, this);
+}
+
+void AdapterBase::set_scan_listener(std::function<void(std::shared_ptr<PeripheralBase>)> on_seen,
+                                    std::function<void(BluetoothAddress)> on_lost) {
+    if (on_seen) {
+        _listener_on_scan_seen.load(on_seen);
+    } else {
+        _listener_on_scan_seen.unload();
+    }
+
+    if (on_lost) {
+        _listener_on_scan_lost.load(on_lost);
+    } else {
+        _listener_on_scan_lost.unload();
+    }
+}
+
+void AdapterBase::scan_found(const std::shared_ptr<PeripheralBase>& peripheral) {
+    SAFE_CALLBACK_CALL(this->_listener_on_scan_seen, peripheral);
+    {
+        std::scoped_lock lock(_scan_cache_mutex);
+        auto it = _scan_cache.find(peripheral->scan_key());
+        if (it != _scan_cache.end()) it->second.reported = true;
+    }
+    {
+        std::scoped_lock lock(_scan_batch_mutex);
+        if (_scan_batch_enabled) {
+            // Later updates are reported relative to what the user saw here.
+            _scan_batch_reported.insert_or_assign(peripheral->scan_key(), scan_snapshot(*peripheral));
+        }
+    }
+    SAFE_CALLBACK_CALL(this->_callback_on_scan_found, Factory::build(peripheral));
+}
+
+void AdapterBase::scan_updated(const std::shared_ptr<PeripheralBase>& peripheral) {
+    SAFE_CALLBACK_CALL(this->_listener_on_scan_seen, peripheral);
+    {
+        std::scoped_lock lock(_scan_batch_mutex);
+        if (_scan_batch_enabled) {
+            _scan_batch_pending.try_emplace(peripheral->scan_key(), peripheral);
+            return;
+        }
+    }
+    SAFE_CALLBACK_CALL(this->_callback_on_scan_updated, Factory::build(peripheral));
+}
+
+AdapterBase::ScanSnapshot AdapterBase::scan_snapshot(PeripheralBase& peripheral) {
+    ScanSnapshot snapshot{peripheral.identifier(), peripheral.rssi(), peripheral.tx_power(),
+                          peripheral.manufacturer_data(), {}};
+    for (auto& service : peripheral.advertised_services()) {
+        snapshot.services.emplace_back(service->uuid(), service->data());
+    }
+    return snapshot;
+}
+
+uint8_t AdapterBase::scan_snapshot_diff(const ScanSnapshot& previous, const ScanSnapshot& current) {
+    uint8_t changed = 0;
+    if (previous.identifier != current.identifier) changed |= ScanUpdate::IDENTIFIER;
+    if (previous.rssi != current.rssi) changed |= ScanUpdate::RSSI;
+    if (previous.tx_power != current.tx_power) changed |= ScanUpdate::TX_POWER;
+    if (!same_keyed_bytes(previous.manufacturer_data, current.manufacturer_data)) {
+        changed |= ScanUpdate::MANUFACTURER_DATA;
+    }
+    if (!same_keyed_bytes(previous.services, current.services)) changed |= ScanUpdate::SERVICES;
+    return changed;
+}
+
+void AdapterBase::scan_batch_run() {
+    std::unique_lock lock(_scan_batch_mutex);
+    bool enabled = true;
+    while (enabled) {
+        _scan_batch_cv.wait_for(lock, _scan_batch_interval, [this]() { return !_scan_batch_enabled; });
+        enabled = _scan_batch_enabled;
+        auto pending = std::exchange(_scan_batch_pending, {});
+        lock.unlock();
+
+        // Peripherals are read without holding the lock, as backends keep updating them meanwhile.
+        std::vector<std::pair<std::shared_ptr<PeripheralBase>, ScanSnapshot>> snapshots;
+        snapshots.reserve(pending.size());
+        for (auto& [key, peripheral] : pending) {
+            snapshots.emplace_back(peripheral, scan_snapshot(*peripheral));
+        }
+
+        std::vector<ScanUpdate> updates;
+        lock.lock();
+        for (auto& [peripheral, snapshot] : snapshots) {
+            auto [it, inserted] = _scan_batch_reported.try_emplace(peripheral->scan_key(), snapshot);
+            uint8_t changed = inserted ? 0xFF : scan_snapshot_diff(it->second, snapshot);
+            if (changed == 0) continue;
+
+            it->second = std::move(snapshot);
+            updates.push_back({Factory::build(peripheral), changed});
+        }
+        lock.unlock();
+
+        if (!updates.empty()) {
+            SAFE_CALLBACK_CALL(this->_callback_on_scan_updated_batch, std::move(updates));
+        }
+        lock.lock();
+    }
+}
+
+void AdapterBase::scan_batch_stop() {
+    {
+        std::scoped_lock lock(_scan_batch_mutex);
+        if (!_scan_batch_enabled) return;
+        _scan_batch_enabled = false;
+    }
+    _scan_batch_cv.notify_all();
+    _scan_batch_thread.join();
+
+    std::scoped_lock lock(_scan_batch_mutex);
+    _scan_batch_pending.clear();
+    _scan_batch_reported.clear();
+}
+
+void AdapterBase::set_scan_cache_limits(size_t max_entries, int ttl_ms) {
+    std::scoped_lock lock(_scan_cache_mutex);
+    _scan_cache_max_entries = max_entries;
+    _scan_cache_ttl = std::chrono::milliseconds(std::max(ttl_ms, 0));
+}
+
+void AdapterBase::set_scan_cache_pinned(const BluetoothAddress& address, bool pinned) {
+    std::scoped_lock lock(_scan_cache_mutex);
+    if (pinned) {
+        _scan_cache_pinned.insert(PeripheralBase::scan_key_of(address));
+    } else {
+        _scan_cache_pinned.erase(PeripheralBase::scan_key_of(address));
+    }
+}
+
+void AdapterBase::set_callback_on_scan_lost(std::function<void(Peripheral)> on_scan_lost) {
+    if (on_scan_lost) {
+        _callback_on_scan_lost.load(on_scan_lost);
+    } else {
+        _callback_on_scan_lost.unload();
+    }
+}
+
+void AdapterBase::scan_cache_touch(const std::shared_ptr<PeripheralBase>& peripheral) {
+    struct Evicted {
+        ScanKey key;
+        std::shared_ptr<PeripheralBase> peripheral;
+        bool reported;
+    };
+    std::vector<Evicted> evicted;
+
+    ScanKey key = peripheral->scan_key();
+    auto now = std::chrono::steady_clock::now();
+    {
+        std::scoped_lock lock(_scan_cache_mutex);
+        auto [it, inserted] = _scan_cache.try_emplace(key);
+        if (inserted) {
+            it->second.lru_position = _scan_cache_lru.insert(_scan_cache_lru.end(), key);
+        } else {
+            _scan_cache_lru.splice(_scan_cache_lru.end(), _scan_cache_lru, it->second.lru_position);
+        }
+        it->second.peripheral = peripheral;
+        it->second.last_seen = now;
+
+        // Entries that are neither expired nor over capacity end the walk, as everything after them was heard
+        // from more recently. The peripheral that was just heard from is last and always kept.
+        auto lru = _scan_cache_lru.begin();
+        while (*lru != key) {
+            auto& entry = _scan_cache.at(*lru);
+            bool over_capacity = _scan_cache_max_entries > 0 && _scan_cache.size() > _scan_cache_max_entries;
+            bool expired = _scan_cache_ttl.count() > 0 && now - entry.last_seen > _scan_cache_ttl;
+            if (!over_capacity && !expired) break;
+
+            if (_scan_cache_pinned.count(*lru) != 0 || entry.peripheral->is_connected()) {
+                lru++;
+                continue;
+            }
+
+            evicted.push_back({*lru, std::move(entry.peripheral), entry.reported});
+            _scan_cache.erase(*lru);
+            lru = _scan_cache_lru.erase(lru);
+        }
+    }
+
+    for (auto& entry : evicted) {
+        {
+            std::scoped_lock lock(_scan_filter_mutex);
+            _scan_filter_reported_data.erase(entry.key);
+        }
+        {
+            std::scoped_lock lock(_scan_batch_mutex);
+            _scan_batch_pending.erase(entry.key);
+            _scan_batch_reported.erase(entry.key);
+        }
+
+        // Evictions are rare enough for the address to be formatted here.
+        BluetoothAddress address = entry.peripheral->address();
+        scan_cache_evict(address, entry.peripheral);
+        SAFE_CALLBACK_CALL(this->_listener_on_scan_lost, address);
+        if (entry.reported) {
+            SAFE_CALLBACK_CALL(this->_callback_on_scan_lost, Factory::build(entry.peripheral));
+        }
+    }
+}
+
 }
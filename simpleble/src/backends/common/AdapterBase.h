@@ -1,19 +1,29 @@
 #pragma once
 
+#include <chrono>
+#include <condition_variable>
 #include <functional>
+#include <list>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
+#include <simpleble/Adapter.h>
 #include <simpleble/Exceptions.h>
 #include <simpleble/Types.h>
 
+#include "PeripheralBase.h"
+
 #include <kvn_safe_callback.hpp>
 
 namespace SimpleBLE {
 
 class Peripheral;
-class PeripheralBase;
 
 /**
  * Abstract base class for Bluetooth adapter implementations.
@@ -31,7 +41,7 @@ class PeripheralBase;
  */
 class AdapterBase {
   public:
-    virtual ~AdapterBase() = default;
+    virtual ~AdapterBase();
 
     virtual void* underlying() const = 0;
 
@@ -50,10 +60,32 @@ class AdapterBase {
     virtual bool scan_is_active() = 0;
     virtual std::vector<std::shared_ptr<PeripheralBase>> scan_get_results() = 0;
 
+    /**
+     * Store the filter used by the next scan.
+     *
+     * Backends that can filter in the OS override this to push the filter down. Results must still go through
+     * scan_filter_accepts(), as the OS might not support every criterion or apply it exactly.
+     */
+    virtual void set_scan_filter(const ScanFilter& filter);
+
     virtual void set_callback_on_scan_start(std::function<void()> on_scan_start);
     virtual void set_callback_on_scan_stop(std::function<void()> on_scan_stop);
     virtual void set_callback_on_scan_updated(std::function<void(Peripheral)> on_scan_updated);
     virtual void set_callback_on_scan_found(std::function<void(Peripheral)> on_scan_found);
+    virtual void set_callback_on_scan_updated_batch(
+        std::function<void(std::vector<ScanUpdate>)> on_scan_updated_batch, int interval_ms);
+
+    virtual void set_scan_cache_limits(size_t max_entries, int ttl_ms);
+    virtual void set_scan_cache_pinned(const BluetoothAddress& address, bool pinned);
+    virtual void set_callback_on_scan_lost(std::function<void(Peripheral)> on_scan_lost);
+
+    /**
+     * Listener for an AdapterAggregate spanning this adapter. on_seen is called for every result reported by
+     * this adapter, whether or not it reaches the user callbacks, and on_lost for every peripheral dropped from
+     * the scan cache. Both run on the thread reporting the result.
+     */
+    void set_scan_listener(std::function<void(std::shared_ptr<PeripheralBase>)> on_seen,
+                           std::function<void(BluetoothAddress)> on_lost);
 
     virtual std::vector<std::shared_ptr<PeripheralBase>> get_paired_peripherals() = 0;
     virtual std::vector<std::shared_ptr<PeripheralBase>> get_connected_peripherals() { return {}; };
@@ -69,6 +101,39 @@ class AdapterBase {
   protected:
     AdapterBase() = default;
 
+    /**
+     * In-process check of the scan filter, to be done before a result is reported to the user.
+     */
+    bool scan_filter_accepts(PeripheralBase& peripheral);
+
+    /**
+     * Record the manufacturer data of a result. Returns true if the filter disables duplicate data and
+     * it did not change since the last report, in which case an update should not be forwarded.
+     */
+    bool scan_filter_is_duplicate(PeripheralBase& peripheral);
+
+    /**
+     * Report a peripheral seen for the first time, or new advertising data for one that was already
+     * reported. Backends must go through these instead of invoking the scan callbacks, so that updates
+     * can be coalesced when a batch callback is set.
+     */
+    void scan_found(const std::shared_ptr<PeripheralBase>& peripheral);
+    void scan_updated(const std::shared_ptr<PeripheralBase>& peripheral);
+
+    /**
+     * Record an advertisement from the peripheral and enforce the scan cache limits. Backends call this
+     * for every advertisement, before any filtering, from the thread that updates their peripheral maps.
+     *
+     * Peripherals evicted as a result are handed to scan_cache_evict(), where the backend must drop every
+     * reference it keeps to them, before on_scan_lost is called.
+     */
+    void scan_cache_touch(const std::shared_ptr<PeripheralBase>& peripheral);
+    virtual void scan_cache_evict(const BluetoothAddress& address, const std::shared_ptr<PeripheralBase>& peripheral) {}
+
+    std::mutex _scan_filter_mutex;
+    ScanFilter _scan_filter;
+    std::map<ScanKey, std::map<uint16_t, ByteArray>> _scan_filter_reported_data;
+
     kvn::safe_callback<void()> _callback_on_power_on;
     kvn::safe_callback<void()> _callback_on_power_off;
 
@@ -76,6 +141,49 @@ class AdapterBase {
     kvn::safe_callback<void()> _callback_on_scan_stop;
     kvn::safe_callback<void(Peripheral)> _callback_on_scan_updated;
     kvn::safe_callback<void(Peripheral)> _callback_on_scan_found;
+    kvn::safe_callback<void(std::vector<ScanUpdate>)> _callback_on_scan_updated_batch;
+    kvn::safe_callback<void(Peripheral)> _callback_on_scan_lost;
+
+    kvn::safe_callback<void(std::shared_ptr<PeripheralBase>)> _listener_on_scan_seen;
+    kvn::safe_callback<void(BluetoothAddress)> _listener_on_scan_lost;
+
+  private:
+    struct ScanSnapshot {
+        std::string identifier;
+        int16_t rssi;
+        int16_t tx_power;
+        std::map<uint16_t, ByteArray> manufacturer_data;
+        std::vector<std::pair<BluetoothUUID, ByteArray>> services;
+    };
+
+    static ScanSnapshot scan_snapshot(PeripheralBase& peripheral);
+    static uint8_t scan_snapshot_diff(const ScanSnapshot& previous, const ScanSnapshot& current);
+
+    std::mutex _scan_batch_mutex;
+    std::condition_variable _scan_batch_cv;
+    std::thread _scan_batch_thread;
+    bool _scan_batch_enabled = false;
+    std::chrono::milliseconds _scan_batch_interval;
+    std::map<ScanKey, std::shared_ptr<PeripheralBase>> _scan_batch_pending;
+    std::map<ScanKey, ScanSnapshot> _scan_batch_reported;
+
+    void scan_batch_run();
+    void scan_batch_stop();
+
+    struct ScanCacheEntry {
+        std::shared_ptr<PeripheralBase> peripheral;
+        std::chrono::steady_clock::time_point last_seen;
+        std::list<ScanKey>::iterator lru_position;
+        bool reported = false;
+    };
+
+    std::mutex _scan_cache_mutex;
+    size_t _scan_cache_max_entries = 0;
+    std::chrono::milliseconds _scan_cache_ttl{0};
+    std::map<ScanKey, ScanCacheEntry> _scan_cache;
+    // Least recently heard from first, which is also ascending order of last_seen.
+    std::list<ScanKey> _scan_cache_lru;
+    std::set<ScanKey> _scan_cache_pinned;
 };
 
 }  // namespace SimpleBLE
@@ -0,0 +1,39 @@
+#include "CharacteristicHandleBase.h"
+
+#include <algorithm>
+
+using namespace SimpleBLE;
+
+CharacteristicHandleBase::CharacteristicHandleBase(const PeripheralBase* owner, const BluetoothUUID& service,
+                                                   const BluetoothUUID& characteristic)
+    : owner_(owner), service_(service), characteristic_(characteristic) {}
+
+const PeripheralBase* CharacteristicHandleBase::owner() const { return owner_; }
+
+BluetoothUUID const& CharacteristicHandleBase::service() const { return service_; }
+
+BluetoothUUID const& CharacteristicHandleBase::characteristic() const { return characteristic_; }
+
+bool CharacteristicHandleBase::is_valid() const { return valid_; }
+
+void CharacteristicHandleBase::invalidate() { valid_ = false; }
+
+// Handles can outlive the peripheral through the user, and must not be usable with whatever is allocated there next.
+CharacteristicHandleSet::~CharacteristicHandleSet() { invalidate(); }
+
+void CharacteristicHandleSet::add(const std::shared_ptr<CharacteristicHandleBase>& handle) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // Handles dropped by the user are pruned here, so that resolving in a loop does not grow the set.
+    handles_.erase(std::remove_if(handles_.begin(), handles_.end(),
+                                  [](const std::weak_ptr<CharacteristicHandleBase>& entry) { return entry.expired(); }),
+                   handles_.end());
+    handles_.push_back(handle);
+}
+
+void CharacteristicHandleSet::invalidate() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& entry : handles_) {
+        if (auto handle = entry.lock()) handle->invalidate();
+    }
+    handles_.clear();
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <simpleble/Types.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace SimpleBLE {
+
+class PeripheralBase;
+
+/**
+ * Characteristic resolved once by PeripheralBase::resolve(), so that later operations can skip the lookup.
+ *
+ * The base class only remembers the UUIDs, which is what the default PeripheralBase implementation falls back
+ * to. Backends derive from it to bind their own object and use it from the handle overloads of PeripheralBase.
+ */
+class CharacteristicHandleBase {
+  public:
+    CharacteristicHandleBase(const PeripheralBase* owner, const BluetoothUUID& service,
+                             const BluetoothUUID& characteristic);
+    virtual ~CharacteristicHandleBase() = default;
+
+    /**
+     * Peripheral that resolved the handle, which is the only one able to make sense of what it binds.
+     */
+    const PeripheralBase* owner() const;
+
+    BluetoothUUID const& service() const;
+    BluetoothUUID const& characteristic() const;
+
+    bool is_valid() const;
+    void invalidate();
+
+  private:
+    const PeripheralBase* owner_;
+    BluetoothUUID service_;
+    BluetoothUUID characteristic_;
+    std::atomic_bool valid_{true};
+};
+
+/**
+ * Handles given out by a peripheral, to invalidate them all once whatever they are bound to goes away.
+ */
+class CharacteristicHandleSet {
+  public:
+    CharacteristicHandleSet() = default;
+    ~CharacteristicHandleSet();
+
+    void add(const std::shared_ptr<CharacteristicHandleBase>& handle);
+    void invalidate();
+
+  private:
+    std::mutex mutex_;
+    std::vector<std::weak_ptr<CharacteristicHandleBase>> handles_;
+};
+
+}  // namespace SimpleBLE
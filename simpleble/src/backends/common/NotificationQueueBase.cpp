@@ -0,0 +1,74 @@
+#include "NotificationQueueBase.h"
+#include "PeripheralBase.h"
+
+#include "LoggingInternal.h"
+
+#include <chrono>
+
+using namespace SimpleBLE;
+
+NotificationQueueBase::NotificationQueueBase(std::shared_ptr<PeripheralBase> peripheral, const BluetoothUUID& service,
+                                             const BluetoothUUID& characteristic, size_t capacity,
+                                             OverflowPolicy policy)
+    : peripheral_(std::move(peripheral)),
+      service_(service),
+      characteristic_(characteristic),
+      ring_(capacity, policy) {}
+
+NotificationQueueBase::~NotificationQueueBase() { close(); }
+
+void NotificationQueueBase::open() {
+    std::weak_ptr<NotificationQueueBase> weak_self = weak_from_this();
+    try {
+        peripheral_->notify(service_, characteristic_, [weak_self](ByteArray payload) {
+            if (auto self = weak_self.lock()) self->push(std::move(payload));
+        });
+    } catch (...) {
+        ring_.close();
+        throw;
+    }
+}
+
+void NotificationQueueBase::push(ByteArray payload) {
+    ring_.push(Notification{std::move(payload), std::chrono::steady_clock::now()});
+}
+
+size_t NotificationQueueBase::capacity() const { return ring_.capacity(); }
+
+size_t NotificationQueueBase::size() const { return ring_.size(); }
+
+uint64_t NotificationQueueBase::dropped() const { return ring_.dropped(); }
+
+size_t NotificationQueueBase::drain(std::vector<Notification>& notifications, size_t max) {
+    size_t count = 0;
+    Notification notification;
+    while (count < max && ring_.pop(notification)) {
+        notifications.push_back(std::move(notification));
+        count++;
+    }
+    return count;
+}
+
+size_t NotificationQueueBase::drain(std::vector<ByteArray>& payloads, size_t max) {
+    size_t count = 0;
+    Notification notification;
+    while (count < max && ring_.pop(notification)) {
+        payloads.push_back(std::move(notification.payload));
+        count++;
+    }
+    return count;
+}
+
+bool NotificationQueueBase::wait_for(int timeout_ms) { return ring_.wait_for(timeout_ms); }
+
+bool NotificationQueueBase::is_open() const { return ring_.is_open(); }
+
+void NotificationQueueBase::close() {
+    if (!ring_.close()) return;
+
+    try {
+        if (peripheral_->is_connected()) peripheral_->unsubscribe(service_, characteristic_);
+    } catch (const std::exception& e) {
+        SIMPLEBLE_LOG_WARN(fmt::format("Failed to unsubscribe notification queue: {}", e.what()));
+    }
+}
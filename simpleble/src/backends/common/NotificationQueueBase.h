@@ -0,0 +1,56 @@
+#pragma once
+
+#include <simpleble/NotificationQueue.h>
+#include <simpleble/Types.h>
+
+#include "NotificationRing.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace SimpleBLE {
+
+class PeripheralBase;
+
+/**
+ * Subscription of a characteristic feeding a NotificationRing.
+ */
+class NotificationQueueBase : public std::enable_shared_from_this<NotificationQueueBase> {
+  public:
+    NotificationQueueBase(std::shared_ptr<PeripheralBase> peripheral, const BluetoothUUID& service,
+                          const BluetoothUUID& characteristic, size_t capacity, OverflowPolicy policy);
+    virtual ~NotificationQueueBase();
+
+    /**
+     * Subscribe to the characteristic. The subscription only holds a weak reference to the queue, so that
+     * dropping the queue does not have to wait for the backend.
+     */
+    void open();
+
+    /**
+     * Store a notification, called from the backend's event thread.
+     */
+    void push(ByteArray payload);
+
+    size_t capacity() const;
+    size_t size() const;
+    uint64_t dropped() const;
+
+    size_t drain(std::vector<Notification>& notifications, size_t max);
+    size_t drain(std::vector<ByteArray>& payloads, size_t max);
+    bool wait_for(int timeout_ms);
+
+    bool is_open() const;
+    void close();
+
+  private:
+    std::shared_ptr<PeripheralBase> peripheral_;
+    BluetoothUUID service_;
+    BluetoothUUID characteristic_;
+
+    NotificationRing ring_;
+};
+
+}  // namespace SimpleBLE
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <simpleble/NotificationQueue.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace SimpleBLE {
+
+/**
+ * Bounded multi-producer, multi-consumer ring of notifications.
+ *
+ * Every cell carries a sequence number telling whether it is ready to be written or read at a given position,
+ * so that both ends claim cells with a single compare-and-swap and never take a lock. Dropping the oldest entry
+ * on overflow is done by the producer consuming it, which is why consumers have to be supported in the first
+ * place even if a single thread drains the ring.
+ */
+class NotificationRing {
+  public:
+    NotificationRing(size_t capacity, OverflowPolicy policy)
+        : policy_(policy),
+          capacity_(std::max<size_t>(capacity, 1)),
+          cell_count_(std::max<size_t>(capacity_, 2)),
+          cells_(new Cell[cell_count_]) {
+        for (size_t i = 0; i < cell_count_; i++) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Store a notification without blocking, returning false if it was dropped.
+     *
+     * With DROP_OLDEST a full ring gives up its oldest entry once. If other producers fill the freed cell first,
+     * the new notification is dropped instead of retrying, so that a producer never spins against its peers.
+     */
+    bool push(Notification notification) {
+        if (!open_.load(std::memory_order_relaxed)) return false;
+
+        if (!try_push(notification)) {
+            if (policy_ == OverflowPolicy::DROP_NEWEST) {
+                dropped_++;
+                return false;
+            }
+
+            Notification oldest;
+            if (try_pop(oldest)) dropped_++;
+
+            if (!try_push(notification)) {
+                dropped_++;
+                return false;
+            }
+        }
+
+        wake();
+        return true;
+    }
+
+    bool pop(Notification& notification) { return try_pop(notification); }
+
+    size_t capacity() const { return capacity_; }
+
+    size_t size() const {
+        size_t dequeued = dequeue_position_.load(std::memory_order_relaxed);
+        size_t enqueued = enqueue_position_.load(std::memory_order_relaxed);
+        return enqueued > dequeued ? std::min(enqueued - dequeued, capacity_) : 0;
+    }
+
+    uint64_t dropped() const { return dropped_; }
+
+    /**
+     * Block until a notification is stored, the ring is closed or the timeout elapses. Returns true if there
+     * are notifications to pop.
+     */
+    bool wait_for(int timeout_ms) {
+        std::unique_lock<std::mutex> lock(wait_mutex_);
+        waiting_++;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        wait_cv_.wait_for(lock, std::chrono::milliseconds(std::max(timeout_ms, 0)),
+                          [this]() { return size() > 0 || !open_; });
+        waiting_--;
+        return size() > 0;
+    }
+
+    bool is_open() const { return open_; }
+
+    /**
+     * Stop accepting notifications and wake up all waiters, returning false if the ring was already closed.
+     */
+    bool close() {
+        if (!open_.exchange(false)) return false;
+
+        { std::lock_guard<std::mutex> lock(wait_mutex_); }
+        wait_cv_.notify_all();
+        return true;
+    }
+
+  private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        Notification notification;
+    };
+
+    bool try_push(Notification& notification) {
+        size_t position = enqueue_position_.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = cells_[position % cell_count_];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            intptr_t lag = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+            if (lag < 0) return false;
+            if (lag == 0 && position >= dequeue_position_.load(std::memory_order_acquire) + capacity_) return false;
+            if (lag > 0) {
+                position = enqueue_position_.load(std::memory_order_relaxed);
+            } else if (enqueue_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                cell.notification = std::move(notification);
+                cell.sequence.store(position + 1, std::memory_order_release);
+                return true;
+            }
+        }
+    }
+
+    bool try_pop(Notification& notification) {
+        size_t position = dequeue_position_.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = cells_[position % cell_count_];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            intptr_t lag = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+
+            if (lag < 0) return false;
+            if (lag > 0) {
+                position = dequeue_position_.load(std::memory_order_relaxed);
+            } else if (dequeue_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                notification = std::move(cell.notification);
+                cell.sequence.store(position + cell_count_, std::memory_order_release);
+                return true;
+            }
+        }
+    }
+
+    void wake() {
+        // Pairs with the fence in wait_for(): either the consumer sees the new entry before going to sleep, or the
+        // producer sees the consumer waiting and has to get past the mutex, which the consumer only releases in wait.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiting_.load(std::memory_order_relaxed) == 0) return;
+
+        { std::lock_guard<std::mutex> lock(wait_mutex_); }
+        wait_cv_.notify_all();
+    }
+
+    OverflowPolicy policy_;
+
+    const size_t capacity_;
+    // The sequence numbers cannot tell a written cell from a free one with a single cell, so there are always two.
+    const size_t cell_count_;
+    std::unique_ptr<Cell[]> cells_;
+    std::atomic<size_t> enqueue_position_{0};
+    std::atomic<size_t> dequeue_position_{0};
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<bool> open_{true};
+
+    // Producers only touch the mutex to hand off to a consumer that is already waiting.
+    std::mutex wait_mutex_;
+    std::condition_variable wait_cv_;
+    std::atomic<int> waiting_{0};
+};
+
+}  // namespace SimpleBLE
@@ -0,0 +1,361 @@
+#include "PeripheralAggregate.h"
+
+#include "AdapterBase.h"
+#include "CharacteristicHandleBase.h"
+#include "CommonUtils.h"
+#include "LoggingInternal.h"
+#include "ServiceBase.h"
+#include "WriteStreamBase.h"
+
+#include <simpleble/Exceptions.h>
+
+#include <algorithm>
+#include <climits>
+#include <exception>
+#include <tuple>
+
+using namespace SimpleBLE;
+
+PeripheralAggregate::PeripheralAggregate(BluetoothAddress address, std::shared_ptr<AggregateConnections> connections)
+    : _address(std::move(address)), _scan_key(scan_key_of(_address)), _connections(std::move(connections)) {}
+
+void PeripheralAggregate::sighting_update(size_t index, std::shared_ptr<AdapterBase> adapter,
+                                          std::shared_ptr<PeripheralBase> peripheral) {
+    int16_t rssi = peripheral->rssi();
+    auto now = std::chrono::steady_clock::now();
+
+    std::scoped_lock lock(_mutex);
+    _sources.insert_or_assign(index, Source{index, std::move(adapter), std::move(peripheral), rssi, now});
+}
+
+void PeripheralAggregate::sighting_remove(size_t index) {
+    std::scoped_lock lock(_mutex);
+    auto it = _sources.find(index);
+    if (it == _sources.end() || it->second.peripheral == _connected) return;
+
+    _sources.erase(it);
+}
+
+std::shared_ptr<PeripheralBase> PeripheralAggregate::latest() {
+    std::scoped_lock lock(_mutex);
+    if (_connected) return _connected;
+
+    auto it = std::max_element(_sources.begin(), _sources.end(), [](const auto& a, const auto& b) {
+        return a.second.last_seen < b.second.last_seen;
+    });
+    return it != _sources.end() ? it->second.peripheral : nullptr;
+}
+
+std::shared_ptr<PeripheralBase> PeripheralAggregate::connection() {
+    std::scoped_lock lock(_mutex);
+    if (!_connected) throw Exception::NotConnected();
+    return _connected;
+}
+
+void PeripheralAggregate::connection_release() {
+    size_t index;
+    {
+        std::scoped_lock lock(_mutex);
+        if (!_connected) return;
+        _connected = nullptr;
+        index = _connected_index;
+    }
+
+    std::scoped_lock lock(_connections->mutex);
+    _connections->per_adapter.at(index)--;
+}
+
+void* PeripheralAggregate::underlying() const { return nullptr; }
+
+std::string PeripheralAggregate::identifier() {
+    auto peripheral = latest();
+    return peripheral ? peripheral->identifier() : "";
+}
+
+BluetoothAddress PeripheralAggregate::address() { return _address; }
+
+ScanKey PeripheralAggregate::scan_key() { return _scan_key; }
+
+BluetoothAddressType PeripheralAggregate::address_type() {
+    auto peripheral = latest();
+    return peripheral ? peripheral->address_type() : BluetoothAddressType::UNSPECIFIED;
+}
+
+int16_t PeripheralAggregate::rssi() {
+    std::scoped_lock lock(_mutex);
+    int16_t rssi = INT16_MIN;
+    for (auto& [index, source] : _sources) {
+        rssi = std::max(rssi, source.rssi);
+    }
+    return rssi;
+}
+
+int16_t PeripheralAggregate::tx_power() {
+    auto peripheral = latest();
+    return peripheral ? peripheral->tx_power() : INT16_MIN;
+}
+
+bool PeripheralAggregate::has_tx_power() {
+    auto peripheral = latest();
+    return peripheral && peripheral->has_tx_power();
+}
+
+uint16_t PeripheralAggregate::mtu() {
+    std::shared_ptr<PeripheralBase> peripheral;
+    {
+        std::scoped_lock lock(_mutex);
+        peripheral = _connected;
+    }
+    return peripheral ? peripheral->mtu() : 0;
+}
+
+void PeripheralAggregate::connect() {
+    std::shared_ptr<PeripheralBase> connected;
+    std::vector<Source> candidates;
+    {
+        std::scoped_lock lock(_mutex);
+        connected = _connected;
+        for (auto& [index, source] : _sources) {
+            candidates.push_back(source);
+        }
+    }
+    if (connected) {
+        connected->connect();
+        return;
+    }
+    if (candidates.empty()) throw Exception::OperationFailed("No adapter has heard from " + _address);
+
+    {
+        std::scoped_lock lock(_connections->mutex);
+        auto& load = _connections->per_adapter;
+        std::sort(candidates.begin(), candidates.end(), [&load](const Source& a, const Source& b) {
+            return std::make_tuple(load.at(a.index), -a.rssi) < std::make_tuple(load.at(b.index), -b.rssi);
+        });
+    }
+
+    // Adapters that fail to connect are skipped in favor of the next least loaded one.
+    std::exception_ptr error;
+    for (auto& candidate : candidates) {
+        {
+            std::scoped_lock lock(_mutex);
+            _connected = candidate.peripheral;
+            _connected_index = candidate.index;
+        }
+        {
+            std::scoped_lock lock(_connections->mutex);
+            _connections->per_adapter.at(candidate.index)++;
+        }
+
+        std::weak_ptr<PeripheralAggregate> weak_this = weak_from_this();
+        candidate.peripheral->set_callback_on_connected([weak_this]() {
+            if (auto self = weak_this.lock()) SAFE_CALLBACK_CALL(self->_callback_on_connected);
+        });
+        candidate.peripheral->set_callback_on_disconnected([weak_this]() {
+            if (auto self = weak_this.lock()) {
+                self->connection_release();
+                SAFE_CALLBACK_CALL(self->_callback_on_disconnected);
+            }
+        });
+
+        try {
+            candidate.peripheral->connect();
+            return;
+        } catch (const std::exception& ex) {
+            SIMPLEBLE_LOG_WARN(fmt::format("Failed to connect to {} through {}: {}", _address,
+                                           candidate.adapter->identifier(), ex.what()));
+            error = std::current_exception();
+        }
+
+        candidate.peripheral->set_callback_on_connected(nullptr);
+        candidate.peripheral->set_callback_on_disconnected(nullptr);
+        connection_release();
+    }
+    std::rethrow_exception(error);
+}
+
+void PeripheralAggregate::disconnect() {
+    std::shared_ptr<PeripheralBase> peripheral;
+    {
+        std::scoped_lock lock(_mutex);
+        peripheral = _connected;
+    }
+    if (!peripheral) return;
+
+    peripheral->disconnect();
+    connection_release();
+}
+
+bool PeripheralAggregate::is_connected() {
+    std::shared_ptr<PeripheralBase> peripheral;
+    {
+        std::scoped_lock lock(_mutex);
+        peripheral = _connected;
+    }
+    return peripheral && peripheral->is_connected();
+}
+
+bool PeripheralAggregate::is_connectable() {
+    auto peripheral = latest();
+    return peripheral && peripheral->is_connectable();
+}
+
+bool PeripheralAggregate::is_paired() {
+    std::vector<std::shared_ptr<PeripheralBase>> peripherals;
+    {
+        std::scoped_lock lock(_mutex);
+        for (auto& [index, source] : _sources) {
+            peripherals.push_back(source.peripheral);
+        }
+    }
+    return std::any_of(peripherals.begin(), peripherals.end(), [](auto& peripheral) { return peripheral->is_paired(); });
+}
+
+void PeripheralAggregate::unpair() {
+    std::vector<std::shared_ptr<PeripheralBase>> peripherals;
+    {
+        std::scoped_lock lock(_mutex);
+        for (auto& [index, source] : _sources) {
+            peripherals.push_back(source.peripheral);
+        }
+    }
+
+    // Every adapter keeps its own bond, so all of them are removed.
+    for (auto& peripheral : peripherals) {
+        if (peripheral->is_paired()) peripheral->unpair();
+    }
+}
+
+std::vector<std::shared_ptr<ServiceBase>> PeripheralAggregate::available_services() {
+    std::shared_ptr<PeripheralBase> peripheral;
+    {
+        std::scoped_lock lock(_mutex);
+        peripheral = _connected;
+    }
+    return peripheral ? peripheral->available_services() : std::vector<std::shared_ptr<ServiceBase>>();
+}
+
+std::vector<std::shared_ptr<ServiceBase>> PeripheralAggregate::advertised_services() {
+    auto peripheral = latest();
+    return peripheral ? peripheral->advertised_services() : std::vector<std::shared_ptr<ServiceBase>>();
+}
+
+std::map<uint16_t, ByteArray> PeripheralAggregate::manufacturer_data() {
+    auto peripheral = latest();
+    return peripheral ? peripheral->manufacturer_data() : std::map<uint16_t, ByteArray>();
+}
+
+std::vector<PeripheralSighting> PeripheralAggregate::sightings() {
+    std::vector<Source> sources;
+    {
+        std::scoped_lock lock(_mutex);
+        for (auto& [index, source] : _sources) {
+            sources.push_back(source);
+        }
+    }
+
+    std::vector<PeripheralSighting> sightings;
+    for (auto& source : sources) {
+        sightings.push_back({source.adapter->identifier(), source.adapter->address(), source.rssi, source.last_seen});
+    }
+    return sightings;
+}
+
+ByteArray PeripheralAggregate::read(BluetoothUUID const& service, BluetoothUUID const& characteristic) {
+    return connection()->read(service, characteristic);
+}
+
+void PeripheralAggregate::write_request(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                                        ByteArray const& data) {
+    connection()->write_request(service, characteristic, data);
+}
+
+void PeripheralAggregate::write_command(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                                        ByteArray const& data) {
+    connection()->write_command(service, characteristic, data);
+}
+
+void PeripheralAggregate::notify(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                                 std::function<void(ByteArray payload)> callback) {
+    connection()->notify(service, characteristic, std::move(callback));
+}
+
+void PeripheralAggregate::indicate(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                                   std::function<void(ByteArray payload)> callback) {
+    connection()->indicate(service, characteristic, std::move(callback));
+}
+
+void PeripheralAggregate::unsubscribe(BluetoothUUID const& service, BluetoothUUID const& characteristic) {
+    connection()->unsubscribe(service, characteristic);
+}
+
+ByteArray PeripheralAggregate::read(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                                    BluetoothUUID const& descriptor) {
+    return connection()->read(service, characteristic, descriptor);
+}
+
+void PeripheralAggregate::write(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                                BluetoothUUID const& descriptor, ByteArray const& data) {
+    connection()->write(service, characteristic, descriptor, data);
+}
+
+void PeripheralAggregate::read_async(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                                     ReadCallback callback) {
+    connection()->read_async(service, characteristic, std::move(callback));
+}
+
+void PeripheralAggregate::write_request_async(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                                              ByteArray const& data, WriteCallback callback) {
+    connection()->write_request_async(service, characteristic, data, std::move(callback));
+}
+
+void PeripheralAggregate::write_command_async(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                                              ByteArray const& data, WriteCallback callback) {
+    connection()->write_command_async(service, characteristic, data, std::move(callback));
+}
+
+void PeripheralAggregate::read_async(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                                     BluetoothUUID const& descriptor, ReadCallback callback) {
+    connection()->read_async(service, characteristic, descriptor, std::move(callback));
+}
+
+void PeripheralAggregate::write_async(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                                      BluetoothUUID const& descriptor, ByteArray const& data, WriteCallback callback) {
+    connection()->write_async(service, characteristic, descriptor, data, std::move(callback));
+}
+
+// Handles are resolved by the connected peripheral, which invalidates them once it disconnects.
+std::shared_ptr<CharacteristicHandleBase> PeripheralAggregate::resolve(BluetoothUUID const& service,
+                                                                       BluetoothUUID const& characteristic) {
+    return connection()->resolve(service, characteristic);
+}
+
+ByteArray PeripheralAggregate::read(CharacteristicHandleBase& handle) { return connection()->read(handle); }
+
+void PeripheralAggregate::write_request(CharacteristicHandleBase& handle, ByteArray const& data) {
+    connection()->write_request(handle, data);
+}
+
+void PeripheralAggregate::write_command(CharacteristicHandleBase& handle, ByteArray const& data) {
+    connection()->write_command(handle, data);
+}
+
+std::shared_ptr<WriteStreamBase> PeripheralAggregate::open_write_stream(BluetoothUUID const& service,
+                                                                        BluetoothUUID const& characteristic) {
+    return connection()->open_write_stream(service, characteristic);
+}
+
+void PeripheralAggregate::set_callback_on_connected(std::function<void()> on_connected) {
+    if (on_connected) {
+        _callback_on_connected.load(on_connected);
+    } else {
+        _callback_on_connected.unload();
+    }
+}
+
+void PeripheralAggregate::set_callback_on_disconnected(std::function<void()> on_disconnected) {
+    if (on_disconnected) {
+        _callback_on_disconnected.load(on_disconnected);
+    } else {
+        _callback_on_disconnected.unload();
+    }
+}
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <simpleble/Types.h>
+#include "PeripheralBase.h"
+
+#include <kvn_safe_callback.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace SimpleBLE {
+
+class AdapterBase;
+
+/**
+ * Connections made through each adapter of an AdapterAggregate, shared with its peripherals so that they can
+ * pick the least loaded adapter.
+ */
+struct AggregateConnections {
+    std::mutex mutex;
+    std::vector<size_t> per_adapter;
+};
+
+/**
+ * Peripheral heard by one or more adapters of an AdapterAggregate.
+ *
+ * Advertising data comes from the adapter that heard the peripheral most recently, while the RSSI is the
+ * strongest one currently known. Once connected, everything goes through the adapter the connection was made
+ * with.
+ */
+class PeripheralAggregate : public PeripheralBase, public std::enable_shared_from_this<PeripheralAggregate> {
+  public:
+    PeripheralAggregate(BluetoothAddress address, std::shared_ptr<AggregateConnections> connections);
+    virtual ~PeripheralAggregate() = default;
+
+    /**
+     * Record an advertisement received by the adapter at the given index of the aggregate.
+     */
+    void sighting_update(size_t index, std::shared_ptr<AdapterBase> adapter, std::shared_ptr<PeripheralBase> peripheral);
+
+    /**
+     * Forget the peripheral of an adapter that no longer tracks it, unless the connection goes through it.
+     */
+    void sighting_remove(size_t index);
+
+    void* underlying() const override;
+
+    std::string identifier() override;
+    BluetoothAddress address() override;
+    BluetoothAddressType address_type() override;
+    ScanKey scan_key() override;
+    int16_t rssi() override;
+    int16_t tx_power() override;
+    bool has_tx_power() override;
+    uint16_t mtu() override;
+
+    void connect() override;
+    void disconnect() override;
+    bool is_connected() override;
+    bool is_connectable() override;
+    bool is_paired() override;
+    void unpair() override;
+
+    std::vector<std::shared_ptr<ServiceBase>> available_services() override;
+    std::vector<std::shared_ptr<ServiceBase>> advertised_services() override;
+
+    std::map<uint16_t, ByteArray> manufacturer_data() override;
+    std::vector<PeripheralSighting> sightings() override;
+
+    // clang-format off
+    ByteArray read(BluetoothUUID const& service, BluetoothUUID const& characteristic) override;
+    void write_request(BluetoothUUID const& service, BluetoothUUID const& characteristic, ByteArray const& data) override;
+    void write_command(BluetoothUUID const& service, BluetoothUUID const& characteristic, ByteArray const& data) override;
+    void notify(BluetoothUUID const& service, BluetoothUUID const& characteristic, std::function<void(ByteArray payload)> callback) override;
+    void indicate(BluetoothUUID const& service, BluetoothUUID const& characteristic, std::function<void(ByteArray payload)> callback) override;
+    void unsubscribe(BluetoothUUID const& service, BluetoothUUID const& characteristic) override;
+
+    ByteArray read(BluetoothUUID const& service, BluetoothUUID const& characteristic, BluetoothUUID const& descriptor) override;
+    void write(BluetoothUUID const& service, BluetoothUUID const& characteristic, BluetoothUUID const& descriptor, ByteArray const& data) override;
+
+    void read_async(BluetoothUUID const& service, BluetoothUUID const& characteristic, ReadCallback callback) override;
+    void write_request_async(BluetoothUUID const& service, BluetoothUUID const& characteristic, ByteArray const& data, WriteCallback callback) override;
+    void write_command_async(BluetoothUUID const& service, BluetoothUUID const& characteristic, ByteArray const& data, WriteCallback callback) override;
+    void read_async(BluetoothUUID const& service, BluetoothUUID const& characteristic, BluetoothUUID const& descriptor, ReadCallback callback) override;
+    void write_async(BluetoothUUID const& service, BluetoothUUID const& characteristic, BluetoothUUID const& descriptor, ByteArray const& data, WriteCallback callback) override;
+
+    std::shared_ptr<CharacteristicHandleBase> resolve(BluetoothUUID const& service, BluetoothUUID const& characteristic) override;
+    ByteArray read(CharacteristicHandleBase& handle) override;
+    void write_request(CharacteristicHandleBase& handle, ByteArray const& data) override;
+    void write_command(CharacteristicHandleBase& handle, ByteArray const& data) override;
+    // clang-format on
+
+    std::shared_ptr<WriteStreamBase> open_write_stream(BluetoothUUID const& service,
+                                                       BluetoothUUID const& characteristic) override;
+
+    void set_callback_on_connected(std::function<void()> on_connected) override;
+    void set_callback_on_disconnected(std::function<void()> on_disconnected) override;
+
+  private:
+    struct Source {
+        size_t index;
+        std::shared_ptr<AdapterBase> adapter;
+        std::shared_ptr<PeripheralBase> peripheral;
+        int16_t rssi;
+        std::chrono::steady_clock::time_point last_seen;
+    };
+
+    std::shared_ptr<PeripheralBase> latest();
+    std::shared_ptr<PeripheralBase> connection();
+    void connection_release();
+
+    const BluetoothAddress _address;
+    const ScanKey _scan_key;
+    std::shared_ptr<AggregateConnections> _connections;
+
+    std::mutex _mutex;
+    std::map<size_t, Source> _sources;
+    // Source the connection was made through, which stays in use until it is closed.
+    std::shared_ptr<PeripheralBase> _connected;
+    size_t _connected_index = 0;
+
+    kvn::safe_callback<void()> _callback_on_connected;
+    kvn::safe_callback<void()> _callback_on_disconnected;
+};
+
+}  // namespace SimpleBLE
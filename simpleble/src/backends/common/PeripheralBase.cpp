@@ -0,0 +1,97 @@
+#include "PeripheralBase.h"
+
+#include "CharacteristicHandleBase.h"
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <cctype>
+
+using namespace SimpleBLE;
+
+ScanKey PeripheralBase::scan_key_of(const BluetoothAddress& address) {
+    if (auto mac_address = MacAddress::try_parse(address)) return *mac_address;
+
+    // Backends do not agree on the case of the hexadecimal digits.
+    BluetoothAddress normalized = address;
+    std::transform(normalized.begin(), normalized.end(), normalized.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
+    return normalized;
+}
+
+// The caller keeps the peripheral alive through the callback until it has run.
+static void run_read(PeripheralBase* peripheral, std::function<ByteArray()> operation,
+                     PeripheralBase::ReadCallback callback) {
+    ThreadPool::shared().post(peripheral, [operation = std::move(operation), callback = std::move(callback)]() {
+        ByteArray value;
+        std::exception_ptr error;
+        try {
+            value = operation();
+        } catch (...) {
+            error = std::current_exception();
+        }
+        callback(std::move(value), error);
+    });
+}
+
+static void run_write(PeripheralBase* peripheral, std::function<void()> operation,
+                      PeripheralBase::WriteCallback callback) {
+    ThreadPool::shared().post(peripheral, [operation = std::move(operation), callback = std::move(callback)]() {
+        std::exception_ptr error;
+        try {
+            operation();
+        } catch (...) {
+            error = std::current_exception();
+        }
+        callback(error);
+    });
+}
+
+void PeripheralBase::read_async(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                                ReadCallback callback) {
+    run_read(this, [this, service, characteristic]() { return read(service, characteristic); }, std::move(callback));
+}
+
+void PeripheralBase::write_request_async(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                                         ByteArray const& data, WriteCallback callback) {
+    run_write(
+        this, [this, service, characteristic, data]() { write_request(service, characteristic, data); },
+        std::move(callback));
+}
+
+void PeripheralBase::write_command_async(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                                         ByteArray const& data, WriteCallback callback) {
+    run_write(
+        this, [this, service, characteristic, data]() { write_command(service, characteristic, data); },
+        std::move(callback));
+}
+
+void PeripheralBase::read_async(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                                BluetoothUUID const& descriptor, ReadCallback callback) {
+    run_read(
+        this, [this, service, characteristic, descriptor]() { return read(service, characteristic, descriptor); },
+        std::move(callback));
+}
+
+void PeripheralBase::write_async(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                                 BluetoothUUID const& descriptor, ByteArray const& data, WriteCallback callback) {
+    run_write(
+        this, [this, service, characteristic, descriptor, data]() { write(service, characteristic, descriptor, data); },
+        std::move(callback));
+}
+
+std::shared_ptr<CharacteristicHandleBase> PeripheralBase::resolve(BluetoothUUID const& service,
+                                                                  BluetoothUUID const& characteristic) {
+    return std::make_shared<CharacteristicHandleBase>(this, service, characteristic);
+}
+
+ByteArray PeripheralBase::read(CharacteristicHandleBase& handle) {
+    return read(handle.service(), handle.characteristic());
+}
+
+void PeripheralBase::write_request(CharacteristicHandleBase& handle, ByteArray const& data) {
+    write_request(handle.service(), handle.characteristic(), data);
+}
+
+void PeripheralBase::write_command(CharacteristicHandleBase& handle, ByteArray const& data) {
+    write_command(handle.service(), handle.characteristic(), data);
+}
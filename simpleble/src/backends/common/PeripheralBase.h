@@ -1,15 +1,27 @@
 #pragma once
 
+#include <cstdint>
+#include <exception>
 #include <functional>
 #include <map>
 #include <memory>
+#include <variant>
 #include <vector>
 
+#include <simpleble/MacAddress.h>
 #include <simpleble/Types.h>
 
 namespace SimpleBLE {
 
+class CharacteristicHandleBase;
 class ServiceBase;
+class WriteStreamBase;
+
+/**
+ * Identifies a peripheral in the scan tables of its adapter, which are looked up for every advertisement.
+ * MAC addresses are held packed. Anything else, such as the UUIDs macOS hands out, is kept as uppercase text.
+ */
+using ScanKey = std::variant<MacAddress, BluetoothAddress>;
 
 /**
  * Abstract base class for Bluetooth adapter implementations.
@@ -20,6 +32,9 @@ class ServiceBase;
  */
 class PeripheralBase {
   public:
+    using ReadCallback = std::function<void(ByteArray value, std::exception_ptr error)>;
+    using WriteCallback = std::function<void(std::exception_ptr error)>;
+
     virtual ~PeripheralBase() = default;
 
     virtual void* underlying() const = 0;
@@ -29,6 +44,13 @@ class PeripheralBase {
     virtual BluetoothAddressType address_type() = 0;
     virtual int16_t rssi() = 0;
 
+    /**
+     * Key of the peripheral in the scan tables, built from address() by default. Backends that hold the address
+     * as an integer override this, so that advertisements don't go through text.
+     */
+    virtual ScanKey scan_key() { return scan_key_of(address()); }
+    static ScanKey scan_key_of(const BluetoothAddress& address);
+
     /**
      * @brief Provides the advertised transmit power in dBm.
      *
@@ -36,6 +58,13 @@ class PeripheralBase {
      *       the returned value will be -32768.
      */
     virtual int16_t tx_power() = 0;
+
+    /**
+     * @brief Whether the peripheral advertised its transmit power.
+     *
+     * Backends that can tell an absent field from a value override this, as -32768 is only a placeholder.
+     */
+    virtual bool has_tx_power() { return tx_power() != INT16_MIN; }
     virtual uint16_t mtu() = 0;
 
     virtual void connect() = 0;
@@ -57,6 +86,11 @@ class PeripheralBase {
 
     virtual std::map<uint16_t, ByteArray> manufacturer_data() = 0;
 
+    /**
+     * Only peripherals that merge the results of several adapters have sightings.
+     */
+    virtual std::vector<PeripheralSighting> sightings() { return {}; }
+
     // clang-format off
     /* These methods are called by the frontend ONLY when the device is connected.
     */
@@ -72,6 +106,43 @@ class PeripheralBase {
     virtual void write(BluetoothUUID const& service, BluetoothUUID const& characteristic, BluetoothUUID const& descriptor, ByteArray const& data) = 0;
     // clang-format on
 
+    /**
+     * Asynchronous counterparts of the operations above, also only called when the device is connected. The
+     * callback runs exactly once, on a ThreadPool worker, with any failure passed as the error.
+     *
+     * The defaults run the blocking operation on the shared ThreadPool. Backends that can issue operations
+     * without blocking a thread should override them, and still deliver the callback through the pool.
+     */
+    // clang-format off
+    virtual void read_async(BluetoothUUID const& service, BluetoothUUID const& characteristic, ReadCallback callback);
+    virtual void write_request_async(BluetoothUUID const& service, BluetoothUUID const& characteristic, ByteArray const& data, WriteCallback callback);
+    virtual void write_command_async(BluetoothUUID const& service, BluetoothUUID const& characteristic, ByteArray const& data, WriteCallback callback);
+    virtual void read_async(BluetoothUUID const& service, BluetoothUUID const& characteristic, BluetoothUUID const& descriptor, ReadCallback callback);
+    virtual void write_async(BluetoothUUID const& service, BluetoothUUID const& characteristic, BluetoothUUID const& descriptor, ByteArray const& data, WriteCallback callback);
+    // clang-format on
+
+    /**
+     * Resolve a characteristic once for the handle overloads below, which are only called when the device is
+     * connected. The defaults keep the UUIDs and repeat the lookup on every call. Backends that bind their own
+     * object to the handle must fall back to the defaults for handles they did not resolve themselves, and
+     * invalidate theirs through a CharacteristicHandleSet as soon as the object stops being usable.
+     */
+    // clang-format off
+    virtual std::shared_ptr<CharacteristicHandleBase> resolve(BluetoothUUID const& service, BluetoothUUID const& characteristic);
+    virtual ByteArray read(CharacteristicHandleBase& handle);
+    virtual void write_request(CharacteristicHandleBase& handle, ByteArray const& data);
+    virtual void write_command(CharacteristicHandleBase& handle, ByteArray const& data);
+    // clang-format on
+
+    /**
+     * Backends with a dedicated channel for write commands return it here. The default returns nullptr,
+     * in which case the frontend falls back to a WriteStreamCommand.
+     */
+    virtual std::shared_ptr<WriteStreamBase> open_write_stream(BluetoothUUID const& service,
+                                                               BluetoothUUID const& characteristic) {
+        return nullptr;
+    }
+
     virtual void set_callback_on_connected(std::function<void()> on_connected) = 0;
     virtual void set_callback_on_disconnected(std::function<void()> on_disconnected) = 0;
 
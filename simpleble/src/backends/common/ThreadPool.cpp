@@ -0,0 +1,71 @@
+#include "ThreadPool.h"
+
+#include "LoggingInternal.h"
+
+#include <simpleble/Config.h>
+
+#include <algorithm>
+#include <exception>
+
+using namespace SimpleBLE;
+
+ThreadPool::ThreadPool(size_t num_workers) {
+    for (size_t i = 0; i < std::max<size_t>(num_workers, 1); i++) {
+        auto worker = std::make_shared<Worker>();
+        worker->thread = std::thread(&ThreadPool::run, worker);
+        _workers.push_back(std::move(worker));
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    for (auto& worker : _workers) {
+        {
+            std::lock_guard<std::mutex> lock(worker->mutex);
+            worker->stopping = true;
+        }
+        worker->cv.notify_one();
+    }
+
+    for (auto& worker : _workers) {
+        if (worker->thread.get_id() == std::this_thread::get_id()) {
+            worker->thread.detach();
+        } else {
+            worker->thread.join();
+        }
+    }
+}
+
+ThreadPool& ThreadPool::shared() {
+    static ThreadPool pool(Config::Base::async_workers);
+    return pool;
+}
+
+void ThreadPool::post(const void* key, Task task) {
+    Worker& worker = *_workers[std::hash<const void*>{}(key) % _workers.size()];
+    {
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        if (worker.stopping) return;
+        worker.queue.push_back(std::move(task));
+    }
+    worker.cv.notify_one();
+}
+
+void ThreadPool::run(std::shared_ptr<Worker> self) {
+    Worker& worker = *self;
+    std::unique_lock<std::mutex> lock(worker.mutex);
+    while (true) {
+        worker.cv.wait(lock, [&worker] { return worker.stopping || !worker.queue.empty(); });
+        if (worker.queue.empty()) return;
+
+        Task task = std::move(worker.queue.front());
+        worker.queue.pop_front();
+
+        lock.unlock();
+        try {
+            task();
+        } catch (const std::exception& ex) {
+            SIMPLEBLE_LOG_ERROR(fmt::format("Unhandled exception in asynchronous task: {}", ex.what()));
+        }
+        lock.lock();
+    }
+}
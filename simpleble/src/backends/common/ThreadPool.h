@@ -0,0 +1,52 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace SimpleBLE {
+
+/**
+ * Fixed set of worker threads running asynchronous operations and their completion callbacks.
+ *
+ * Tasks posted with the same key always land on the same worker, so the operations of a peripheral run in the
+ * order they were issued while different peripherals are served concurrently.
+ */
+class ThreadPool {
+  public:
+    using Task = std::function<void()>;
+
+    explicit ThreadPool(size_t num_workers);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * Pool shared by all backends, sized by Config::Base::async_workers when first used.
+     */
+    static ThreadPool& shared();
+
+    void post(const void* key, Task task);
+
+  private:
+    struct Worker {
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::deque<Task> queue;
+        bool stopping = false;
+        std::thread thread;
+    };
+
+    // Shared with the worker thread, which has to be detached if the pool is destroyed by one of its own tasks.
+    std::vector<std::shared_ptr<Worker>> _workers;
+
+    static void run(std::shared_ptr<Worker> self);
+};
+
+}  // namespace SimpleBLE
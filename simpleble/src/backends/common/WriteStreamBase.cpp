@@ -0,0 +1,35 @@
+#include "WriteStreamBase.h"
+#include "PeripheralBase.h"
+
+#include <simpleble/Exceptions.h>
+
+#include <algorithm>
+
+using namespace SimpleBLE;
+
+WriteStreamCommand::WriteStreamCommand(std::shared_ptr<PeripheralBase> peripheral, const BluetoothUUID& service,
+                                       const BluetoothUUID& characteristic)
+    : peripheral_(std::move(peripheral)), service_(service), characteristic_(characteristic) {}
+
+uint16_t WriteStreamCommand::mtu() {
+    if (!peripheral_) throw Exception::OperationFailed("Write stream is closed");
+
+    // Some backends cannot report the MTU, in which case the minimum payload of a write command is assumed.
+    return std::max<uint16_t>(peripheral_->mtu(), 20);
+}
+
+size_t WriteStreamCommand::write(ByteArray const& data) {
+    uint16_t packet_size = mtu();
+    for (size_t offset = 0; offset < data.size(); offset += packet_size) {
+        size_t end = std::min(data.size(), offset + packet_size);
+        peripheral_->write_command(service_, characteristic_, data.slice(offset, end));
+    }
+    return data.size();
+}
+
+// Write commands are handed to the backend as soon as they are made, so there is never anything to wait for.
+bool WriteStreamCommand::wait_writable([[maybe_unused]] int timeout_ms) { return is_open(); }
+
+bool WriteStreamCommand::is_open() { return peripheral_ != nullptr; }
+
+void WriteStreamCommand::close() { peripheral_.reset(); }
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <simpleble/Types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace SimpleBLE {
+
+class PeripheralBase;
+
+class WriteStreamBase {
+  public:
+    virtual ~WriteStreamBase() = default;
+
+    virtual uint16_t mtu() = 0;
+    virtual size_t write(ByteArray const& data) = 0;
+    virtual bool wait_writable(int timeout_ms) = 0;
+    virtual bool is_open() = 0;
+    virtual void close() = 0;
+
+  protected:
+    WriteStreamBase() = default;
+};
+
+/**
+ * Stream for backends without a dedicated write channel, which sends every packet through
+ * PeripheralBase::write_command() and therefore never reports backpressure.
+ */
+class WriteStreamCommand : public WriteStreamBase {
+  public:
+    WriteStreamCommand(std::shared_ptr<PeripheralBase> peripheral, const BluetoothUUID& service,
+                       const BluetoothUUID& characteristic);
+    virtual ~WriteStreamCommand() = default;
+
+    uint16_t mtu() override;
+    size_t write(ByteArray const& data) override;
+    bool wait_writable(int timeout_ms) override;
+    bool is_open() override;
+    void close() override;
+
+  private:
+    std::shared_ptr<PeripheralBase> peripheral_;
+    BluetoothUUID service_;
+    BluetoothUUID characteristic_;
+};
+
+}  // namespace SimpleBLE
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <simpleble/MacAddress.h>
 #include <simpleble/Types.h>
 #include <cstdint>
 #include <map>
@@ -10,7 +11,7 @@ namespace SimpleBLE {
 struct advertising_data_t {
     std::string identifier;
     BluetoothAddressType address_type;
-    BluetoothAddress mac_address;
+    MacAddress mac_address;
     bool connectable;
     int16_t rssi;
     int16_t tx_power;
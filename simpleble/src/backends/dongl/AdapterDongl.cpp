@@ -3,6 +3,7 @@
 #include "AdapterDongl.h"
 #include "BuilderBase.h"
 #include "CommonUtils.h"
+#include "LoggingInternal.h"
 #include "PeripheralDongl.h"
 #include "protocol/simpleble.pb.h"
 #include "serial/Protocol.h"
@@ -107,37 +108,53 @@ bool AdapterDongl::scan_is_active() { return false; }
 
 SharedPtrVector<PeripheralBase> AdapterDongl::scan_get_results() { return Util::values(seen_peripherals_); }
 
+void AdapterDongl::scan_cache_evict(const BluetoothAddress& address, const std::shared_ptr<PeripheralBase>& peripheral) {
+    MacAddress key = std::static_pointer_cast<PeripheralDongl>(peripheral)->mac_address();
+    seen_peripherals_.erase(key);
+    peripherals_.erase(key);
+}
+
 SharedPtrVector<PeripheralBase> AdapterDongl::get_paired_peripherals() { return {}; }
 
 void AdapterDongl::_scan_received_callback(advertising_data_t data) {
-    if (this->peripherals_.count(data.mac_address) == 0) {
+    auto it = this->peripherals_.find(data.mac_address);
+    if (it == this->peripherals_.end()) {
         // If the incoming peripheral has never been seen before, create and save a reference to it.
         auto base_peripheral = std::make_shared<PeripheralDongl>(_serial_protocol, data);
-        this->peripherals_.insert(std::make_pair(data.mac_address, base_peripheral));
+        it = this->peripherals_.insert(std::make_pair(data.mac_address, base_peripheral)).first;
     }
 
     // Update the received advertising data.
-    auto base_peripheral = this->peripherals_.at(data.mac_address);
+    auto base_peripheral = it->second;
     base_peripheral->update_advertising_data(data);
+    scan_cache_touch(base_peripheral);
+
+    if (!scan_filter_accepts(*base_peripheral)) return;
+    bool duplicate = scan_filter_is_duplicate(*base_peripheral);
 
-    // Convert the base object into an external-facing Peripheral object
-    Peripheral peripheral = Factory::build(base_peripheral);
 
     // Check if the device has been seen before, to forward the correct call to the user.
     if (this->seen_peripherals_.count(data.mac_address) == 0) {
         // Store it in our table of seen peripherals
         this->seen_peripherals_.insert(std::make_pair(data.mac_address, base_peripheral));
-        SAFE_CALLBACK_CALL(this->_callback_on_scan_found, peripheral);
-    } else {
-        SAFE_CALLBACK_CALL(this->_callback_on_scan_updated, peripheral);
+        scan_found(base_peripheral);
+    } else if (!duplicate) {
+        scan_updated(base_peripheral);
     }
 }
 
 void AdapterDongl::_on_simpleble_event(const simpleble_Event& event) {
     switch (event.which_evt) {
         case simpleble_Event_adv_evt_tag: {
+            // Nothing on the serial thread would catch an exception, so malformed reports are dropped instead.
+            auto address = MacAddress::try_parse(event.evt.adv_evt.address);
+            if (!address) {
+                SIMPLEBLE_LOG_WARN(fmt::format("Ignoring advertisement with invalid address {}", event.evt.adv_evt.address));
+                break;
+            }
+
             advertising_data_t data = advertising_data_t();
-            data.mac_address = std::string(event.evt.adv_evt.address);
+            data.mac_address = *address;
             data.address_type = static_cast<SimpleBLE::BluetoothAddressType>(event.evt.adv_evt.address_type);
             data.identifier = std::string(event.evt.adv_evt.identifier);
             data.connectable = event.evt.adv_evt.connectable;
@@ -163,11 +180,12 @@ void AdapterDongl::_on_simpleble_event(const simpleble_Event& event) {
         }
 
         case simpleble_Event_connection_evt_tag: {
-            for (auto& [address, peripheral] : this->peripherals_) {
-                if (peripheral->address() == std::string(event.evt.connection_evt.address)) {
-                    peripheral->notify_connected(event.evt.connection_evt.conn_handle);
-                    break;
-                }
+            auto address = MacAddress::try_parse(event.evt.connection_evt.address);
+            if (!address) break;
+
+            auto it = this->peripherals_.find(*address);
+            if (it != this->peripherals_.end()) {
+                it->second->notify_connected(event.evt.connection_evt.conn_handle);
             }
             break;
         }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <simpleble/Exceptions.h>
+#include <simpleble/MacAddress.h>
 #include <simpleble/Types.h>
 
 #include "AdapterBase.h"
@@ -47,12 +48,14 @@ class AdapterDongl : public AdapterBase {
     virtual bool bluetooth_enabled() override;
 
   private:
+    void scan_cache_evict(const BluetoothAddress& address, const std::shared_ptr<PeripheralBase>& peripheral) override;
+
     void _scan_received_callback(advertising_data_t data);
     void _on_simpleble_event(const simpleble_Event& event);
 
     std::shared_ptr<Dongl::Serial::Protocol> _serial_protocol;
-    std::map<BluetoothAddress, std::shared_ptr<PeripheralDongl>> peripherals_;
-    std::map<BluetoothAddress, std::shared_ptr<PeripheralDongl>> seen_peripherals_;
+    std::map<MacAddress, std::shared_ptr<PeripheralDongl>> peripherals_;
+    std::map<MacAddress, std::shared_ptr<PeripheralDongl>> seen_peripherals_;
 
 };
 
@@ -1,8 +1,10 @@
 #include "PeripheralDongl.h"
 
 #include "CharacteristicBase.h"
+#include "CharacteristicHandleBase.h"
 #include "DescriptorBase.h"
 #include "ServiceBase.h"
+#include "ThreadPool.h"
 
 #include <simpleble/Exceptions.h>
 
@@ -38,10 +40,14 @@ void* PeripheralDongl::underlying() const { return nullptr; }
 
 std::string PeripheralDongl::identifier() { return _identifier; }
 
-BluetoothAddress PeripheralDongl::address() { return _address; }
+BluetoothAddress PeripheralDongl::address() { return _address.str(); }
 
 BluetoothAddressType PeripheralDongl::address_type() { return _address_type; }
 
+ScanKey PeripheralDongl::scan_key() { return _address; }
+
+MacAddress PeripheralDongl::mac_address() const { return _address; }
+
 int16_t PeripheralDongl::rssi() { return _rssi; }
 
 int16_t PeripheralDongl::tx_power() { return _tx_power; }
@@ -139,13 +145,7 @@ ByteArray PeripheralDongl::read(BluetoothUUID const& service_uuid, BluetoothUUID
         throw Exception::OperationFailed(fmt::format("Characteristic {} is not readable", characteristic_uuid));
     }
 
-    simpleble_ReadRsp rsp = _serial_protocol->simpleble_read(_conn_handle, characteristic.handle_value);
-    if (rsp.ret_code != 0) {
-        throw Exception::OperationFailed(
-            fmt::format("Failed to read characteristic {} - ret_code: {}", characteristic_uuid, rsp.ret_code));
-    }
-
-    return ByteArray(rsp.data.bytes, rsp.data.size);
+    return _read(characteristic_uuid, characteristic.handle_value);
 }
 
 void PeripheralDongl::write_request(BluetoothUUID const& service_uuid, BluetoothUUID const& characteristic_uuid,
@@ -156,12 +156,7 @@ void PeripheralDongl::write_request(BluetoothUUID const& service_uuid, Bluetooth
         throw Exception::OperationFailed(fmt::format("Characteristic {} is not writable", characteristic_uuid));
     }
 
-    simpleble_WriteRsp rsp = _serial_protocol->simpleble_write(_conn_handle, characteristic.handle_value,
-                                                               simpleble_WriteOperation_WRITE_REQ, data);
-    if (rsp.ret_code != 0) {
-        throw Exception::OperationFailed(
-            fmt::format("Failed to write characteristic {} - ret_code: {}", characteristic_uuid, rsp.ret_code));
-    }
+    _write(characteristic_uuid, characteristic.handle_value, simpleble_WriteOperation_WRITE_REQ, data);
 }
 
 void PeripheralDongl::write_command(BluetoothUUID const& service_uuid, BluetoothUUID const& characteristic_uuid,
@@ -172,14 +167,147 @@ void PeripheralDongl::write_command(BluetoothUUID const& service_uuid, Bluetooth
         throw Exception::OperationFailed(fmt::format("Characteristic {} is not writable", characteristic_uuid));
     }
 
-    simpleble_WriteRsp rsp = _serial_protocol->simpleble_write(_conn_handle, characteristic.handle_value,
-                                                               simpleble_WriteOperation_WRITE_CMD, data);
+    _write(characteristic_uuid, characteristic.handle_value, simpleble_WriteOperation_WRITE_CMD, data);
+}
+
+std::shared_ptr<CharacteristicHandleBase> PeripheralDongl::resolve(BluetoothUUID const& service_uuid,
+                                                                   BluetoothUUID const& characteristic_uuid) {
+    auto handle = std::make_shared<BoundCharacteristic>(
+        this, service_uuid, characteristic_uuid, _find_characteristic_from_uuid(service_uuid, characteristic_uuid));
+    _handles.add(handle);
+    return handle;
+}
+
+ByteArray PeripheralDongl::read(CharacteristicHandleBase& handle) {
+    BoundCharacteristic* bound = _get_bound(handle);
+    if (!bound) return PeripheralBase::read(handle);
+
+    if (!bound->definition.can_read) {
+        throw Exception::OperationFailed(fmt::format("Characteristic {} is not readable", handle.characteristic()));
+    }
+    return _read(handle.characteristic(), bound->definition.handle_value);
+}
+
+void PeripheralDongl::write_request(CharacteristicHandleBase& handle, ByteArray const& data) {
+    BoundCharacteristic* bound = _get_bound(handle);
+    if (!bound) return PeripheralBase::write_request(handle, data);
+
+    if (!bound->definition.can_write_request) {
+        throw Exception::OperationFailed(fmt::format("Characteristic {} is not writable", handle.characteristic()));
+    }
+    _write(handle.characteristic(), bound->definition.handle_value, simpleble_WriteOperation_WRITE_REQ, data);
+}
+
+void PeripheralDongl::write_command(CharacteristicHandleBase& handle, ByteArray const& data) {
+    BoundCharacteristic* bound = _get_bound(handle);
+    if (!bound) return PeripheralBase::write_command(handle, data);
+
+    if (!bound->definition.can_write_command) {
+        throw Exception::OperationFailed(fmt::format("Characteristic {} is not writable", handle.characteristic()));
+    }
+    _write(handle.characteristic(), bound->definition.handle_value, simpleble_WriteOperation_WRITE_CMD, data);
+}
+
+PeripheralDongl::BoundCharacteristic* PeripheralDongl::_get_bound(CharacteristicHandleBase& handle) {
+    if (handle.owner() != this) return nullptr;
+    return dynamic_cast<BoundCharacteristic*>(&handle);
+}
+
+ByteArray PeripheralDongl::_read(BluetoothUUID const& characteristic_uuid, uint16_t handle) {
+    simpleble_ReadRsp rsp = _serial_protocol->simpleble_read(_conn_handle, handle);
+    if (rsp.ret_code != 0) {
+        throw Exception::OperationFailed(
+            fmt::format("Failed to read characteristic {} - ret_code: {}", characteristic_uuid, rsp.ret_code));
+    }
+
+    return ByteArray(rsp.data.bytes, rsp.data.size);
+}
+
+void PeripheralDongl::_write(BluetoothUUID const& characteristic_uuid, uint16_t handle,
+                             simpleble_WriteOperation operation, ByteArray const& data) {
+    simpleble_WriteRsp rsp = _serial_protocol->simpleble_write(_conn_handle, handle, operation, data);
     if (rsp.ret_code != 0) {
         throw Exception::OperationFailed(
             fmt::format("Failed to write characteristic {} - ret_code: {}", characteristic_uuid, rsp.ret_code));
     }
 }
 
+void PeripheralDongl::read_async(BluetoothUUID const& service_uuid, BluetoothUUID const& characteristic_uuid,
+                                 ReadCallback callback) {
+    uint16_t handle;
+    try {
+        auto& characteristic = _find_characteristic_from_uuid(service_uuid, characteristic_uuid);
+        if (!characteristic.can_read) {
+            throw Exception::OperationFailed(fmt::format("Characteristic {} is not readable", characteristic_uuid));
+        }
+        handle = characteristic.handle_value;
+    } catch (...) {
+        ThreadPool::shared().post(this, [callback, error = std::current_exception()]() { callback({}, error); });
+        return;
+    }
+
+    // Responses are received on the wire thread, which has to keep going for the dongle to be of any use.
+    _serial_protocol->simpleble_read_async(
+        _conn_handle, handle,
+        [this, characteristic_uuid, callback](const simpleble_ReadRsp& rsp, std::exception_ptr error) {
+            ByteArray value;
+            if (!error && rsp.ret_code != 0) {
+                error = std::make_exception_ptr(Exception::OperationFailed(
+                    fmt::format("Failed to read characteristic {} - ret_code: {}", characteristic_uuid, rsp.ret_code)));
+            } else if (!error) {
+                value = ByteArray(rsp.data.bytes, rsp.data.size);
+            }
+            ThreadPool::shared().post(this, [callback, value, error]() { callback(value, error); });
+        });
+}
+
+void PeripheralDongl::write_request_async(BluetoothUUID const& service_uuid, BluetoothUUID const& characteristic_uuid,
+                                          ByteArray const& data, WriteCallback callback) {
+    uint16_t handle;
+    try {
+        auto& characteristic = _find_characteristic_from_uuid(service_uuid, characteristic_uuid);
+        if (!characteristic.can_write_request) {
+            throw Exception::OperationFailed(fmt::format("Characteristic {} is not writable", characteristic_uuid));
+        }
+        handle = characteristic.handle_value;
+    } catch (...) {
+        ThreadPool::shared().post(this, [callback, error = std::current_exception()]() { callback(error); });
+        return;
+    }
+
+    _write_async(characteristic_uuid, handle, simpleble_WriteOperation_WRITE_REQ, data, std::move(callback));
+}
+
+void PeripheralDongl::write_command_async(BluetoothUUID const& service_uuid, BluetoothUUID const& characteristic_uuid,
+                                          ByteArray const& data, WriteCallback callback) {
+    uint16_t handle;
+    try {
+        auto& characteristic = _find_characteristic_from_uuid(service_uuid, characteristic_uuid);
+        if (!characteristic.can_write_command) {
+            throw Exception::OperationFailed(fmt::format("Characteristic {} is not writable", characteristic_uuid));
+        }
+        handle = characteristic.handle_value;
+    } catch (...) {
+        ThreadPool::shared().post(this, [callback, error = std::current_exception()]() { callback(error); });
+        return;
+    }
+
+    _write_async(characteristic_uuid, handle, simpleble_WriteOperation_WRITE_CMD, data, std::move(callback));
+}
+
+void PeripheralDongl::_write_async(BluetoothUUID const& characteristic_uuid, uint16_t handle,
+                                   simpleble_WriteOperation operation, ByteArray const& data, WriteCallback callback) {
+    _serial_protocol->simpleble_write_async(
+        _conn_handle, handle, operation, data,
+        [this, characteristic_uuid, callback](const simpleble_WriteRsp& rsp, std::exception_ptr error) {
+            if (!error && rsp.ret_code != 0) {
+                error = std::make_exception_ptr(Exception::OperationFailed(
+                    fmt::format("Failed to write characteristic {} - ret_code: {}", characteristic_uuid, rsp.ret_code)));
+            }
+            ThreadPool::shared().post(this, [callback, error]() { callback(error); });
+        });
+}
+
 void PeripheralDongl::notify(BluetoothUUID const& service_uuid, BluetoothUUID const& characteristic_uuid,
                              std::function<void(ByteArray payload)> callback) {
     auto& characteristic = _find_characteristic_from_uuid(service_uuid, characteristic_uuid);
@@ -297,7 +425,7 @@ bool PeripheralDongl::_attempt_connect() {
     _conn_handle = BLE_CONN_HANDLE_INVALID;
 
     auto response = _serial_protocol->simpleble_connect(static_cast<simpleble_BluetoothAddressType>(_address_type),
-                                                        _address);
+                                                        _address.str());
     if (response.ret_code != 0) {
         throw Exception::OperationFailed(fmt::format("Error when attempting to connect: {}", response.ret_code));
     }
@@ -336,7 +464,7 @@ bool PeripheralDongl::_attempt_connect() {
     // Retrieve any missing 128-bit UUIDs.
     for (auto& service : _services) {
         // Fetch the service UUID if missing.
-        if (service.uuid.empty()) {
+        if (service.uuid.is_nil()) {
             simpleble_ReadRsp rsp = _serial_protocol->simpleble_read(_conn_handle, service.start_handle);
             if (rsp.ret_code != 0) {
                 SIMPLEBLE_LOG_ERROR(fmt::format("Failed to read UUID for service {} - ret_code: {}", service.start_handle, rsp.ret_code));
@@ -359,7 +487,7 @@ bool PeripheralDongl::_attempt_connect() {
 
         for (auto& characteristic : service.characteristics) {
             // Fetch the characteristic UUID if missing.
-            if (characteristic.uuid.empty()) {
+            if (characteristic.uuid.is_nil()) {
                 simpleble_ReadRsp rsp = _serial_protocol->simpleble_read(_conn_handle, characteristic.handle_decl);
                 if (rsp.ret_code != 0) {
                     SIMPLEBLE_LOG_ERROR(fmt::format("Failed to read UUID for characteristic {} - ret_code: {}", characteristic.handle_decl,
@@ -389,6 +517,7 @@ void PeripheralDongl::notify_connected(uint16_t conn_handle) {
 
 void PeripheralDongl::notify_disconnected() {
     _conn_handle = BLE_CONN_HANDLE_INVALID;
+    _handles.invalidate();
     disconnection_cv_.notify_all();
     attributes_discovered_cv_.notify_all();
 
@@ -397,6 +526,9 @@ void PeripheralDongl::notify_disconnected() {
 }
 
 void PeripheralDongl::notify_service_discovered(simpleble_ServiceDiscoveredEvt const& evt) {
+    // Attribute handles may have moved with the new discovery.
+    _handles.invalidate();
+
     BluetoothUUID uuid;
     if (evt.has_uuid16) {
         uuid = _uuid_from_uuid16(evt.uuid16.uuid);
@@ -467,55 +599,20 @@ void PeripheralDongl::notify_value_changed(simpleble_ValueChangedEvt const& evt)
     }
 }
 
-BluetoothUUID PeripheralDongl::_uuid_from_uuid16(uint16_t uuid16) {
-    return BluetoothUUID(fmt::format("0000{:04X}-0000-1000-8000-00805F9B34FB", uuid16));
-}
-
-BluetoothUUID PeripheralDongl::_uuid_from_uuid32(uint32_t uuid32) {
-    return BluetoothUUID(fmt::format("{:08X}-0000-1000-8000-00805F9B34FB", uuid32));
-}
-
-BluetoothUUID PeripheralDongl::_uuid_from_uuid128(const uint8_t id[16]) {
-    std::string uuid_str;
-    uuid_str.reserve(36);  // Pre-allocate memory for the UUID string
+BluetoothUUID PeripheralDongl::_uuid_from_uuid16(uint16_t uuid16) { return BluetoothUUID::from_uuid16(uuid16); }
 
-    uuid_str += fmt::format("{:02X}{:02X}{:02X}{:02X}", id[0], id[1], id[2], id[3]);
-    uuid_str += "-";
-    uuid_str += fmt::format("{:02X}{:02X}", id[4], id[5]);
-    uuid_str += "-";
-    uuid_str += fmt::format("{:02X}{:02X}", id[6], id[7]);
-    uuid_str += "-";
-    uuid_str += fmt::format("{:02X}{:02X}", id[8], id[9]);
-    uuid_str += "-";
-    uuid_str += fmt::format("{:02X}{:02X}{:02X}{:02X}{:02X}{:02X}", id[10], id[11], id[12], id[13], id[14], id[15]);
+BluetoothUUID PeripheralDongl::_uuid_from_uuid32(uint32_t uuid32) { return BluetoothUUID::from_uuid32(uuid32); }
 
-    return BluetoothUUID(uuid_str);
-}
+BluetoothUUID PeripheralDongl::_uuid_from_uuid128(const uint8_t id[16]) { return BluetoothUUID::from_bytes(id); }
 
 BluetoothUUID PeripheralDongl::_uuid_from_proto(simpleble_UUID const& uuid) {
     switch (uuid.which_uuid) {
         case simpleble_UUID_uuid16_tag:
-            return BluetoothUUID(fmt::format("0000{:04X}-0000-1000-8000-00805F9B34FB", uuid.uuid.uuid16.uuid));
+            return _uuid_from_uuid16(uuid.uuid.uuid16.uuid);
         case simpleble_UUID_uuid32_tag:
-            return BluetoothUUID(fmt::format("{:08X}-0000-1000-8000-00805F9B34FB", uuid.uuid.uuid32.uuid));
-        case simpleble_UUID_uuid128_tag: {
-            const auto& bytes = uuid.uuid.uuid128.uuid;
-            std::string uuid_str;
-            uuid_str.reserve(36);  // Pre-allocate memory for the UUID string
-
-            uuid_str += fmt::format("{:02X}{:02X}{:02X}{:02X}", bytes[0], bytes[1], bytes[2], bytes[3]);
-            uuid_str += "-";
-            uuid_str += fmt::format("{:02X}{:02X}", bytes[4], bytes[5]);
-            uuid_str += "-";
-            uuid_str += fmt::format("{:02X}{:02X}", bytes[6], bytes[7]);
-            uuid_str += "-";
-            uuid_str += fmt::format("{:02X}{:02X}", bytes[8], bytes[9]);
-            uuid_str += "-";
-            uuid_str += fmt::format("{:02X}{:02X}{:02X}{:02X}{:02X}{:02X}", bytes[10], bytes[11], bytes[12], bytes[13],
-                                    bytes[14], bytes[15]);
-
-            return BluetoothUUID(uuid_str);
-        }
+            return _uuid_from_uuid32(uuid.uuid.uuid32.uuid);
+        case simpleble_UUID_uuid128_tag:
+            return _uuid_from_uuid128(uuid.uuid.uuid128.uuid);
     }
 
     // Should not be reached
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <simpleble/Exceptions.h>
+#include <simpleble/MacAddress.h>
 #include <simpleble/Service.h>
 #include <simpleble/Types.h>
+#include "CharacteristicHandleBase.h"
 #include "PeripheralBase.h"
 
 #include <TaskRunner.hpp>
@@ -30,6 +32,8 @@ class PeripheralDongl : public PeripheralBase {
     virtual std::string identifier() override;
     virtual BluetoothAddress address() override;
     virtual BluetoothAddressType address_type() override;
+    virtual ScanKey scan_key() override;
+    MacAddress mac_address() const;
     virtual int16_t rssi() override;
     virtual int16_t tx_power() override;
     virtual uint16_t mtu() override;
@@ -50,6 +54,15 @@ class PeripheralDongl : public PeripheralBase {
     virtual ByteArray read(BluetoothUUID const& service, BluetoothUUID const& characteristic) override;
     virtual void write_request(BluetoothUUID const& service, BluetoothUUID const& characteristic, ByteArray const& data) override;
     virtual void write_command(BluetoothUUID const& service, BluetoothUUID const& characteristic, ByteArray const& data) override;
+
+    virtual std::shared_ptr<CharacteristicHandleBase> resolve(BluetoothUUID const& service, BluetoothUUID const& characteristic) override;
+    virtual ByteArray read(CharacteristicHandleBase& handle) override;
+    virtual void write_request(CharacteristicHandleBase& handle, ByteArray const& data) override;
+    virtual void write_command(CharacteristicHandleBase& handle, ByteArray const& data) override;
+
+    virtual void read_async(BluetoothUUID const& service, BluetoothUUID const& characteristic, ReadCallback callback) override;
+    virtual void write_request_async(BluetoothUUID const& service, BluetoothUUID const& characteristic, ByteArray const& data, WriteCallback callback) override;
+    virtual void write_command_async(BluetoothUUID const& service, BluetoothUUID const& characteristic, ByteArray const& data, WriteCallback callback) override;
     virtual void notify(BluetoothUUID const& service, BluetoothUUID const& characteristic, std::function<void(ByteArray payload)> callback) override;
     virtual void indicate(BluetoothUUID const& service, BluetoothUUID const& characteristic, std::function<void(ByteArray payload)> callback) override;
     virtual void unsubscribe(BluetoothUUID const& service, BluetoothUUID const& characteristic) override;
@@ -103,6 +116,16 @@ class PeripheralDongl : public PeripheralBase {
         std::vector<CharacteristicDefinition> characteristics;
     };
 
+    // Handle bound to the attribute handle of the value, which is only meaningful for the current connection.
+    class BoundCharacteristic : public CharacteristicHandleBase {
+      public:
+        BoundCharacteristic(const PeripheralDongl* owner, BluetoothUUID const& service,
+                            BluetoothUUID const& characteristic, CharacteristicDefinition const& definition)
+            : CharacteristicHandleBase(owner, service, characteristic), definition(definition) {}
+
+        const CharacteristicDefinition definition;
+    };
+
     bool _attempt_connect();
     BluetoothUUID _uuid_from_uuid16(uint16_t uuid16);
     BluetoothUUID _uuid_from_uuid32(uint32_t uuid32);
@@ -114,9 +137,16 @@ class PeripheralDongl : public PeripheralBase {
     CharacteristicDefinition& _find_characteristic_from_uuid(BluetoothUUID const& service,
                                                              BluetoothUUID const& characteristic);
 
+    BoundCharacteristic* _get_bound(CharacteristicHandleBase& handle);
+    ByteArray _read(BluetoothUUID const& characteristic_uuid, uint16_t handle);
+    void _write(BluetoothUUID const& characteristic_uuid, uint16_t handle, simpleble_WriteOperation operation,
+                ByteArray const& data);
+    void _write_async(BluetoothUUID const& characteristic_uuid, uint16_t handle, simpleble_WriteOperation operation,
+                      ByteArray const& data, WriteCallback callback);
+
     uint16_t _conn_handle = BLE_CONN_HANDLE_INVALID;
     std::string _identifier;
-    BluetoothAddress _address;
+    MacAddress _address;
     BluetoothAddressType _address_type;
     int16_t _rssi;
     int16_t _tx_power;
@@ -137,6 +167,8 @@ class PeripheralDongl : public PeripheralBase {
 
     kvn::safe_callback<void()> _callback_on_connected;
     kvn::safe_callback<void()> _callback_on_disconnected;
+
+    CharacteristicHandleSet _handles;
     kvn::safe_map<uint16_t, std::function<void(ByteArray payload)>> _callbacks_on_value_changed;
 };
 
@@ -101,7 +101,7 @@ simpleble_DisconnectRsp Protocol::simpleble_disconnect(uint16_t conn_handle) {
     return response.rsp.simpleble.rsp.disconnect;
 }
 
-simpleble_ReadRsp Protocol::simpleble_read(uint16_t conn_handle, uint16_t handle) {
+static dongl_Command make_read_command(uint16_t conn_handle, uint16_t handle) {
     dongl_Command command = dongl_Command_init_zero;
     command.which_cmd = dongl_Command_simpleble_tag;
     command.cmd.simpleble.which_cmd = simpleble_Command_read_tag;
@@ -109,6 +109,11 @@ simpleble_ReadRsp Protocol::simpleble_read(uint16_t conn_handle, uint16_t handle
     command.cmd.simpleble.cmd.read = read_cmd;
     command.cmd.simpleble.cmd.read.conn_handle = conn_handle;
     command.cmd.simpleble.cmd.read.handle = handle;
+    return command;
+}
+
+simpleble_ReadRsp Protocol::simpleble_read(uint16_t conn_handle, uint16_t handle) {
+    dongl_Command command = make_read_command(conn_handle, handle);
 
     fmt::print("simpleble_read: conn_handle: {}, handle: {}\n", conn_handle, handle);
     dongl_Response response = exchange(command);
@@ -116,7 +121,8 @@ simpleble_ReadRsp Protocol::simpleble_read(uint16_t conn_handle, uint16_t handle
     return response.rsp.simpleble.rsp.read;
 }
 
-simpleble_WriteRsp Protocol::simpleble_write(uint16_t conn_handle, uint16_t handle, simpleble_WriteOperation operation, const std::vector<uint8_t>& data) {
+static dongl_Command make_write_command(uint16_t conn_handle, uint16_t handle, simpleble_WriteOperation operation,
+                                        const std::vector<uint8_t>& data) {
     dongl_Command command = dongl_Command_init_zero;
     command.which_cmd = dongl_Command_simpleble_tag;
     command.cmd.simpleble.which_cmd = simpleble_Command_write_tag;
@@ -127,7 +133,27 @@ simpleble_WriteRsp Protocol::simpleble_write(uint16_t conn_handle, uint16_t hand
     command.cmd.simpleble.cmd.write.op = operation;
     command.cmd.simpleble.cmd.write.data.size = data.size();
     memcpy(command.cmd.simpleble.cmd.write.data.bytes, data.data(), data.size());
+    return command;
+}
 
-    dongl_Response response = exchange(command);
+simpleble_WriteRsp Protocol::simpleble_write(uint16_t conn_handle, uint16_t handle, simpleble_WriteOperation operation, const std::vector<uint8_t>& data) {
+    dongl_Response response = exchange(make_write_command(conn_handle, handle, operation, data));
     return response.rsp.simpleble.rsp.write;
+}
+
+void Protocol::simpleble_read_async(uint16_t conn_handle, uint16_t handle,
+                                    std::function<void(const simpleble_ReadRsp&, std::exception_ptr)> callback) {
+    exchange_async(make_read_command(conn_handle, handle),
+                   [callback](const dongl_Response& response, std::exception_ptr error) {
+                       callback(response.rsp.simpleble.rsp.read, error);
+                   });
+}
+
+void Protocol::simpleble_write_async(uint16_t conn_handle, uint16_t handle, simpleble_WriteOperation operation,
+                                     const std::vector<uint8_t>& data,
+                                     std::function<void(const simpleble_WriteRsp&, std::exception_ptr)> callback) {
+    exchange_async(make_write_command(conn_handle, handle, operation, data),
+                   [callback](const dongl_Response& response, std::exception_ptr error) {
+                       callback(response.rsp.simpleble.rsp.write, error);
+                   });
 }
\ No newline at end of file
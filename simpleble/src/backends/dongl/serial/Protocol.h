@@ -35,6 +35,9 @@ class Protocol : public ProtocolBase {
     simpleble_DisconnectRsp simpleble_disconnect(uint16_t conn_handle);
     simpleble_ReadRsp simpleble_read(uint16_t conn_handle, uint16_t handle);
     simpleble_WriteRsp simpleble_write(uint16_t conn_handle, uint16_t handle, simpleble_WriteOperation operation, const std::vector<uint8_t>& data);
+
+    void simpleble_read_async(uint16_t conn_handle, uint16_t handle, std::function<void(const simpleble_ReadRsp&, std::exception_ptr)> callback);
+    void simpleble_write_async(uint16_t conn_handle, uint16_t handle, simpleble_WriteOperation operation, const std::vector<uint8_t>& data, std::function<void(const simpleble_WriteRsp&, std::exception_ptr)> callback);
 };
 
 }  // namespace Serial
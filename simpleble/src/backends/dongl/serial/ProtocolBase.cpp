@@ -1,4 +1,5 @@
 #include "ProtocolBase.h"
+#include "LoggingInternal.h"
 
 using namespace SimpleBLE::Dongl::Serial;
 
@@ -7,6 +8,9 @@ using namespace SimpleBLE::Dongl::Serial;
 
 #include <fmt/core.h>
 
+#include <future>
+#include <stdexcept>
+
 ProtocolBase::ProtocolBase(const std::string& device_path) : _wire(std::make_unique<Wire>(device_path)) {
     // Set up the Wire packet callback to handle incoming packets
     _wire->set_packet_callback([this](const std::vector<uint8_t>& packet) {
@@ -18,15 +22,26 @@ ProtocolBase::ProtocolBase(const std::string& device_path) : _wire(std::make_uni
             return;
         }
 
+        _receive_thread = std::this_thread::get_id();
+
         if (d2h.which_type == dongl_D2H_rsp_tag) {
-            // First, try to fulfill any pending sync request
+            std::vector<Completion> completions;
             {
-                std::lock_guard<std::mutex> lock(_pending_mutex);
-                if (!_pending_response.has_value()) {
-                    _pending_response = d2h.type.rsp;
-                    _response_cv.notify_one();
+                std::lock_guard<std::mutex> lock(_requests_mutex);
+                // A response nobody is waiting for, or one of another kind, belongs to a command that already
+                // timed out. Handing it to the front request would shift every following response by one.
+                if (_requests.empty() || !_response_matches(_requests.front().command, d2h.type.rsp)) {
+                    SIMPLEBLE_LOG_WARN("Dropping response without a matching command");
+                    return;
                 }
+
+                ResponseCallback callback = std::move(_requests.front().callback);
+                _requests.pop_front();
+                dongl_Response response = d2h.type.rsp;
+                completions.push_back([callback, response]() { callback(response, nullptr); });
+                _send_front(completions);
             }
+            for (auto& completion : completions) completion();
 
         } else if (d2h.which_type == dongl_D2H_evt_tag) {
             if (_event_callback) {
@@ -38,58 +53,131 @@ ProtocolBase::ProtocolBase(const std::string& device_path) : _wire(std::make_uni
     _wire->set_error_callback([this](const Wire::Error& error) {
         fmt::print("Error: {}\n", (int)error);
     });
-}
 
-ProtocolBase::~ProtocolBase() {}
+    _watchdog = std::thread(&ProtocolBase::_watchdog_run, this);
+}
 
-dongl_Response ProtocolBase::exchange(const dongl_Command& command) {
-    // Check if there's already a pending sync operation
+ProtocolBase::~ProtocolBase() {
     {
-        std::lock_guard<std::mutex> lock(_pending_mutex);
-        if (_pending_response.has_value()) {
-            throw std::runtime_error("Another sync command is already pending");
-        }
+        std::lock_guard<std::mutex> lock(_requests_mutex);
+        _stopping = true;
     }
+    _requests_cv.notify_all();
+    _watchdog.join();
+}
 
-    // Clear any previous response and send the command
-    {
-        std::unique_lock<std::mutex> lock(_pending_mutex);
-        _pending_response.reset();  // Ensure it's empty to indicate we're waiting
+dongl_Response ProtocolBase::exchange(const dongl_Command& command) {
+    // Responses are delivered by the receiving thread and timeouts by the watchdog, so neither of them may wait.
+    std::thread::id caller = std::this_thread::get_id();
+    if (caller == _receive_thread.load() || caller == _watchdog.get_id()) {
+        throw std::runtime_error("Synchronous exchange from a response or event callback");
     }
 
-    try {
-        size_t command_size = 0;
-        pb_get_encoded_size(&command_size, dongl_Command_fields, &command);
+    auto promise = std::make_shared<std::promise<dongl_Response>>();
+    std::future<dongl_Response> future = promise->get_future();
 
-        std::vector<uint8_t> tx_buffer_raw(command_size);
-        pb_ostream_t stream = pb_ostream_from_buffer(tx_buffer_raw.data(), tx_buffer_raw.size());
-        bool status = pb_encode(&stream, dongl_Command_fields, &command);
-        if (!status) {
-            // TODO: Handle encoding failure
-            throw std::runtime_error("Failed to encode command");
+    exchange_async(command, [promise](const dongl_Response& response, std::exception_ptr error) {
+        if (error) {
+            promise->set_exception(error);
+        } else {
+            promise->set_value(response);
         }
+    });
+
+    return future.get();
+}
 
-        _wire->send_packet(tx_buffer_raw);
-    } catch (const std::runtime_error& e) {
-        // If sending fails, no cleanup needed since we didn't set pending_response
-        throw;
+void ProtocolBase::exchange_async(const dongl_Command& command, ResponseCallback callback) {
+    size_t command_size = 0;
+    pb_get_encoded_size(&command_size, dongl_Command_fields, &command);
+
+    std::vector<uint8_t> tx_buffer_raw(command_size);
+    pb_ostream_t stream = pb_ostream_from_buffer(tx_buffer_raw.data(), tx_buffer_raw.size());
+    bool status = pb_encode(&stream, dongl_Command_fields, &command);
+    if (!status) {
+        callback(dongl_Response{}, std::make_exception_ptr(std::runtime_error("Failed to encode command")));
+        return;
     }
 
-    // Wait for the response with 1 second timeout
+    std::vector<Completion> completions;
     {
-        std::unique_lock<std::mutex> lock(_pending_mutex);
-        if (_response_cv.wait_for(lock, std::chrono::seconds(1), [this]() { return _pending_response.has_value(); })) {
-            dongl_Response response = *_pending_response;
-            _pending_response.reset();
-            return response;
-        } else {
-            // Timeout occurred, reset pending state
-            _pending_response.reset();
-            throw std::runtime_error("Timeout waiting for response");
+        std::lock_guard<std::mutex> lock(_requests_mutex);
+        _requests.push_back(Request{command, std::move(tx_buffer_raw), std::move(callback)});
+        if (_requests.size() == 1) {
+            _send_front(completions);
         }
     }
+    for (auto& completion : completions) completion();
 }
 
 void ProtocolBase::set_event_callback(std::function<void(const dongl_Event&)> callback) {
     _event_callback = std::move(callback);
 }
+
+void ProtocolBase::_watchdog_run() {
+    std::unique_lock<std::mutex> lock(_requests_mutex);
+    while (!_stopping) {
+        if (_requests.empty()) {
+            _requests_cv.wait(lock);
+            continue;
+        }
+
+        if (std::chrono::steady_clock::now() < _deadline) {
+            _requests_cv.wait_until(lock, _deadline);
+            continue;
+        }
+
+        std::vector<Completion> completions;
+        ResponseCallback callback = std::move(_requests.front().callback);
+        _requests.pop_front();
+        completions.push_back([callback]() {
+            callback(dongl_Response{}, std::make_exception_ptr(std::runtime_error("Timeout waiting for response")));
+        });
+        _send_front(completions);
+
+        lock.unlock();
+        for (auto& completion : completions) completion();
+        lock.lock();
+    }
+}
+
+bool ProtocolBase::_response_matches(const dongl_Command& command, const dongl_Response& response) {
+    // Every command has a response with the same tag, at both levels of the union.
+    if (command.which_cmd != response.which_rsp) return false;
+
+    if (command.which_cmd == dongl_Command_basic_tag) {
+        return command.cmd.basic.which_cmd == response.rsp.basic.which_rsp;
+    }
+
+    const simpleble_Command& cmd = command.cmd.simpleble;
+    const simpleble_Response& rsp = response.rsp.simpleble;
+    if (cmd.which_cmd != rsp.which_rsp) return false;
+
+    // Only reads and writes echo where they came from, and only down to the connection.
+    switch (cmd.which_cmd) {
+        case simpleble_Command_read_tag:
+            return cmd.cmd.read.conn_handle == rsp.rsp.read.conn_handle;
+        case simpleble_Command_write_tag:
+            return cmd.cmd.write.conn_handle == rsp.rsp.write.conn_handle;
+        default:
+            return true;
+    }
+}
+
+// Must be called with the requests mutex held. Callbacks are collected instead of called, so that they run
+// once the mutex has been released.
+void ProtocolBase::_send_front(std::vector<Completion>& completions) {
+    while (!_requests.empty()) {
+        try {
+            _wire->send_packet(_requests.front().packet);
+            _deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+            _requests_cv.notify_all();
+            return;
+        } catch (const std::exception&) {
+            ResponseCallback callback = std::move(_requests.front().callback);
+            _requests.pop_front();
+            completions.push_back(
+                [callback, error = std::current_exception()]() { callback(dongl_Response{}, error); });
+        }
+    }
+}
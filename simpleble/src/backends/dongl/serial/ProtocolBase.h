@@ -1,5 +1,8 @@
 #pragma once
 
+#include <atomic>
+#include <deque>
+#include <exception>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -8,6 +11,7 @@
 #include <chrono>
 #include <condition_variable>
 #include <mutex>
+#include <thread>
 
 #include "Wire.h"
 
@@ -20,19 +24,33 @@ namespace Serial {
 
 class ProtocolBase {
   public:
+    using ResponseCallback = std::function<void(const dongl_Response& response, std::exception_ptr error)>;
+
     ProtocolBase(const std::string& device_path);
     ~ProtocolBase();
 
     /**
      * @brief Sends a command synchronously and waits for the response.
-     * Only one exchange can be pending at a time.
      *
      * @param command The command to send.
      * @return The response when it arrives.
-     * @throws std::runtime_error if another exchange is already pending or if timeout occurs.
+     * @throws std::runtime_error if the command cannot be sent, if timeout occurs, or if called from a response
+     *                            or event callback, as those run on the threads that complete the exchange.
      */
     dongl_Response exchange(const dongl_Command& command);
 
+    /**
+     * @brief Queues a command and returns immediately.
+     * Responses carry no identifier, so they are matched to commands by order, after checking that they are of
+     * the same kind and, for reads and writes, for the same connection. Queued commands are written
+     * back to back as soon as the previous response arrives, without waiting for the caller.
+     *
+     * @param command The command to send.
+     * @param callback Called from the receiving thread with the response, or with the error if the command
+     *                 could not be sent or timed out.
+     */
+    void exchange_async(const dongl_Command& command, ResponseCallback callback);
+
     /**
      * @brief Sets the callback for received events.
      *
@@ -44,9 +62,26 @@ class ProtocolBase {
     std::unique_ptr<Wire> _wire;
     std::function<void(const dongl_Event&)> _event_callback;
 
-    std::optional<dongl_Response> _pending_response;
-    std::condition_variable _response_cv;
-    std::mutex _pending_mutex;
+    struct Request {
+        dongl_Command command;
+        std::vector<uint8_t> packet;
+        ResponseCallback callback;
+    };
+
+    using Completion = std::function<void()>;
+
+    // The front request is the one the dongle is working on.
+    std::deque<Request> _requests;
+    std::chrono::steady_clock::time_point _deadline;
+    std::condition_variable _requests_cv;
+    std::mutex _requests_mutex;
+    bool _stopping = false;
+    std::thread _watchdog;
+    std::atomic<std::thread::id> _receive_thread;
+
+    void _watchdog_run();
+    void _send_front(std::vector<Completion>& completions);
+    static bool _response_matches(const dongl_Command& command, const dongl_Response& response);
 };
 
 }  // namespace Serial
@@ -6,6 +6,7 @@
 #include "BuildVec.h"
 #include "BuilderBase.h"
 #include "CommonUtils.h"
+#include "LoggingInternal.h"
 #include "PeripheralLinux.h"
 
 using namespace SimpleBLE;
@@ -36,34 +37,81 @@ void AdapterLinux::scan_start() {
             return;
         }
 
-        if (this->peripherals_.count(device->address()) == 0) {
+        // Devices are matched by their proxy, so that the address is only parsed the first time one is heard from.
+        auto it = this->peripherals_.find(device.get());
+        if (it == this->peripherals_.end()) {
+            if (!MacAddress::try_parse(device->address())) {
+                SIMPLEBLE_LOG_WARN(fmt::format("Ignoring device with invalid address {}", device->address()));
+                return;
+            }
+
             // If the incoming peripheral has never been seen before, create and save a reference to it.
             auto base_peripheral = std::make_shared<PeripheralLinux>(device, this->adapter_);
-            this->peripherals_.insert(std::make_pair(device->address(), base_peripheral));
+            it = this->peripherals_.insert(std::make_pair(device.get(), base_peripheral)).first;
         }
 
         // Update the received advertising data.
-        auto peripheral = this->peripherals_.at(device->address());
+        auto peripheral = it->second;
+        MacAddress address = peripheral->mac_address();
+        this->scan_cache_touch(peripheral);
+
+        // BlueZ merges the filters of all its clients, so results still have to be checked here.
+        if (!this->scan_filter_accepts(*peripheral)) {
+            return;
+        }
+        bool duplicate = this->scan_filter_is_duplicate(*peripheral);
 
         // Check if the device has been seen before, to forward the correct call to the user.
-        if (this->seen_peripherals_.count(device->address()) == 0) {
+        if (this->seen_peripherals_.count(address) == 0) {
             // Store it in our table of seen peripherals
-            this->seen_peripherals_.insert(std::make_pair(device->address(), peripheral));
-            SAFE_CALLBACK_CALL(this->_callback_on_scan_found, Factory::build(peripheral));
-        } else {
-            SAFE_CALLBACK_CALL(this->_callback_on_scan_updated, Factory::build(peripheral));
+            this->seen_peripherals_.insert(std::make_pair(address, peripheral));
+            this->scan_found(peripheral);
+        } else if (!duplicate) {
+            this->scan_updated(peripheral);
         }
     });
 
+    // The filter must be in place before discovery starts for BlueZ to apply it.
+    discovery_filter_apply();
+
     // Start scanning and notify the user.
     adapter_->discovery_start();
 
-    // TODO: Does a discovery filter need to be set?
-
     SAFE_CALLBACK_CALL(this->_callback_on_scan_start);
     is_scanning_ = true;
 }
 
+void AdapterLinux::discovery_filter_apply() {
+    SimpleBluez::Adapter::DiscoveryFilter filter;
+    {
+        std::scoped_lock lock(_scan_filter_mutex);
+        filter.UUIDs.assign(_scan_filter.service_uuids.begin(), _scan_filter.service_uuids.end());
+        filter.RSSI = _scan_filter.rssi_threshold;
+        // BlueZ rejects a filter with both RSSI and Pathloss set, in which case pathloss is only checked locally.
+        if (!filter.RSSI) filter.Pathloss = _scan_filter.pathloss_threshold;
+        switch (_scan_filter.transport) {
+            case ScanFilter::Transport::AUTO:
+                filter.Transport = SimpleBluez::Adapter::DiscoveryFilter::TransportType::AUTO;
+                break;
+            case ScanFilter::Transport::LE:
+                filter.Transport = SimpleBluez::Adapter::DiscoveryFilter::TransportType::LE;
+                break;
+            case ScanFilter::Transport::BREDR:
+                filter.Transport = SimpleBluez::Adapter::DiscoveryFilter::TransportType::BREDR;
+                break;
+        }
+        filter.DuplicateData = _scan_filter.duplicate_data;
+        filter.Pattern = _scan_filter.pattern;
+    }
+
+    try {
+        adapter_->discovery_filter(filter);
+    } catch (const std::exception& e) {
+        // Not fatal, every result is still checked against the filter before being reported.
+        SIMPLEBLE_LOG_WARN(fmt::format("Failed to set discovery filter: {}", e.what()));
+    }
+}
+
 void AdapterLinux::scan_stop() {
     adapter_->discovery_stop();
     is_scanning_ = false;
@@ -84,6 +132,30 @@ bool AdapterLinux::scan_is_active() { return is_scanning_ && adapter_->discoveri
 
 SharedPtrVector<PeripheralBase> AdapterLinux::scan_get_results() { return Util::values(seen_peripherals_); }
 
+void AdapterLinux::scan_cache_evict(const BluetoothAddress& address, const std::shared_ptr<PeripheralBase>& peripheral) {
+    auto device = static_cast<SimpleBluez::Device*>(peripheral->underlying());
+    seen_peripherals_.erase(std::static_pointer_cast<PeripheralLinux>(peripheral)->mac_address());
+    peripherals_.erase(device);
+
+    // Removing the device from BlueZ also drops its proxy from the tree. A bonded device would lose its
+    // keys, so those are left for BlueZ to manage. Eviction runs on the thread dispatching the connection,
+    // which would stall waiting for its own reply, so the outcome is only logged once it arrives.
+    if (peripheral->is_paired()) return;
+    auto on_removed = [address](std::exception_ptr error) {
+        if (!error) return;
+        try {
+            std::rethrow_exception(error);
+        } catch (const std::exception& e) {
+            SIMPLEBLE_LOG_WARN(fmt::format("Failed to remove {} from BlueZ: {}", address, e.what()));
+        }
+    };
+    try {
+        adapter_->device_remove_async(device->path(), on_removed);
+    } catch (...) {
+        on_removed(std::current_exception());
+    }
+}
+
 SharedPtrVector<PeripheralBase> AdapterLinux::get_paired_peripherals() {
     SharedPtrVector<PeripheralBase> peripherals;
 
@@ -6,6 +6,7 @@
 #include <simplebluez/Bluez.h>
 #include <simpleble/Config.h>
 #include <simplebluez/Config.h>
+#include <simpledbus/Config.h>
 
 #include <fmt/core.h>
 #include <atomic>
@@ -39,6 +40,7 @@ BackendBluez::BackendBluez(buildToken) {
     std::scoped_lock lock(get_mutex);  // Unlock the mutex on function return
 
     SimpleBluez::Config::use_system_bus = Config::SimpleBluez::use_system_bus;
+    SimpleDBus::Config::Connection::dispatch_workers = Config::SimpleBluez::dispatch_workers;
 
     bluez.init();
     async_thread_active = true;
@@ -51,6 +53,7 @@ BackendBluez::BackendBluez(buildToken) {
 
 BackendBluez::~BackendBluez() {
     async_thread_active = false;
+    bluez.wakeup_async();
     while (!async_thread->joinable()) {
         std::this_thread::sleep_for(std::chrono::milliseconds(1));
     }
@@ -92,8 +95,7 @@ void BackendBluez::async_thread_function() {
     });
 
     while (async_thread_active) {
-        SAFE_RUN({ bluez.run_async(); });
-        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        SAFE_RUN({ bluez.run_async(std::chrono::milliseconds(500)); });
     }
 }
 
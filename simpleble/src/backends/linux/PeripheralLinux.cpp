@@ -5,6 +5,8 @@
 #include "CharacteristicBase.h"
 #include "DescriptorBase.h"
 #include "ServiceBase.h"
+#include "ThreadPool.h"
+#include "WriteStreamLinux.h"
 
 #include <simpleble/Config.h>
 #include <simpleble/Characteristic.h>
@@ -25,7 +27,7 @@ using namespace std::chrono_literals;
 
 PeripheralLinux::PeripheralLinux(std::shared_ptr<SimpleBluez::Device> device,
                                  std::shared_ptr<SimpleBluez::Adapter> adapter)
-    : device_(std::move(device)), adapter_(std::move(adapter)) {}
+    : device_(std::move(device)), adapter_(std::move(adapter)), address_(device_->address()) {}
 
 PeripheralLinux::~PeripheralLinux() {
     // Clear the callbacks to prevent any further events from being sent to the user.
@@ -41,7 +43,11 @@ void* PeripheralLinux::underlying() const { return device_.get(); }
 
 std::string PeripheralLinux::identifier() { return device_->name(); }
 
-BluetoothAddress PeripheralLinux::address() { return device_->address(); }
+BluetoothAddress PeripheralLinux::address() { return address_.str(); }
+
+ScanKey PeripheralLinux::scan_key() { return address_; }
+
+MacAddress PeripheralLinux::mac_address() const { return address_; }
 
 BluetoothAddressType PeripheralLinux::address_type() {
     std::string address_type = device_->address_type();
@@ -57,7 +63,9 @@ BluetoothAddressType PeripheralLinux::address_type() {
 
 int16_t PeripheralLinux::rssi() { return device_->rssi(); }
 
-int16_t PeripheralLinux::tx_power() { return device_->tx_power(); }
+int16_t PeripheralLinux::tx_power() { return device_->has_tx_power() ? device_->tx_power() : INT16_MIN; }
+
+bool PeripheralLinux::has_tx_power() { return device_->has_tx_power(); }
 
 uint16_t PeripheralLinux::mtu() {
     if (!is_connected()) return 0;
@@ -78,7 +86,11 @@ void PeripheralLinux::connect() {
     }
 
     device_->clear_on_disconnected();
-    device_->set_on_services_resolved([this]() { this->connection_cv_.notify_all(); });
+    device_->set_on_services_resolved([this]() {
+        // Services are resolved again after they changed, replacing the objects the handles are bound to.
+        this->handles_.invalidate();
+        this->connection_cv_.notify_all();
+    });
 
     // Attempt to connect to the device.
     for (size_t i = 0; i < 5; i++) {
@@ -167,13 +179,13 @@ SharedPtrVector<ServiceBase> PeripheralLinux::available_services() {
                 descriptor_list.push_back(std::make_shared<DescriptorBase>(bluez_descriptor->uuid()));
             }
 
-            std::vector<std::string> flags = bluez_characteristic->flags();
+            uint8_t capabilities = bluez_characteristic->capabilities();
 
-            bool can_read = std::find(flags.begin(), flags.end(), "read") != flags.end();
-            bool can_write_request = std::find(flags.begin(), flags.end(), "write") != flags.end();
-            bool can_write_command = std::find(flags.begin(), flags.end(), "write-without-response") != flags.end();
-            bool can_notify = std::find(flags.begin(), flags.end(), "notify") != flags.end();
-            bool can_indicate = std::find(flags.begin(), flags.end(), "indicate") != flags.end();
+            bool can_read = capabilities & SimpleBluez::Characteristic::CAN_READ;
+            bool can_write_request = capabilities & SimpleBluez::Characteristic::CAN_WRITE_REQUEST;
+            bool can_write_command = capabilities & SimpleBluez::Characteristic::CAN_WRITE_COMMAND;
+            bool can_notify = capabilities & SimpleBluez::Characteristic::CAN_NOTIFY;
+            bool can_indicate = capabilities & SimpleBluez::Characteristic::CAN_INDICATE;
 
             characteristic_list.push_back(
                 std::make_shared<CharacteristicBase>(bluez_characteristic->uuid(), descriptor_list, can_read,
@@ -217,36 +229,95 @@ ByteArray PeripheralLinux::read(BluetoothUUID const& service, BluetoothUUID cons
     }
 
     // Otherwise, attempt to read the characteristic using default mechanisms
-    auto char_obj = _get_characteristic(service, characteristic);
-    std::vector<std::string> flags = char_obj->flags();
-    if (std::find(flags.begin(), flags.end(), "read") == flags.end()) {
+    auto entry = _get_characteristic(service, characteristic);
+    if (!(entry.capabilities & SimpleBluez::Characteristic::CAN_READ)) {
         throw Exception::OperationNotSupported("read", characteristic);
     }
-    return char_obj->read();
+    return entry.characteristic->read();
 }
 
 void PeripheralLinux::write_request(BluetoothUUID const& service, BluetoothUUID const& characteristic,
                                     ByteArray const& data) {
     // TODO: SimpleBluez::Characteristic::write_request() should also take ByteArray by const reference (but that's
     // another library)
-    auto char_obj = _get_characteristic(service, characteristic);
-    std::vector<std::string> flags = char_obj->flags();
-    if (std::find(flags.begin(), flags.end(), "write") == flags.end()) {
+    auto entry = _get_characteristic(service, characteristic);
+    if (!(entry.capabilities & SimpleBluez::Characteristic::CAN_WRITE_REQUEST)) {
         throw Exception::OperationNotSupported("write_request", characteristic);
     }
-    char_obj->write_request(data);
+    entry.characteristic->write_request(data);
 }
 
 void PeripheralLinux::write_command(BluetoothUUID const& service, BluetoothUUID const& characteristic,
                                     ByteArray const& data) {
     // TODO: SimpleBluez::Characteristic::write_command() should also take ByteArray by const reference (but that's
     // another library)
-    auto char_obj = _get_characteristic(service, characteristic);
-    std::vector<std::string> flags = char_obj->flags();
-    if (std::find(flags.begin(), flags.end(), "write-without-response") == flags.end()) {
+    auto entry = _get_characteristic(service, characteristic);
+    if (!(entry.capabilities & SimpleBluez::Characteristic::CAN_WRITE_COMMAND)) {
         throw Exception::OperationNotSupported("write_command", characteristic);
     }
-    char_obj->write_command(data);
+    entry.characteristic->write_command(data);
+}
+
+// BlueZ replies on the thread running the D-Bus event loop, which must not be blocked by user code, so the
+// outcome of an asynchronous operation is handed over to the worker of the peripheral.
+PeripheralBase::ReadCallback PeripheralLinux::_deliver(ReadCallback callback) {
+    return [this, callback = std::move(callback)](ByteArray value, std::exception_ptr error) {
+        ThreadPool::shared().post(this, [callback, value = std::move(value), error]() { callback(value, error); });
+    };
+}
+
+PeripheralBase::WriteCallback PeripheralLinux::_deliver(WriteCallback callback) {
+    return [this, callback = std::move(callback)](std::exception_ptr error) {
+        ThreadPool::shared().post(this, [callback, error]() { callback(error); });
+    };
+}
+
+void PeripheralLinux::read_async(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                                 ReadCallback callback) {
+    if (service == BATTERY_SERVICE_UUID && characteristic == BATTERY_CHARACTERISTIC_UUID &&
+        device_->has_battery_interface()) {
+        PeripheralBase::read_async(service, characteristic, std::move(callback));
+        return;
+    }
+
+    ReadCallback deliver = _deliver(std::move(callback));
+    try {
+        auto entry = _get_characteristic(service, characteristic);
+        if (!(entry.capabilities & SimpleBluez::Characteristic::CAN_READ)) {
+            throw Exception::OperationNotSupported("read", characteristic);
+        }
+        entry.characteristic->read_async(deliver);
+    } catch (...) {
+        deliver({}, std::current_exception());
+    }
+}
+
+void PeripheralLinux::write_request_async(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                                          ByteArray const& data, WriteCallback callback) {
+    WriteCallback deliver = _deliver(std::move(callback));
+    try {
+        auto entry = _get_characteristic(service, characteristic);
+        if (!(entry.capabilities & SimpleBluez::Characteristic::CAN_WRITE_REQUEST)) {
+            throw Exception::OperationNotSupported("write_request", characteristic);
+        }
+        entry.characteristic->write_request_async(data, deliver);
+    } catch (...) {
+        deliver(std::current_exception());
+    }
+}
+
+void PeripheralLinux::write_command_async(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                                          ByteArray const& data, WriteCallback callback) {
+    WriteCallback deliver = _deliver(std::move(callback));
+    try {
+        auto entry = _get_characteristic(service, characteristic);
+        if (!(entry.capabilities & SimpleBluez::Characteristic::CAN_WRITE_COMMAND)) {
+            throw Exception::OperationNotSupported("write_command", characteristic);
+        }
+        entry.characteristic->write_command_async(data, deliver);
+    } catch (...) {
+        deliver(std::current_exception());
+    }
 }
 
 void PeripheralLinux::notify(BluetoothUUID const& service, BluetoothUUID const& characteristic,
@@ -263,13 +334,23 @@ void PeripheralLinux::notify(BluetoothUUID const& service, BluetoothUUID const&
 
     // Otherwise, attempt to read the characteristic using default mechanisms
     // TODO: What to do if the characteristic is already being notified?
-    auto characteristic_object = _get_characteristic(service, characteristic);
-    std::vector<std::string> flags = characteristic_object->flags();
-    if (std::find(flags.begin(), flags.end(), "notify") == flags.end() &&
-        std::find(flags.begin(), flags.end(), "indicate") == flags.end()) {
+    auto entry = _get_characteristic(service, characteristic);
+    if (!(entry.capabilities &
+          (SimpleBluez::Characteristic::CAN_NOTIFY | SimpleBluez::Characteristic::CAN_INDICATE))) {
         throw Exception::OperationNotSupported("notify", characteristic);
     }
+    auto characteristic_object = entry.characteristic;
     characteristic_object->set_on_value_changed([callback](SimpleBluez::ByteArray new_value) { callback(new_value); });
+
+    // Prefer the notification socket, which bypasses D-Bus entirely for every payload.
+    if (entry.capabilities & SimpleBluez::Characteristic::CAN_NOTIFY_ACQUIRE) {
+        try {
+            characteristic_object->acquire_notify();
+            return;
+        } catch (SimpleDBus::Exception::SendFailed const& e) {
+            SIMPLEBLE_LOG_WARN(fmt::format("AcquireNotify failed, falling back to StartNotify: {}", e.what()));
+        }
+    }
     characteristic_object->start_notify();
 }
 
@@ -289,7 +370,11 @@ void PeripheralLinux::unsubscribe(BluetoothUUID const& service, BluetoothUUID co
     }
 
     // TODO: What to do if the characteristic is not being notified?
-    auto characteristic_object = _get_characteristic(service, characteristic);
+    auto characteristic_object = _get_characteristic(service, characteristic).characteristic;
+    if (characteristic_object->notify_acquired()) {
+        characteristic_object->release_notify();
+        return;
+    }
     characteristic_object->stop_notify();
 
     // Wait for the characteristic to stop notifying.
@@ -310,6 +395,90 @@ void PeripheralLinux::write(BluetoothUUID const& service, BluetoothUUID const& c
     _get_descriptor(service, characteristic, descriptor)->write(data);
 }
 
+void PeripheralLinux::read_async(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                                 BluetoothUUID const& descriptor, ReadCallback callback) {
+    ReadCallback deliver = _deliver(std::move(callback));
+    try {
+        _get_descriptor(service, characteristic, descriptor)->read_async(deliver);
+    } catch (...) {
+        deliver({}, std::current_exception());
+    }
+}
+
+void PeripheralLinux::write_async(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                                  BluetoothUUID const& descriptor, ByteArray const& data, WriteCallback callback) {
+    WriteCallback deliver = _deliver(std::move(callback));
+    try {
+        _get_descriptor(service, characteristic, descriptor)->write_async(data, deliver);
+    } catch (...) {
+        deliver(std::current_exception());
+    }
+}
+
+std::shared_ptr<CharacteristicHandleBase> PeripheralLinux::resolve(BluetoothUUID const& service,
+                                                                   BluetoothUUID const& characteristic) {
+    // The emulated battery service has no BlueZ characteristic to bind to.
+    if (service == BATTERY_SERVICE_UUID && characteristic == BATTERY_CHARACTERISTIC_UUID &&
+        device_->has_battery_interface()) {
+        return PeripheralBase::resolve(service, characteristic);
+    }
+
+    auto handle = std::make_shared<BoundCharacteristic>(this, service, characteristic,
+                                                        _get_characteristic(service, characteristic));
+    handles_.add(handle);
+    return handle;
+}
+
+ByteArray PeripheralLinux::read(CharacteristicHandleBase& handle) {
+    BoundCharacteristic* bound = _get_bound(handle);
+    if (!bound) return PeripheralBase::read(handle);
+
+    if (!(bound->entry.capabilities & SimpleBluez::Characteristic::CAN_READ)) {
+        throw Exception::OperationNotSupported("read", handle.characteristic());
+    }
+    return bound->entry.characteristic->read();
+}
+
+void PeripheralLinux::write_request(CharacteristicHandleBase& handle, ByteArray const& data) {
+    BoundCharacteristic* bound = _get_bound(handle);
+    if (!bound) return PeripheralBase::write_request(handle, data);
+
+    if (!(bound->entry.capabilities & SimpleBluez::Characteristic::CAN_WRITE_REQUEST)) {
+        throw Exception::OperationNotSupported("write_request", handle.characteristic());
+    }
+    bound->entry.characteristic->write_request(data);
+}
+
+void PeripheralLinux::write_command(CharacteristicHandleBase& handle, ByteArray const& data) {
+    BoundCharacteristic* bound = _get_bound(handle);
+    if (!bound) return PeripheralBase::write_command(handle, data);
+
+    if (!(bound->entry.capabilities & SimpleBluez::Characteristic::CAN_WRITE_COMMAND)) {
+        throw Exception::OperationNotSupported("write_command", handle.characteristic());
+    }
+    bound->entry.characteristic->write_command(data);
+}
+
+std::shared_ptr<WriteStreamBase> PeripheralLinux::open_write_stream(BluetoothUUID const& service,
+                                                                    BluetoothUUID const& characteristic) {
+    auto entry = _get_characteristic(service, characteristic);
+    if (!(entry.capabilities & SimpleBluez::Characteristic::CAN_WRITE_COMMAND)) {
+        throw Exception::OperationNotSupported("write_command", characteristic);
+    }
+    if (!(entry.capabilities & SimpleBluez::Characteristic::CAN_WRITE_ACQUIRE)) {
+        return nullptr;
+    }
+
+    try {
+        auto [fd, mtu] = entry.characteristic->acquire_write();
+        return std::make_shared<WriteStreamLinux>(std::move(fd), mtu);
+    } catch (SimpleDBus::Exception::SendFailed const& e) {
+        // The frontend falls back to sending every packet through WriteValue.
+        SIMPLEBLE_LOG_WARN(fmt::format("AcquireWrite failed, falling back to WriteValue: {}", e.what()));
+        return nullptr;
+    }
+}
+
 void PeripheralLinux::set_callback_on_connected(std::function<void()> on_connected) {
     if (on_connected) {
         callback_on_connected_.load(std::move(on_connected));
@@ -328,12 +497,19 @@ void PeripheralLinux::set_callback_on_disconnected(std::function<void()> on_disc
 
 // Private methods
 
+PeripheralLinux::BoundCharacteristic* PeripheralLinux::_get_bound(CharacteristicHandleBase& handle) {
+    if (handle.owner() != this) return nullptr;
+    return dynamic_cast<BoundCharacteristic*>(&handle);
+}
+
 void PeripheralLinux::_cleanup_characteristics() noexcept {
     // As this method can be called in multiple stages of a disconnection or object
     // destruction, the entire execution of this method is wrapped in a try-catch
     // block to prevent any exceptions from being thrown, as these will most certainly
     // crash the user application.
     try {
+        handles_.invalidate();
+
         // Clear all callbacks first to ensure that a failure during `stop_notify`
         // does not leave any dangling callbacks.
         if (device_->has_battery_interface()) {
@@ -354,6 +530,7 @@ void PeripheralLinux::_cleanup_characteristics() noexcept {
         for (auto bluez_service : device_->services()) {
             for (auto bluez_characteristic : bluez_service->characteristics()) {
                 try {
+                    bluez_characteristic->release_notify();
                     if (bluez_characteristic->notifying()) {
                         bluez_characteristic->stop_notify();
                     }
@@ -393,10 +570,11 @@ bool PeripheralLinux::_attempt_disconnect() {
     return disconnection_cv_.wait_for(lock, Config::SimpleBluez::disconnection_timeout, [this]() { return !is_connected(); });
 }
 
-std::shared_ptr<SimpleBluez::Characteristic> PeripheralLinux::_get_characteristic(
-    BluetoothUUID const& service_uuid, BluetoothUUID const& characteristic_uuid) {
+SimpleBluez::Device::CharacteristicEntry PeripheralLinux::_get_characteristic(BluetoothUUID const& service_uuid,
+                                                                             BluetoothUUID const& characteristic_uuid) {
     try {
-        return device_->get_characteristic(service_uuid, characteristic_uuid);
+        return device_->characteristic_entry(SimpleBluez::UUID128{service_uuid.high(), service_uuid.low()},
+                                             SimpleBluez::UUID128{characteristic_uuid.high(), characteristic_uuid.low()});
     } catch (SimpleBluez::Exception::ServiceNotFoundException& e) {
         throw Exception::ServiceNotFound(service_uuid);
     } catch (SimpleBluez::Exception::CharacteristicNotFoundException& e) {
@@ -8,6 +8,7 @@
 #include <simplebluez/standard/Characteristic.h>
 #include <simplebluez/standard/Device.h>
 
+#include "../common/CharacteristicHandleBase.h"
 #include "../common/PeripheralBase.h"
 
 #include <kvn_safe_callback.hpp>
@@ -29,8 +30,11 @@ class PeripheralLinux : public SimpleBLE::PeripheralBase {
     virtual BluetoothAddress address() override;
     virtual BluetoothAddressType address_type() override;
     virtual int16_t rssi() override;
+    virtual ScanKey scan_key() override;
+    MacAddress mac_address() const;
 
     virtual int16_t tx_power() override;
+    virtual bool has_tx_power() override;
     virtual uint16_t mtu() override;
 
     virtual void connect() override;
@@ -55,16 +59,42 @@ class PeripheralLinux : public SimpleBLE::PeripheralBase {
 
     virtual ByteArray read(BluetoothUUID const& service, BluetoothUUID const& characteristic, BluetoothUUID const& descriptor) override;
     virtual void write(BluetoothUUID const& service, BluetoothUUID const& characteristic, BluetoothUUID const& descriptor, ByteArray const& data) override;
+
+    virtual void read_async(BluetoothUUID const& service, BluetoothUUID const& characteristic, ReadCallback callback) override;
+    virtual void write_request_async(BluetoothUUID const& service, BluetoothUUID const& characteristic, ByteArray const& data, WriteCallback callback) override;
+    virtual void write_command_async(BluetoothUUID const& service, BluetoothUUID const& characteristic, ByteArray const& data, WriteCallback callback) override;
+    virtual void read_async(BluetoothUUID const& service, BluetoothUUID const& characteristic, BluetoothUUID const& descriptor, ReadCallback callback) override;
+    virtual void write_async(BluetoothUUID const& service, BluetoothUUID const& characteristic, BluetoothUUID const& descriptor, ByteArray const& data, WriteCallback callback) override;
     // clang-format on
 
+    virtual std::shared_ptr<CharacteristicHandleBase> resolve(BluetoothUUID const& service, BluetoothUUID const& characteristic) override;
+    virtual ByteArray read(CharacteristicHandleBase& handle) override;
+    virtual void write_request(CharacteristicHandleBase& handle, ByteArray const& data) override;
+    virtual void write_command(CharacteristicHandleBase& handle, ByteArray const& data) override;
+
+    virtual std::shared_ptr<WriteStreamBase> open_write_stream(BluetoothUUID const& service,
+                                                               BluetoothUUID const& characteristic) override;
+
     virtual void set_callback_on_connected(std::function<void()> on_connected) override;
     virtual void set_callback_on_disconnected(std::function<void()> on_disconnected) override;
 
   private:
+    // Handle bound to the BlueZ characteristic, which BlueZ drops on disconnection or when services change.
+    class BoundCharacteristic : public CharacteristicHandleBase {
+      public:
+        BoundCharacteristic(const PeripheralLinux* owner, BluetoothUUID const& service,
+                            BluetoothUUID const& characteristic, SimpleBluez::Device::CharacteristicEntry entry)
+            : CharacteristicHandleBase(owner, service, characteristic), entry(std::move(entry)) {}
+
+        const SimpleBluez::Device::CharacteristicEntry entry;
+    };
+
     std::atomic_bool battery_emulation_required_{false};
 
     std::shared_ptr<SimpleBluez::Adapter> adapter_;
     std::shared_ptr<SimpleBluez::Device> device_;
+    // Parsed once, as BlueZ only hands out the address as text.
+    const MacAddress address_;
 
     std::condition_variable connection_cv_;
     std::mutex connection_mutex_;
@@ -75,16 +105,23 @@ class PeripheralLinux : public SimpleBLE::PeripheralBase {
     kvn::safe_callback<void()> callback_on_connected_;
     kvn::safe_callback<void()> callback_on_disconnected_;
 
+    CharacteristicHandleSet handles_;
+
     bool _attempt_connect();
     bool _attempt_disconnect();
     void _cleanup_characteristics() noexcept;
 
-    std::shared_ptr<SimpleBluez::Characteristic> _get_characteristic(BluetoothUUID const& service_uuid,
-                                                                     BluetoothUUID const& characteristic_uuid);
+    SimpleBluez::Device::CharacteristicEntry _get_characteristic(BluetoothUUID const& service_uuid,
+                                                                 BluetoothUUID const& characteristic_uuid);
 
     std::shared_ptr<SimpleBluez::Descriptor> _get_descriptor(BluetoothUUID const& service_uuid,
                                                              BluetoothUUID const& characteristic_uuid,
                                                              BluetoothUUID const& descriptor_uuid);
+
+    BoundCharacteristic* _get_bound(CharacteristicHandleBase& handle);
+
+    ReadCallback _deliver(ReadCallback callback);
+    WriteCallback _deliver(WriteCallback callback);
 };
 
 }  // namespace SimpleBLE
@@ -0,0 +1,64 @@
+#include "WriteStreamLinux.h"
+
+#include <simpleble/Exceptions.h>
+
+#include <fmt/core.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+using namespace SimpleBLE;
+
+// The MTU reported by BlueZ includes the 3 byte ATT header of a write command.
+WriteStreamLinux::WriteStreamLinux(SimpleDBus::UnixFd fd, uint16_t mtu)
+    : fd_(std::move(fd)), payload_size_(std::max(mtu, static_cast<uint16_t>(4)) - 3) {}
+
+uint16_t WriteStreamLinux::mtu() { return payload_size_; }
+
+size_t WriteStreamLinux::write(ByteArray const& data) {
+    std::scoped_lock lock(mutex_);
+    if (!fd_.is_valid()) throw Exception::OperationFailed("Write stream is closed");
+
+    size_t sent = 0;
+    while (sent < data.size()) {
+        size_t length = std::min<size_t>(payload_size_, data.size() - sent);
+        if (send(fd_.get(), data.data() + sent, length, MSG_DONTWAIT | MSG_NOSIGNAL) >= 0) {
+            sent += length;
+            continue;
+        }
+
+        int error = errno;
+        if (error == EINTR) continue;
+        if (error == EAGAIN || error == EWOULDBLOCK) break;
+
+        // BlueZ closes its end when the device disconnects or the characteristic goes away.
+        fd_.reset();
+        throw Exception::OperationFailed(fmt::format("Write stream failed: {}", std::strerror(error)));
+    }
+    return sent;
+}
+
+bool WriteStreamLinux::wait_writable(int timeout_ms) {
+    int fd;
+    {
+        std::scoped_lock lock(mutex_);
+        fd = fd_.get();
+    }
+    if (fd < 0) return false;
+
+    pollfd entry = {fd, POLLOUT, 0};
+    int result = poll(&entry, 1, timeout_ms);
+    return result > 0 && (entry.revents & POLLOUT) && !(entry.revents & (POLLERR | POLLHUP | POLLNVAL));
+}
+
+bool WriteStreamLinux::is_open() {
+    std::scoped_lock lock(mutex_);
+    return fd_.is_valid();
+}
+
+void WriteStreamLinux::close() {
+    std::scoped_lock lock(mutex_);
+    fd_.reset();
+}
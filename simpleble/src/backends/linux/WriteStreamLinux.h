@@ -0,0 +1,33 @@
+#pragma once
+
+#include "../common/WriteStreamBase.h"
+
+#include <simpledbus/base/Holder.h>
+
+#include <cstdint>
+#include <mutex>
+
+namespace SimpleBLE {
+
+/**
+ * Write commands sent over a socket obtained through BlueZ AcquireWrite. Every packet on the socket
+ * becomes one write command, so the payload is split at the MTU and sent without any D-Bus traffic.
+ */
+class WriteStreamLinux : public WriteStreamBase {
+  public:
+    WriteStreamLinux(SimpleDBus::UnixFd fd, uint16_t mtu);
+    virtual ~WriteStreamLinux() = default;
+
+    uint16_t mtu() override;
+    size_t write(ByteArray const& data) override;
+    bool wait_writable(int timeout_ms) override;
+    bool is_open() override;
+    void close() override;
+
+  private:
+    std::mutex mutex_;
+    SimpleDBus::UnixFd fd_;
+    uint16_t payload_size_;
+};
+
+}  // namespace SimpleBLE
@@ -6,6 +6,7 @@
 #include "BuildVec.h"
 #include "BuilderBase.h"
 #include "CommonUtils.h"
+#include "LoggingInternal.h"
 #include "PeripheralLinuxLegacy.h"
 
 using namespace SimpleBLE;
@@ -42,30 +43,43 @@ void AdapterLinuxLegacy::scan_start() {
             return;
         }
 
-        if (this->peripherals_.count(device->address()) == 0) {
+        // Devices are matched by their proxy, so that the address is only parsed the first time one is heard from.
+        auto it = this->peripherals_.find(device.get());
+        if (it == this->peripherals_.end()) {
+            if (!MacAddress::try_parse(device->address())) {
+                SIMPLEBLE_LOG_WARN(fmt::format("Ignoring device with invalid address {}", device->address()));
+                return;
+            }
+
             // If the incoming peripheral has never been seen before, create and save a reference to it.
             auto base_peripheral = std::make_shared<PeripheralLinuxLegacy>(device, this->adapter_);
-            this->peripherals_.insert(std::make_pair(device->address(), base_peripheral));
+            it = this->peripherals_.insert(std::make_pair(device.get(), base_peripheral)).first;
         }
 
         // Update the received advertising data.
-        auto peripheral = this->peripherals_.at(device->address());
+        auto peripheral = it->second;
+        MacAddress address = peripheral->mac_address();
+        this->scan_cache_touch(peripheral);
+
+        // No discovery filter is handed to BlueZ, so every result is checked against the filter here.
+        if (!this->scan_filter_accepts(*peripheral)) {
+            return;
+        }
+        bool duplicate = this->scan_filter_is_duplicate(*peripheral);
 
         // Check if the device has been seen before, to forward the correct call to the user.
-        if (this->seen_peripherals_.count(device->address()) == 0) {
+        if (this->seen_peripherals_.count(address) == 0) {
             // Store it in our table of seen peripherals
-            this->seen_peripherals_.insert(std::make_pair(device->address(), peripheral));
-            SAFE_CALLBACK_CALL(this->_callback_on_scan_found, Factory::build(peripheral));
-        } else {
-            SAFE_CALLBACK_CALL(this->_callback_on_scan_updated, Factory::build(peripheral));
+            this->seen_peripherals_.insert(std::make_pair(address, peripheral));
+            this->scan_found(peripheral);
+        } else if (!duplicate) {
+            this->scan_updated(peripheral);
         }
     });
 
     // Start scanning and notify the user.
     adapter_->discovery_start();
 
-    // TODO: Does a discovery filter need to be set?
-
     SAFE_CALLBACK_CALL(this->_callback_on_scan_start);
     is_scanning_ = true;
 }
@@ -90,6 +104,12 @@ bool AdapterLinuxLegacy::scan_is_active() { return is_scanning_ && adapter_->dis
 
 SharedPtrVector<PeripheralBase> AdapterLinuxLegacy::scan_get_results() { return Util::values(seen_peripherals_); }
 
+void AdapterLinuxLegacy::scan_cache_evict(const BluetoothAddress& address, const std::shared_ptr<PeripheralBase>& peripheral) {
+    auto device = static_cast<SimpleBluezLegacy::Device*>(peripheral->underlying());
+    seen_peripherals_.erase(std::static_pointer_cast<PeripheralLinuxLegacy>(peripheral)->mac_address());
+    peripherals_.erase(device);
+}
+
 SharedPtrVector<PeripheralBase> AdapterLinuxLegacy::get_paired_peripherals() {
     SharedPtrVector<PeripheralBase> peripherals;
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <simpleble/Exceptions.h>
+#include <simpleble/MacAddress.h>
 #include <simpleble/Types.h>
 
 #include "../common/AdapterBase.h"
@@ -13,6 +14,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace SimpleBLE {
@@ -44,12 +46,15 @@ class AdapterLinuxLegacy : public SimpleBLE::AdapterBase {
     virtual bool bluetooth_enabled() override;
 
   private:
+    void scan_cache_evict(const BluetoothAddress& address, const std::shared_ptr<PeripheralBase>& peripheral) override;
+
     std::shared_ptr<SimpleBluezLegacy::Adapter> adapter_;
 
     std::atomic_bool is_scanning_;
 
-    std::map<BluetoothAddress, std::shared_ptr<PeripheralLinuxLegacy>> peripherals_;
-    std::map<BluetoothAddress, std::shared_ptr<PeripheralLinuxLegacy>> seen_peripherals_;
+    // Keyed by the proxy of the device, which the peripheral keeps alive.
+    std::unordered_map<SimpleBluezLegacy::Device*, std::shared_ptr<PeripheralLinuxLegacy>> peripherals_;
+    std::map<MacAddress, std::shared_ptr<PeripheralLinuxLegacy>> seen_peripherals_;
 };
 
 }  // namespace SimpleBLE
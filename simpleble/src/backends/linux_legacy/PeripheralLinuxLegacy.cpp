@@ -25,7 +25,7 @@ using namespace std::chrono_literals;
 
 PeripheralLinuxLegacy::PeripheralLinuxLegacy(std::shared_ptr<SimpleBluezLegacy::Device> device,
                                  std::shared_ptr<SimpleBluezLegacy::Adapter> adapter)
-    : device_(std::move(device)), adapter_(std::move(adapter)) {}
+    : device_(std::move(device)), adapter_(std::move(adapter)), address_(device_->address()) {}
 
 PeripheralLinuxLegacy::~PeripheralLinuxLegacy() {
     // Clear the callbacks to prevent any further events from being sent to the user.
@@ -41,7 +41,11 @@ void* PeripheralLinuxLegacy::underlying() const { return device_.get(); }
 
 std::string PeripheralLinuxLegacy::identifier() { return device_->name(); }
 
-BluetoothAddress PeripheralLinuxLegacy::address() { return device_->address(); }
+BluetoothAddress PeripheralLinuxLegacy::address() { return address_.str(); }
+
+ScanKey PeripheralLinuxLegacy::scan_key() { return address_; }
+
+MacAddress PeripheralLinuxLegacy::mac_address() const { return address_; }
 
 BluetoothAddressType PeripheralLinuxLegacy::address_type() {
     std::string address_type = device_->address_type();
@@ -29,6 +29,8 @@ class PeripheralLinuxLegacy : public SimpleBLE::PeripheralBase {
     virtual BluetoothAddress address() override;
     virtual BluetoothAddressType address_type() override;
     virtual int16_t rssi() override;
+    virtual ScanKey scan_key() override;
+    MacAddress mac_address() const;
 
     virtual int16_t tx_power() override;
     virtual uint16_t mtu() override;
@@ -65,6 +67,8 @@ class PeripheralLinuxLegacy : public SimpleBLE::PeripheralBase {
 
     std::shared_ptr<SimpleBluezLegacy::Adapter> adapter_;
     std::shared_ptr<SimpleBluezLegacy::Device> device_;
+    // Parsed once, as BlueZ only hands out the address as text.
+    const MacAddress address_;
 
     std::condition_variable connection_cv_;
     std::mutex connection_mutex_;
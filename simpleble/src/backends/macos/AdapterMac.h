@@ -72,6 +72,8 @@ class AdapterMac : public AdapterBase {
     std::map<void*, std::shared_ptr<PeripheralMac>> seen_peripherals_;
 
   private:
+    void scan_cache_evict(const BluetoothAddress& address, const std::shared_ptr<PeripheralBase>& peripheral) override;
+
     BluetoothAddress address() const;
 };
 
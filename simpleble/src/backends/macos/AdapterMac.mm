@@ -99,6 +99,13 @@ SharedPtrVector<PeripheralBase> AdapterMac::scan_get_results() {
 
 SharedPtrVector<PeripheralBase> AdapterMac::get_paired_peripherals() { return {}; }
 
+void AdapterMac::scan_cache_evict(const BluetoothAddress& address, const std::shared_ptr<PeripheralBase>& peripheral) {
+    // Peripherals are keyed by their CBPeripheral here, not by address.
+    void* opaque_peripheral = peripheral->underlying();
+    seen_peripherals_.erase(opaque_peripheral);
+    peripherals_.erase(opaque_peripheral);
+}
+
 // Delegate methods passed for AdapterBaseMacOS
 
 void AdapterMac::delegate_did_discover_peripheral(void* opaque_peripheral, void* opaque_adapter, advertising_data_t advertising_data) {
@@ -111,17 +118,19 @@ void AdapterMac::delegate_did_discover_peripheral(void* opaque_peripheral, void*
     // Update the received advertising data.
     auto base_peripheral = this->peripherals_.at(opaque_peripheral);
     base_peripheral->update_advertising_data(advertising_data);
+    scan_cache_touch(base_peripheral);
+
+    if (!scan_filter_accepts(*base_peripheral)) return;
+    bool duplicate = scan_filter_is_duplicate(*base_peripheral);
 
-    // Convert the base object into an external-facing Peripheral object
-    Peripheral peripheral = Factory::build(base_peripheral);
 
     // Check if the device has been seen before, to forward the correct call to the user.
     if (this->seen_peripherals_.count(opaque_peripheral) == 0) {
         // Store it in our table of seen peripherals
         this->seen_peripherals_.insert(std::make_pair(opaque_peripheral, base_peripheral));
-        SAFE_CALLBACK_CALL(this->_callback_on_scan_found, peripheral);
-    } else {
-        SAFE_CALLBACK_CALL(this->_callback_on_scan_updated, peripheral);
+        scan_found(base_peripheral);
+    } else if (!duplicate) {
+        scan_updated(base_peripheral);
     }
 }
 
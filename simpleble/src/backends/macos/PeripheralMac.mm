@@ -116,8 +116,8 @@ std::map<uint16_t, ByteArray> PeripheralMac::manufacturer_data() { return manufa
 ByteArray PeripheralMac::read(BluetoothUUID const& service, BluetoothUUID const& characteristic) {
     PeripheralBaseMacOS* internal = (__bridge PeripheralBaseMacOS*)opaque_internal_;
 
-    NSString* service_uuid = [NSString stringWithCString:service.c_str() encoding:NSString.defaultCStringEncoding];
-    NSString* characteristic_uuid = [NSString stringWithCString:characteristic.c_str() encoding:NSString.defaultCStringEncoding];
+    NSString* service_uuid = [NSString stringWithCString:service.str().c_str() encoding:NSString.defaultCStringEncoding];
+    NSString* characteristic_uuid = [NSString stringWithCString:characteristic.str().c_str() encoding:NSString.defaultCStringEncoding];
 
     return [internal read:service_uuid characteristic_uuid:characteristic_uuid];
 }
@@ -125,8 +125,8 @@ ByteArray PeripheralMac::read(BluetoothUUID const& service, BluetoothUUID const&
 void PeripheralMac::write_request(BluetoothUUID const& service, BluetoothUUID const& characteristic, ByteArray const& byte_array) {
     PeripheralBaseMacOS* internal = (__bridge PeripheralBaseMacOS*)opaque_internal_;
 
-    NSString* service_uuid = [NSString stringWithCString:service.c_str() encoding:NSString.defaultCStringEncoding];
-    NSString* characteristic_uuid = [NSString stringWithCString:characteristic.c_str() encoding:NSString.defaultCStringEncoding];
+    NSString* service_uuid = [NSString stringWithCString:service.str().c_str() encoding:NSString.defaultCStringEncoding];
+    NSString* characteristic_uuid = [NSString stringWithCString:characteristic.str().c_str() encoding:NSString.defaultCStringEncoding];
     NSData* payload = [NSData dataWithBytes:(void*)byte_array.data() length:byte_array.size()];
 
     [internal writeRequest:service_uuid characteristic_uuid:characteristic_uuid payload:payload];
@@ -135,8 +135,8 @@ void PeripheralMac::write_request(BluetoothUUID const& service, BluetoothUUID co
 void PeripheralMac::write_command(BluetoothUUID const& service, BluetoothUUID const& characteristic, ByteArray const& byte_array) {
     PeripheralBaseMacOS* internal = (__bridge PeripheralBaseMacOS*)opaque_internal_;
 
-    NSString* service_uuid = [NSString stringWithCString:service.c_str() encoding:NSString.defaultCStringEncoding];
-    NSString* characteristic_uuid = [NSString stringWithCString:characteristic.c_str() encoding:NSString.defaultCStringEncoding];
+    NSString* service_uuid = [NSString stringWithCString:service.str().c_str() encoding:NSString.defaultCStringEncoding];
+    NSString* characteristic_uuid = [NSString stringWithCString:characteristic.str().c_str() encoding:NSString.defaultCStringEncoding];
     NSData* payload = [NSData dataWithBytes:(void*)byte_array.data() length:byte_array.size()];
 
     [internal writeCommand:service_uuid characteristic_uuid:characteristic_uuid payload:payload];
@@ -146,8 +146,8 @@ void PeripheralMac::notify(BluetoothUUID const& service, BluetoothUUID const& ch
                            std::function<void(ByteArray payload)> callback) {
     PeripheralBaseMacOS* internal = (__bridge PeripheralBaseMacOS*)opaque_internal_;
 
-    NSString* service_uuid = [NSString stringWithCString:service.c_str() encoding:NSString.defaultCStringEncoding];
-    NSString* characteristic_uuid = [NSString stringWithCString:characteristic.c_str() encoding:NSString.defaultCStringEncoding];
+    NSString* service_uuid = [NSString stringWithCString:service.str().c_str() encoding:NSString.defaultCStringEncoding];
+    NSString* characteristic_uuid = [NSString stringWithCString:characteristic.str().c_str() encoding:NSString.defaultCStringEncoding];
     [internal notify:service_uuid characteristic_uuid:characteristic_uuid callback:callback];
 }
 
@@ -155,25 +155,25 @@ void PeripheralMac::indicate(BluetoothUUID const& service, BluetoothUUID const&
                              std::function<void(ByteArray payload)> callback) {
     PeripheralBaseMacOS* internal = (__bridge PeripheralBaseMacOS*)opaque_internal_;
 
-    NSString* service_uuid = [NSString stringWithCString:service.c_str() encoding:NSString.defaultCStringEncoding];
-    NSString* characteristic_uuid = [NSString stringWithCString:characteristic.c_str() encoding:NSString.defaultCStringEncoding];
+    NSString* service_uuid = [NSString stringWithCString:service.str().c_str() encoding:NSString.defaultCStringEncoding];
+    NSString* characteristic_uuid = [NSString stringWithCString:characteristic.str().c_str() encoding:NSString.defaultCStringEncoding];
     [internal indicate:service_uuid characteristic_uuid:characteristic_uuid callback:callback];
 }
 
 void PeripheralMac::unsubscribe(BluetoothUUID const& service, BluetoothUUID const& characteristic) {
     PeripheralBaseMacOS* internal = (__bridge PeripheralBaseMacOS*)opaque_internal_;
 
-    NSString* service_uuid = [NSString stringWithCString:service.c_str() encoding:NSString.defaultCStringEncoding];
-    NSString* characteristic_uuid = [NSString stringWithCString:characteristic.c_str() encoding:NSString.defaultCStringEncoding];
+    NSString* service_uuid = [NSString stringWithCString:service.str().c_str() encoding:NSString.defaultCStringEncoding];
+    NSString* characteristic_uuid = [NSString stringWithCString:characteristic.str().c_str() encoding:NSString.defaultCStringEncoding];
     [internal unsubscribe:service_uuid characteristic_uuid:characteristic_uuid];
 }
 
 ByteArray PeripheralMac::read(BluetoothUUID const& service, BluetoothUUID const& characteristic, BluetoothUUID const& descriptor) {
     PeripheralBaseMacOS* internal = (__bridge PeripheralBaseMacOS*)opaque_internal_;
 
-    NSString* service_uuid = [NSString stringWithCString:service.c_str() encoding:NSString.defaultCStringEncoding];
-    NSString* characteristic_uuid = [NSString stringWithCString:characteristic.c_str() encoding:NSString.defaultCStringEncoding];
-    NSString* descriptor_uuid = [NSString stringWithCString:descriptor.c_str() encoding:NSString.defaultCStringEncoding];
+    NSString* service_uuid = [NSString stringWithCString:service.str().c_str() encoding:NSString.defaultCStringEncoding];
+    NSString* characteristic_uuid = [NSString stringWithCString:characteristic.str().c_str() encoding:NSString.defaultCStringEncoding];
+    NSString* descriptor_uuid = [NSString stringWithCString:descriptor.str().c_str() encoding:NSString.defaultCStringEncoding];
 
     return [internal read:service_uuid characteristic_uuid:characteristic_uuid descriptor_uuid:descriptor_uuid];
 }
@@ -182,9 +182,9 @@ void PeripheralMac::write(BluetoothUUID const& service, BluetoothUUID const& cha
                           ByteArray const& byte_array) {
     PeripheralBaseMacOS* internal = (__bridge PeripheralBaseMacOS*)opaque_internal_;
 
-    NSString* service_uuid = [NSString stringWithCString:service.c_str() encoding:NSString.defaultCStringEncoding];
-    NSString* characteristic_uuid = [NSString stringWithCString:characteristic.c_str() encoding:NSString.defaultCStringEncoding];
-    NSString* descriptor_uuid = [NSString stringWithCString:descriptor.c_str() encoding:NSString.defaultCStringEncoding];
+    NSString* service_uuid = [NSString stringWithCString:service.str().c_str() encoding:NSString.defaultCStringEncoding];
+    NSString* characteristic_uuid = [NSString stringWithCString:characteristic.str().c_str() encoding:NSString.defaultCStringEncoding];
+    NSString* descriptor_uuid = [NSString stringWithCString:descriptor.str().c_str() encoding:NSString.defaultCStringEncoding];
     NSData* payload = [NSData dataWithBytes:(void*)byte_array.data() length:byte_array.size()];
 
     [internal write:service_uuid characteristic_uuid:characteristic_uuid descriptor_uuid:descriptor_uuid payload:payload];
@@ -33,9 +33,15 @@ void AdapterPlain::scan_start() {
     is_scanning_ = true;
     SAFE_CALLBACK_CALL(this->_callback_on_scan_start);
 
-    Peripheral peripheral = Factory::build(std::make_shared<PeripheralPlain>());
-    SAFE_CALLBACK_CALL(this->_callback_on_scan_found, peripheral);
-    SAFE_CALLBACK_CALL(this->_callback_on_scan_updated, peripheral);
+    auto base_peripheral = std::make_shared<PeripheralPlain>();
+    scan_cache_touch(base_peripheral);
+    if (!scan_filter_accepts(*base_peripheral)) return;
+    bool duplicate = scan_filter_is_duplicate(*base_peripheral);
+
+    scan_found(base_peripheral);
+    if (!duplicate) {
+        scan_updated(base_peripheral);
+    }
 }
 
 void AdapterPlain::scan_stop() {
@@ -52,7 +58,10 @@ void AdapterPlain::scan_for(int timeout_ms) {
 bool AdapterPlain::scan_is_active() { return is_scanning_; }
 SharedPtrVector<PeripheralBase> AdapterPlain::scan_get_results() {
     SharedPtrVector<PeripheralBase> peripherals;
-    peripherals.push_back(std::make_shared<PeripheralPlain>());
+    auto base_peripheral = std::make_shared<PeripheralPlain>();
+    if (scan_filter_accepts(*base_peripheral)) {
+        peripherals.push_back(base_peripheral);
+    }
 
     return peripherals;
 }
@@ -49,6 +49,7 @@ void PeripheralPlain::connect() {
 
 void PeripheralPlain::disconnect() {
     connected_ = false;
+    handles_.invalidate();
     SAFE_CALLBACK_CALL(this->callback_on_disconnected_);
 }
 bool PeripheralPlain::is_connected() { return connected_; }
@@ -142,6 +143,14 @@ ByteArray PeripheralPlain::read(BluetoothUUID const& service, BluetoothUUID cons
 void PeripheralPlain::write(BluetoothUUID const& service, BluetoothUUID const& characteristic,
                             BluetoothUUID const& descriptor, ByteArray const& data) {}
 
+// There is nothing to bind to, but handles still go stale on disconnection like on the real backends.
+std::shared_ptr<CharacteristicHandleBase> PeripheralPlain::resolve(BluetoothUUID const& service,
+                                                                   BluetoothUUID const& characteristic) {
+    auto handle = PeripheralBase::resolve(service, characteristic);
+    handles_.add(handle);
+    return handle;
+}
+
 void PeripheralPlain::set_callback_on_connected(std::function<void()> on_connected) {
     if (on_connected) {
         callback_on_connected_.load(std::move(on_connected));
@@ -3,6 +3,7 @@
 #include <simpleble/Exceptions.h>
 #include <simpleble/Service.h>
 #include <simpleble/Types.h>
+#include "CharacteristicHandleBase.h"
 #include "PeripheralBase.h"
 
 #include <TaskRunner.hpp>
@@ -53,6 +54,8 @@ class PeripheralPlain : public PeripheralBase {
     virtual void write(BluetoothUUID const& service, BluetoothUUID const& characteristic, BluetoothUUID const& descriptor, ByteArray const& data) override;
     // clang-format on
 
+    virtual std::shared_ptr<CharacteristicHandleBase> resolve(BluetoothUUID const& service, BluetoothUUID const& characteristic) override;
+
     virtual void set_callback_on_connected(std::function<void()> on_connected) override;
     virtual void set_callback_on_disconnected(std::function<void()> on_disconnected) override;
 
@@ -66,6 +69,8 @@ class PeripheralPlain : public PeripheralBase {
     std::mutex callback_mutex_;
     std::map<std::pair<BluetoothUUID, BluetoothUUID>, std::function<void(ByteArray payload)>> callbacks_;
 
+    CharacteristicHandleSet handles_;
+
     TaskRunner task_runner_;
 };
 
@@ -124,6 +124,12 @@ bool AdapterWindows::scan_is_active() { return scan_is_active_; }
 
 SharedPtrVector<PeripheralBase> AdapterWindows::scan_get_results() { return Util::values(seen_peripherals_); }
 
+void AdapterWindows::scan_cache_evict(const BluetoothAddress& address, const std::shared_ptr<PeripheralBase>& peripheral) {
+    MacAddress key = std::static_pointer_cast<PeripheralWindows>(peripheral)->mac_address();
+    seen_peripherals_.erase(key);
+    peripherals_.erase(key);
+}
+
 SharedPtrVector<PeripheralBase> AdapterWindows::get_paired_peripherals() {
     return MtaManager::get().execute_sync<SharedPtrVector<PeripheralBase>>([this]() {
         SharedPtrVector<PeripheralBase> peripherals;
@@ -138,7 +144,7 @@ SharedPtrVector<PeripheralBase> AdapterWindows::get_paired_peripherals() {
                     continue;
                 }
 
-                BluetoothAddress address = _mac_address_to_str(device.BluetoothAddress());
+                MacAddress address(device.BluetoothAddress());
                 if (this->peripherals_.count(address) == 0) {
                     // If the peripheral has never been seen before, create and save a reference to it.
                     auto base_peripheral = std::make_shared<PeripheralWindows>(device);
@@ -173,7 +179,7 @@ SharedPtrVector<PeripheralBase> AdapterWindows::get_connected_peripherals() {
                     continue;
                 }
 
-                BluetoothAddress address = _mac_address_to_str(device.BluetoothAddress());
+                MacAddress address(device.BluetoothAddress());
                 if (this->peripherals_.count(address) == 0) {
                     // If the peripheral has never been seen before, create and save a reference to it.
                     auto base_peripheral = std::make_shared<PeripheralWindows>(device);
@@ -204,27 +210,30 @@ void AdapterWindows::_scan_stopped_callback() {
     SAFE_CALLBACK_CALL(this->_callback_on_scan_stop);
 }
 
-void AdapterWindows::_scan_received_callback(advertising_data_t data) {
-    if (this->peripherals_.count(data.mac_address) == 0) {
+void AdapterWindows::_scan_received_callback(MacAddress address, advertising_data_t data) {
+    auto it = this->peripherals_.find(address);
+    if (it == this->peripherals_.end()) {
         // If the incoming peripheral has never been seen before, create and save a reference to it.
-        auto base_peripheral = std::make_shared<PeripheralWindows>(data);
-        this->peripherals_.insert(std::make_pair(data.mac_address, base_peripheral));
+        auto base_peripheral = std::make_shared<PeripheralWindows>(address, data);
+        it = this->peripherals_.insert(std::make_pair(address, base_peripheral)).first;
     }
 
     // Update the received advertising data.
-    auto base_peripheral = this->peripherals_.at(data.mac_address);
+    auto base_peripheral = it->second;
     base_peripheral->update_advertising_data(data);
+    scan_cache_touch(base_peripheral);
+
+    if (!scan_filter_accepts(*base_peripheral)) return;
+    bool duplicate = scan_filter_is_duplicate(*base_peripheral);
 
-    // Convert the base object into an external-facing Peripheral object
-    Peripheral peripheral = Factory::build(base_peripheral);
 
     // Check if the device has been seen before, to forward the correct call to the user.
-    if (this->seen_peripherals_.count(data.mac_address) == 0) {
+    if (this->seen_peripherals_.count(address) == 0) {
         // Store it in our table of seen peripherals
-        this->seen_peripherals_.insert(std::make_pair(data.mac_address, base_peripheral));
-        SAFE_CALLBACK_CALL(this->_callback_on_scan_found, peripheral);
-    } else {
-        SAFE_CALLBACK_CALL(this->_callback_on_scan_updated, peripheral);
+        this->seen_peripherals_.insert(std::make_pair(address, base_peripheral));
+        scan_found(base_peripheral);
+    } else if (!duplicate) {
+        scan_updated(base_peripheral);
     }
 }
 
@@ -251,8 +260,8 @@ void AdapterWindows::_on_scanner_received(
     std::lock_guard<std::mutex> lock(this->scan_update_mutex_);
     if (!this->scan_is_active_) return;
 
+    // The address is kept as the integer WinRT hands out, it is only formatted when the user asks for it.
     advertising_data_t data;
-    data.mac_address = _mac_address_to_str(args.BluetoothAddress());
     Bluetooth::BluetoothAddressType addr_type_enum = args.BluetoothAddressType();
     switch (addr_type_enum) {
         case Bluetooth::BluetoothAddressType::Public:
@@ -334,5 +343,5 @@ void AdapterWindows::_on_scanner_received(
         data.service_data.emplace(std::make_pair(service_uuid, ByteArray()));
     }
 
-    this->_scan_received_callback(data);
+    this->_scan_received_callback(MacAddress(args.BluetoothAddress()), data);
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <simpleble/Exceptions.h>
+#include <simpleble/MacAddress.h>
 #include <simpleble/Peripheral.h>
 #include <simpleble/Types.h>
 
@@ -55,6 +56,8 @@ class AdapterWindows : public AdapterBase {
     virtual bool bluetooth_enabled() override;
 
   private:
+    void scan_cache_evict(const BluetoothAddress& address, const std::shared_ptr<PeripheralBase>& peripheral) override;
+
     BluetoothAdapter adapter_;
     std::string identifier_;
 
@@ -69,8 +72,8 @@ class AdapterWindows : public AdapterBase {
     std::condition_variable scan_stop_cv_;
     std::mutex scan_stop_mutex_;
     std::mutex scan_update_mutex_;
-    std::map<BluetoothAddress, std::shared_ptr<PeripheralWindows>> peripherals_;
-    std::map<BluetoothAddress, std::shared_ptr<PeripheralBase>> seen_peripherals_;
+    std::map<MacAddress, std::shared_ptr<PeripheralWindows>> peripherals_;
+    std::map<MacAddress, std::shared_ptr<PeripheralBase>> seen_peripherals_;
 
     void on_power_state_changed(Radio const& sender, Foundation::IInspectable const&);
 
@@ -83,7 +86,7 @@ class AdapterWindows : public AdapterBase {
         const Advertisement::BluetoothLEAdvertisementReceivedEventArgs args);
 
     void _scan_stopped_callback();
-    void _scan_received_callback(advertising_data_t data);
+    void _scan_received_callback(MacAddress address, advertising_data_t data);
 };
 
 }  // namespace SimpleBLE
@@ -29,7 +29,7 @@ using namespace std::chrono_literals;
 PeripheralWindows::PeripheralWindows(BluetoothLEDevice device) {
     device_ = device;
     identifier_ = winrt::to_string(device.Name());
-    address_ = _mac_address_to_str(device.BluetoothAddress());
+    address_ = MacAddress(device.BluetoothAddress());
     address_type_ = BluetoothAddressType::PUBLIC;
 
     // NOTE: We're assuming that the device is connectable, as this constructor is only called
@@ -37,10 +37,10 @@ PeripheralWindows::PeripheralWindows(BluetoothLEDevice device) {
     connectable_ = true;
 }
 
-PeripheralWindows::PeripheralWindows(advertising_data_t advertising_data) {
+PeripheralWindows::PeripheralWindows(MacAddress address, advertising_data_t advertising_data) {
     address_type_ = advertising_data.address_type;
     identifier_ = advertising_data.identifier;
-    address_ = advertising_data.mac_address;
+    address_ = address;
     rssi_ = advertising_data.rssi;
     tx_power_ = advertising_data.tx_power;
     manufacturer_data_ = advertising_data.manufacturer_data;
@@ -64,7 +64,11 @@ SimpleBLE::BluetoothAddressType PeripheralWindows::address_type() { return addre
 
 std::string PeripheralWindows::identifier() { return identifier_; }
 
-BluetoothAddress PeripheralWindows::address() { return address_; }
+BluetoothAddress PeripheralWindows::address() { return _mac_address_to_str(address_.value()); }
+
+ScanKey PeripheralWindows::scan_key() { return address_; }
+
+MacAddress PeripheralWindows::mac_address() const { return address_; }
 
 int16_t PeripheralWindows::rssi() { return rssi_; }
 
@@ -93,7 +97,7 @@ void PeripheralWindows::update_advertising_data(advertising_data_t advertising_d
 
 void PeripheralWindows::connect() {
     MtaManager::get().execute_sync([this]() {
-        device_ = async_get(BluetoothLEDevice::FromBluetoothAddressAsync(_str_to_mac_address(address_)));
+        device_ = async_get(BluetoothLEDevice::FromBluetoothAddressAsync(address_.value()));
     });
 
     // Attempt to connect to the device.
@@ -41,7 +41,7 @@ struct gatt_service_t {
 class PeripheralWindows : public PeripheralBase {
   public:
     PeripheralWindows(BluetoothLEDevice device);
-    PeripheralWindows(advertising_data_t advertising_data);
+    PeripheralWindows(MacAddress address, advertising_data_t advertising_data);
     virtual ~PeripheralWindows();
 
     virtual void* underlying() const override;
@@ -50,6 +50,8 @@ class PeripheralWindows : public PeripheralBase {
     virtual BluetoothAddress address() override;
     virtual SimpleBLE::BluetoothAddressType address_type() override;
     virtual int16_t rssi() override;
+    virtual ScanKey scan_key() override;
+    MacAddress mac_address() const;
     virtual int16_t tx_power() override;
     virtual uint16_t mtu() override;
 
@@ -94,7 +96,7 @@ class PeripheralWindows : public PeripheralBase {
     // https://docs.microsoft.com/en-us/uwp/api/windows.devices.bluetooth.bluetoothledevice.frombluetoothaddressasync
 
     std::string identifier_;
-    BluetoothAddress address_;
+    MacAddress address_;
     SimpleBLE::BluetoothAddressType address_type_;
     int16_t rssi_ = INT16_MIN;
     int16_t tx_power_ = INT16_MIN;
@@ -3,6 +3,7 @@
 
 #include "BuildVec.h"
 #include "LoggingInternal.h"
+#include "backends/common/AdapterAggregate.h"
 #include "backends/common/AdapterBase.h"
 
 using namespace SimpleBLE;
@@ -18,6 +19,15 @@ std::vector<Adapter> Adapter::get_adapters() {
     return adapter_list;
 }
 
+Adapter Adapter::aggregate(std::vector<Adapter> adapters) {
+    std::vector<std::shared_ptr<AdapterBase>> internals;
+    for (auto& adapter : adapters) {
+        if (!adapter.initialized()) throw Exception::NotInitialized();
+        internals.push_back(adapter.internal_);
+    }
+    return Factory::build(std::make_shared<AdapterAggregate>(std::move(internals)));
+}
+
 // TODO: this should be the implementation of the per-backend bluetooth_enabled() function
 // bool Adapter::bluetooth_enabled() { return (*this)->bluetooth_enabled(); }
 
@@ -92,6 +102,8 @@ bool Adapter::scan_is_active() { return (*this)->scan_is_active(); }
 
 std::vector<Peripheral> Adapter::scan_get_results() { return Factory::vector((*this)->scan_get_results()); }
 
+void Adapter::set_scan_filter(const ScanFilter& filter) { (*this)->set_scan_filter(filter); }
+
 std::vector<Peripheral> Adapter::get_paired_peripherals() { return Factory::vector((*this)->get_paired_peripherals()); }
 
 std::vector<Peripheral> Adapter::get_connected_peripherals() { return Factory::vector((*this)->get_connected_peripherals()); }
@@ -111,3 +123,20 @@ void Adapter::set_callback_on_scan_updated(std::function<void(Peripheral)> on_sc
 void Adapter::set_callback_on_scan_found(std::function<void(Peripheral)> on_scan_found) {
     (*this)->set_callback_on_scan_found(std::move(on_scan_found));
 }
+
+void Adapter::set_callback_on_scan_updated_batch(std::function<void(std::vector<ScanUpdate>)> on_scan_updated_batch,
+                                                 int interval_ms) {
+    (*this)->set_callback_on_scan_updated_batch(std::move(on_scan_updated_batch), interval_ms);
+}
+
+void Adapter::set_scan_cache_limits(size_t max_entries, int ttl_ms) {
+    (*this)->set_scan_cache_limits(max_entries, ttl_ms);
+}
+
+void Adapter::set_scan_cache_pinned(BluetoothAddress address, bool pinned) {
+    (*this)->set_scan_cache_pinned(address, pinned);
+}
+
+void Adapter::set_callback_on_scan_lost(std::function<void(Peripheral)> on_scan_lost) {
+    (*this)->set_callback_on_scan_lost(std::move(on_scan_lost));
+}
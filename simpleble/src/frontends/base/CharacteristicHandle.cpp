@@ -0,0 +1,25 @@
+#include <simpleble/CharacteristicHandle.h>
+
+#include "CharacteristicHandleBase.h"
+
+using namespace SimpleBLE;
+
+bool CharacteristicHandle::initialized() const { return internal_ != nullptr; }
+
+CharacteristicHandleBase* CharacteristicHandle::operator->() {
+    if (!initialized()) throw Exception::NotInitialized();
+
+    return internal_.get();
+}
+
+const CharacteristicHandleBase* CharacteristicHandle::operator->() const {
+    if (!initialized()) throw Exception::NotInitialized();
+
+    return internal_.get();
+}
+
+bool CharacteristicHandle::is_valid() const { return initialized() && internal_->is_valid(); }
+
+BluetoothUUID CharacteristicHandle::service() const { return (*this)->service(); }
+
+BluetoothUUID CharacteristicHandle::characteristic() const { return (*this)->characteristic(); }
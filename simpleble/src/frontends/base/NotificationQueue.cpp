@@ -0,0 +1,37 @@
+#include <simpleble/NotificationQueue.h>
+
+#include "NotificationQueueBase.h"
+
+using namespace SimpleBLE;
+
+bool NotificationQueue::initialized() const { return internal_ != nullptr; }
+
+NotificationQueueBase* NotificationQueue::operator->() {
+    if (!initialized()) throw Exception::NotInitialized();
+
+    return internal_.get();
+}
+
+const NotificationQueueBase* NotificationQueue::operator->() const {
+    if (!initialized()) throw Exception::NotInitialized();
+
+    return internal_.get();
+}
+
+size_t NotificationQueue::capacity() { return (*this)->capacity(); }
+
+size_t NotificationQueue::size() { return (*this)->size(); }
+
+uint64_t NotificationQueue::dropped() { return (*this)->dropped(); }
+
+size_t NotificationQueue::drain(std::vector<Notification>& notifications, size_t max) {
+    return (*this)->drain(notifications, max);
+}
+
+size_t NotificationQueue::drain(std::vector<ByteArray>& payloads, size_t max) { return (*this)->drain(payloads, max); }
+
+bool NotificationQueue::wait_for(int timeout_ms) { return (*this)->wait_for(timeout_ms); }
+
+bool NotificationQueue::is_open() { return (*this)->is_open(); }
+
+void NotificationQueue::close() { (*this)->close(); }
@@ -2,7 +2,10 @@
 
 #include <simpleble/Exceptions.h>
 #include "BuildVec.h"
+#include "CharacteristicHandleBase.h"
+#include "NotificationQueueBase.h"
 #include "PeripheralBase.h"
+#include "WriteStreamBase.h"
 
 using namespace SimpleBLE;
 
@@ -52,6 +55,8 @@ std::vector<Service> Peripheral::services() {
 
 std::map<uint16_t, ByteArray> Peripheral::manufacturer_data() { return (*this)->manufacturer_data(); }
 
+std::vector<PeripheralSighting> Peripheral::sightings() { return (*this)->sightings(); }
+
 ByteArray Peripheral::read(BluetoothUUID const& service, BluetoothUUID const& characteristic) {
     if (!is_connected()) throw Exception::NotConnected();
 
@@ -106,6 +111,185 @@ void Peripheral::write(BluetoothUUID const& service, BluetoothUUID const& charac
     internal_->write(service, characteristic, descriptor, data);
 }
 
+CharacteristicHandle Peripheral::resolve(BluetoothUUID const& service, BluetoothUUID const& characteristic) {
+    if (!is_connected()) throw Exception::NotConnected();
+
+    return Factory::build(internal_->resolve(service, characteristic));
+}
+
+ByteArray Peripheral::read(CharacteristicHandle const& handle) {
+    if (!is_connected()) throw Exception::NotConnected();
+    if (!handle.is_valid()) throw Exception::InvalidReference();
+
+    return internal_->read(*handle.internal_);
+}
+
+void Peripheral::write_request(CharacteristicHandle const& handle, ByteArray const& data) {
+    if (!is_connected()) throw Exception::NotConnected();
+    if (!handle.is_valid()) throw Exception::InvalidReference();
+
+    internal_->write_request(*handle.internal_, data);
+}
+
+void Peripheral::write_command(CharacteristicHandle const& handle, ByteArray const& data) {
+    if (!is_connected()) throw Exception::NotConnected();
+    if (!handle.is_valid()) throw Exception::InvalidReference();
+
+    internal_->write_command(*handle.internal_, data);
+}
+
+// Subscriptions are set up once, so they are not worth binding and keep going through the UUIDs.
+void Peripheral::notify(CharacteristicHandle const& handle, std::function<void(ByteArray payload)> callback) {
+    if (!handle.is_valid()) throw Exception::InvalidReference();
+
+    notify(handle.service(), handle.characteristic(), std::move(callback));
+}
+
+void Peripheral::indicate(CharacteristicHandle const& handle, std::function<void(ByteArray payload)> callback) {
+    if (!handle.is_valid()) throw Exception::InvalidReference();
+
+    indicate(handle.service(), handle.characteristic(), std::move(callback));
+}
+
+void Peripheral::unsubscribe(CharacteristicHandle const& handle) {
+    if (!handle.is_valid()) throw Exception::InvalidReference();
+
+    unsubscribe(handle.service(), handle.characteristic());
+}
+
+// The backend peripheral is kept alive by the callback until the operation completes.
+void Peripheral::read_async(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                            std::function<void(ByteArray value, std::exception_ptr error)> callback) {
+    if (!is_connected()) throw Exception::NotConnected();
+
+    internal_->read_async(service, characteristic,
+                          [internal = internal_, callback = std::move(callback)](ByteArray value, std::exception_ptr error) {
+                              callback(std::move(value), error);
+                          });
+}
+
+std::future<ByteArray> Peripheral::read_async(BluetoothUUID const& service, BluetoothUUID const& characteristic) {
+    auto promise = std::make_shared<std::promise<ByteArray>>();
+    read_async(service, characteristic, [promise](ByteArray value, std::exception_ptr error) {
+        if (error) {
+            promise->set_exception(error);
+        } else {
+            promise->set_value(std::move(value));
+        }
+    });
+    return promise->get_future();
+}
+
+void Peripheral::write_request_async(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                                     ByteArray const& data, std::function<void(std::exception_ptr error)> callback) {
+    if (!is_connected()) throw Exception::NotConnected();
+
+    internal_->write_request_async(
+        service, characteristic, data,
+        [internal = internal_, callback = std::move(callback)](std::exception_ptr error) { callback(error); });
+}
+
+std::future<void> Peripheral::write_request_async(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                                                  ByteArray const& data) {
+    auto promise = std::make_shared<std::promise<void>>();
+    write_request_async(service, characteristic, data, [promise](std::exception_ptr error) {
+        if (error) {
+            promise->set_exception(error);
+        } else {
+            promise->set_value();
+        }
+    });
+    return promise->get_future();
+}
+
+void Peripheral::write_command_async(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                                     ByteArray const& data, std::function<void(std::exception_ptr error)> callback) {
+    if (!is_connected()) throw Exception::NotConnected();
+
+    internal_->write_command_async(
+        service, characteristic, data,
+        [internal = internal_, callback = std::move(callback)](std::exception_ptr error) { callback(error); });
+}
+
+std::future<void> Peripheral::write_command_async(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                                                  ByteArray const& data) {
+    auto promise = std::make_shared<std::promise<void>>();
+    write_command_async(service, characteristic, data, [promise](std::exception_ptr error) {
+        if (error) {
+            promise->set_exception(error);
+        } else {
+            promise->set_value();
+        }
+    });
+    return promise->get_future();
+}
+
+void Peripheral::read_async(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                            BluetoothUUID const& descriptor,
+                            std::function<void(ByteArray value, std::exception_ptr error)> callback) {
+    if (!is_connected()) throw Exception::NotConnected();
+
+    internal_->read_async(service, characteristic, descriptor,
+                          [internal = internal_, callback = std::move(callback)](ByteArray value, std::exception_ptr error) {
+                              callback(std::move(value), error);
+                          });
+}
+
+std::future<ByteArray> Peripheral::read_async(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                                              BluetoothUUID const& descriptor) {
+    auto promise = std::make_shared<std::promise<ByteArray>>();
+    read_async(service, characteristic, descriptor, [promise](ByteArray value, std::exception_ptr error) {
+        if (error) {
+            promise->set_exception(error);
+        } else {
+            promise->set_value(std::move(value));
+        }
+    });
+    return promise->get_future();
+}
+
+void Peripheral::write_async(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                             BluetoothUUID const& descriptor, ByteArray const& data,
+                             std::function<void(std::exception_ptr error)> callback) {
+    if (!is_connected()) throw Exception::NotConnected();
+
+    internal_->write_async(
+        service, characteristic, descriptor, data,
+        [internal = internal_, callback = std::move(callback)](std::exception_ptr error) { callback(error); });
+}
+
+std::future<void> Peripheral::write_async(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                                          BluetoothUUID const& descriptor, ByteArray const& data) {
+    auto promise = std::make_shared<std::promise<void>>();
+    write_async(service, characteristic, descriptor, data, [promise](std::exception_ptr error) {
+        if (error) {
+            promise->set_exception(error);
+        } else {
+            promise->set_value();
+        }
+    });
+    return promise->get_future();
+}
+
+WriteStream Peripheral::open_write_stream(BluetoothUUID const& service, BluetoothUUID const& characteristic) {
+    if (!is_connected()) throw Exception::NotConnected();
+
+    auto stream = internal_->open_write_stream(service, characteristic);
+    if (!stream) {
+        stream = std::make_shared<WriteStreamCommand>(internal_, service, characteristic);
+    }
+    return Factory::build(stream);
+}
+
+NotificationQueue Peripheral::notify_queue(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                                           size_t capacity, OverflowPolicy policy) {
+    if (!is_connected()) throw Exception::NotConnected();
+
+    auto queue = std::make_shared<NotificationQueueBase>(internal_, service, characteristic, capacity, policy);
+    queue->open();
+    return Factory::build(queue);
+}
+
 void Peripheral::set_callback_on_connected(std::function<void()> on_connected) {
     (*this)->set_callback_on_connected(std::move(on_connected));
 }
@@ -0,0 +1,29 @@
+#include <simpleble/WriteStream.h>
+
+#include "WriteStreamBase.h"
+
+using namespace SimpleBLE;
+
+bool WriteStream::initialized() const { return internal_ != nullptr; }
+
+WriteStreamBase* WriteStream::operator->() {
+    if (!initialized()) throw Exception::NotInitialized();
+
+    return internal_.get();
+}
+
+const WriteStreamBase* WriteStream::operator->() const {
+    if (!initialized()) throw Exception::NotInitialized();
+
+    return internal_.get();
+}
+
+uint16_t WriteStream::mtu() { return (*this)->mtu(); }
+
+size_t WriteStream::write(ByteArray const& data) { return (*this)->write(data); }
+
+bool WriteStream::wait_writable(int timeout_ms) { return (*this)->wait_writable(timeout_ms); }
+
+bool WriteStream::is_open() { return (*this)->is_open(); }
+
+void WriteStream::close() { (*this)->close(); }
@@ -76,6 +76,15 @@ std::optional<std::vector<SPeripheral>> SAdapter::scan_get_results() noexcept {
     return std::nullopt;
 }
 
+bool SAdapter::set_scan_filter(const ScanFilter& filter) noexcept {
+    try {
+        internal_.set_scan_filter(filter);
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
 std::optional<std::vector<SPeripheral>> SAdapter::get_paired_peripherals() noexcept {
     try {
         std::vector<SPeripheral> r;
@@ -126,6 +135,43 @@ bool SAdapter::set_callback_on_scan_found(std::function<void(SPeripheral)> on_sc
     }
 }
 
+bool SAdapter::set_callback_on_scan_updated_batch(
+    std::function<void(std::vector<ScanUpdate>)> on_scan_updated_batch, int interval_ms) noexcept {
+    try {
+        internal_.set_callback_on_scan_updated_batch(std::move(on_scan_updated_batch), interval_ms);
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+bool SAdapter::set_scan_cache_limits(size_t max_entries, int ttl_ms) noexcept {
+    try {
+        internal_.set_scan_cache_limits(max_entries, ttl_ms);
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+bool SAdapter::set_scan_cache_pinned(BluetoothAddress address, bool pinned) noexcept {
+    try {
+        internal_.set_scan_cache_pinned(address, pinned);
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+bool SAdapter::set_callback_on_scan_lost(std::function<void(SPeripheral)> on_scan_lost) noexcept {
+    try {
+        internal_.set_callback_on_scan_lost([on_scan_lost = std::move(on_scan_lost)](auto p) { on_scan_lost(p); });
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
 // NOTE: this should be the implementation once per-adapters are supported
 /*
 std::optional<bool> SAdapter::bluetooth_enabled() noexcept {
@@ -156,3 +202,11 @@ std::optional<std::vector<SAdapter>> SAdapter::get_adapters() noexcept {
         return std::nullopt;
     }
 }
+
+std::optional<SAdapter> SAdapter::aggregate(std::vector<UAdapter> adapters) noexcept {
+    try {
+        return SAdapter(UAdapter::aggregate(std::move(adapters)));
+    } catch (...) {
+        return std::nullopt;
+    }
+}
@@ -115,6 +115,14 @@ std::optional<std::map<uint16_t, SimpleBLE::ByteArray>> SPeripheral::manufacture
     }
 }
 
+std::optional<std::vector<SimpleBLE::PeripheralSighting>> SPeripheral::sightings() noexcept {
+    try {
+        return internal_.sightings();
+    } catch (...) {
+        return std::nullopt;
+    }
+}
+
 std::optional<std::vector<SimpleBLE::Service>> SPeripheral::services() noexcept {
     try {
         return internal_.services();
@@ -200,6 +208,147 @@ bool SPeripheral::write(BluetoothUUID const& service, BluetoothUUID const& chara
     }
 }
 
+std::optional<SimpleBLE::CharacteristicHandle> SPeripheral::resolve(BluetoothUUID const& service,
+                                                                   BluetoothUUID const& characteristic) noexcept {
+    try {
+        return internal_.resolve(service, characteristic);
+    } catch (...) {
+        return std::nullopt;
+    }
+}
+
+std::optional<SimpleBLE::ByteArray> SPeripheral::read(CharacteristicHandle const& handle) noexcept {
+    try {
+        return internal_.read(handle);
+    } catch (...) {
+        return std::nullopt;
+    }
+}
+
+bool SPeripheral::write_request(CharacteristicHandle const& handle, ByteArray const& data) noexcept {
+    try {
+        internal_.write_request(handle, data);
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+bool SPeripheral::write_command(CharacteristicHandle const& handle, ByteArray const& data) noexcept {
+    try {
+        internal_.write_command(handle, data);
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+bool SPeripheral::notify(CharacteristicHandle const& handle, std::function<void(ByteArray payload)> callback) noexcept {
+    try {
+        internal_.notify(handle, std::move(callback));
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+bool SPeripheral::indicate(CharacteristicHandle const& handle,
+                           std::function<void(ByteArray payload)> callback) noexcept {
+    try {
+        internal_.indicate(handle, std::move(callback));
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+bool SPeripheral::unsubscribe(CharacteristicHandle const& handle) noexcept {
+    try {
+        internal_.unsubscribe(handle);
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+bool SPeripheral::read_async(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                             std::function<void(std::optional<ByteArray> value)> callback) noexcept {
+    try {
+        internal_.read_async(service, characteristic, [callback](ByteArray value, std::exception_ptr error) {
+            callback(error ? std::nullopt : std::optional<ByteArray>(std::move(value)));
+        });
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+bool SPeripheral::write_request_async(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                                      ByteArray const& data, std::function<void(bool success)> callback) noexcept {
+    try {
+        internal_.write_request_async(service, characteristic, data,
+                                      [callback](std::exception_ptr error) { callback(!error); });
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+bool SPeripheral::write_command_async(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                                      ByteArray const& data, std::function<void(bool success)> callback) noexcept {
+    try {
+        internal_.write_command_async(service, characteristic, data,
+                                      [callback](std::exception_ptr error) { callback(!error); });
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+bool SPeripheral::read_async(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                             BluetoothUUID const& descriptor,
+                             std::function<void(std::optional<ByteArray> value)> callback) noexcept {
+    try {
+        internal_.read_async(service, characteristic, descriptor, [callback](ByteArray value, std::exception_ptr error) {
+            callback(error ? std::nullopt : std::optional<ByteArray>(std::move(value)));
+        });
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+bool SPeripheral::write_async(BluetoothUUID const& service, BluetoothUUID const& characteristic,
+                              BluetoothUUID const& descriptor, ByteArray const& data,
+                              std::function<void(bool success)> callback) noexcept {
+    try {
+        internal_.write_async(service, characteristic, descriptor, data,
+                              [callback](std::exception_ptr error) { callback(!error); });
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+std::optional<SimpleBLE::WriteStream> SPeripheral::open_write_stream(BluetoothUUID const& service,
+                                                                     BluetoothUUID const& characteristic) noexcept {
+    try {
+        return internal_.open_write_stream(service, characteristic);
+    } catch (...) {
+        return std::nullopt;
+    }
+}
+
+std::optional<SimpleBLE::NotificationQueue> SPeripheral::notify_queue(BluetoothUUID const& service,
+                                                                      BluetoothUUID const& characteristic,
+                                                                      size_t capacity, OverflowPolicy policy) noexcept {
+    try {
+        return internal_.notify_queue(service, characteristic, capacity, policy);
+    } catch (...) {
+        return std::nullopt;
+    }
+}
+
 bool SPeripheral::set_callback_on_connected(std::function<void()> on_connected) noexcept {
     try {
         internal_.set_callback_on_connected(std::move(on_connected));
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <simpleble/Adapter.h>
+
+#include "AdapterPlain.h"
+#include "BuilderBase.h"
+#include "PeripheralPlain.h"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+
+namespace SimpleBLE {
+
+/**
+ * Plain peripheral whose address and advertising data are set by the test.
+ */
+class FakePeripheral : public PeripheralPlain {
+  public:
+    explicit FakePeripheral(BluetoothAddress address) : address_(std::move(address)) {}
+
+    BluetoothAddress address() override { return address_; }
+    std::string identifier() override { return "Fake " + address_; }
+
+    int16_t rssi() override {
+        std::scoped_lock lock(mutex_);
+        return rssi_;
+    }
+
+    int16_t tx_power() override {
+        std::scoped_lock lock(mutex_);
+        return tx_power_.value_or(INT16_MIN);
+    }
+
+    bool has_tx_power() override {
+        std::scoped_lock lock(mutex_);
+        return tx_power_.has_value();
+    }
+
+    std::map<uint16_t, ByteArray> manufacturer_data() override {
+        std::scoped_lock lock(mutex_);
+        return manufacturer_data_;
+    }
+
+    void set_rssi(int16_t rssi) {
+        std::scoped_lock lock(mutex_);
+        rssi_ = rssi;
+    }
+
+    void set_tx_power(std::optional<int16_t> tx_power) {
+        std::scoped_lock lock(mutex_);
+        tx_power_ = tx_power;
+    }
+
+    void set_manufacturer_data(std::map<uint16_t, ByteArray> manufacturer_data) {
+        std::scoped_lock lock(mutex_);
+        manufacturer_data_ = std::move(manufacturer_data);
+    }
+
+  private:
+    BluetoothAddress address_;
+    std::mutex mutex_;
+    int16_t rssi_ = -60;
+    std::optional<int16_t> tx_power_;
+    std::map<uint16_t, ByteArray> manufacturer_data_;
+};
+
+/**
+ * Plain adapter that reports advertisements on demand, going through the same steps as a real backend.
+ */
+class FakeAdapter : public AdapterPlain {
+  public:
+    void advertise(const std::shared_ptr<PeripheralBase>& peripheral) {
+        scan_cache_touch(peripheral);
+        if (!scan_filter_accepts(*peripheral)) return;
+
+        bool duplicate = scan_filter_is_duplicate(*peripheral);
+        bool first_seen;
+        {
+            std::scoped_lock lock(mutex_);
+            first_seen = seen_.insert(peripheral->address()).second;
+        }
+
+        if (first_seen) {
+            scan_found(peripheral);
+        } else if (!duplicate) {
+            scan_updated(peripheral);
+        }
+    }
+
+    /**
+     * Wrap the adapter in a frontend object, as returned by Adapter::get_adapters().
+     */
+    static Adapter frontend(const std::shared_ptr<FakeAdapter>& adapter) {
+        return Factory::build(std::static_pointer_cast<AdapterBase>(adapter));
+    }
+
+  protected:
+    void scan_cache_evict(const BluetoothAddress& address, const std::shared_ptr<PeripheralBase>& peripheral) override {
+        std::scoped_lock lock(mutex_);
+        seen_.erase(address);
+    }
+
+  private:
+    std::mutex mutex_;
+    std::set<BluetoothAddress> seen_;
+};
+
+}  // namespace SimpleBLE
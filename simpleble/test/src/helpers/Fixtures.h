@@ -0,0 +1,106 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <simpleble/Adapter.h>
+
+#include "FakeAdapter.h"
+
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace SimpleBLE {
+
+/**
+ * Records what an adapter reports while scanning.
+ */
+class ScanRecorderTest : public ::testing::Test {
+  protected:
+    void watch(Adapter& watched) {
+        watched.set_scan_filter(ScanFilter());
+        watched.set_callback_on_scan_found([this](Peripheral peripheral) { found.push_back(peripheral.address()); });
+        watched.set_callback_on_scan_updated([this](Peripheral peripheral) { updated++; });
+        watched.set_callback_on_scan_lost([this](Peripheral peripheral) { lost.push_back(peripheral.address()); });
+    }
+
+    Adapter adapter;
+    std::vector<BluetoothAddress> found;
+    std::vector<BluetoothAddress> lost;
+    int updated = 0;
+};
+
+/**
+ * The first adapter of the plain backend, which reports a single peripheral, "Plain Peripheral" at
+ * 11:22:33:44:55:66, with an RSSI of -60 dBm, a TX power of 5 dBm and no advertised services. Every scan reports
+ * it as found and then as updated, with identical data.
+ */
+class PlainAdapterTest : public ScanRecorderTest {
+  protected:
+    void SetUp() override {
+        auto adapters = Adapter::get_adapters();
+        ASSERT_FALSE(adapters.empty());
+        adapter = adapters.at(0);
+        watch(adapter);
+    }
+
+    void TearDown() override {
+        adapter.set_callback_on_scan_updated_batch(nullptr);
+        adapter.set_callback_on_scan_lost(nullptr);
+        adapter.set_scan_cache_limits(0, 0);
+    }
+
+    void scan(int times = 1) {
+        for (int i = 0; i < times; i++) {
+            adapter.scan_start();
+            adapter.scan_stop();
+        }
+    }
+};
+
+/**
+ * A FakeAdapter, on which the test decides which peripherals advertise and with what data.
+ */
+class FakeAdapterTest : public ScanRecorderTest {
+  protected:
+    void SetUp() override {
+        backend = std::make_shared<FakeAdapter>();
+        adapter = FakeAdapter::frontend(backend);
+        watch(adapter);
+    }
+
+    std::shared_ptr<FakePeripheral> advertise(const BluetoothAddress& address) {
+        auto& peripheral = peripherals[address];
+        if (!peripheral) peripheral = std::make_shared<FakePeripheral>(address);
+        backend->advertise(peripheral);
+        return peripheral;
+    }
+
+    std::shared_ptr<FakeAdapter> backend;
+    std::map<BluetoothAddress, std::shared_ptr<FakePeripheral>> peripherals;
+};
+
+/**
+ * The peripheral of the plain backend, which is shared by all adapters and starts out disconnected.
+ */
+class PlainPeripheralTest : public ::testing::Test {
+  protected:
+    // The battery level characteristic, the only one exposed by the plain peripheral.
+    static inline const BluetoothUUID SERVICE = "0000180f-0000-1000-8000-00805f9b34fb";
+    static inline const BluetoothUUID CHARACTERISTIC = "00002a19-0000-1000-8000-00805f9b34fb";
+
+    void SetUp() override {
+        auto adapters = Adapter::get_adapters();
+        ASSERT_FALSE(adapters.empty());
+        auto results = adapters.at(0).scan_get_results();
+        ASSERT_FALSE(results.empty());
+        peripheral = results.at(0);
+
+        // The plain backend hands out the same peripheral every time, so it may still be connected.
+        if (peripheral.is_connected()) peripheral.disconnect();
+    }
+
+    Peripheral peripheral;
+};
+
+}  // namespace SimpleBLE
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include <simpleble/BluetoothUUID.h>
+
+#include <algorithm>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+using namespace SimpleBLE;
+
+static constexpr BluetoothUUID BATTERY_SERVICE = "0000180f-0000-1000-8000-00805f9b34fb";
+
+static_assert(BATTERY_SERVICE == BluetoothUUID("180F"), "short UUIDs are parsed at compile time");
+static_assert(BATTERY_SERVICE.is_short() && BATTERY_SERVICE.uuid32() == 0x180F, "short UUIDs are recognised");
+
+TEST(BluetoothUUIDTest, DefaultIsNil) {
+    BluetoothUUID uuid;
+    EXPECT_TRUE(uuid.is_nil());
+    EXPECT_EQ(uuid, BluetoothUUID(""));
+    EXPECT_EQ(uuid.str(), "00000000-0000-0000-0000-000000000000");
+}
+
+TEST(BluetoothUUIDTest, ShortFormsExpand) {
+    EXPECT_EQ(BluetoothUUID("180f"), BATTERY_SERVICE);
+    EXPECT_EQ(BluetoothUUID("0000180f"), BATTERY_SERVICE);
+    EXPECT_EQ(BluetoothUUID::from_uuid16(0x180F), BATTERY_SERVICE);
+    EXPECT_EQ(BluetoothUUID::from_uuid32(0x0000180F), BATTERY_SERVICE);
+    EXPECT_EQ(BluetoothUUID("12345678").str(), "12345678-0000-1000-8000-00805f9b34fb");
+}
+
+TEST(BluetoothUUIDTest, CaseInsensitive) {
+    BluetoothUUID upper = std::string("6E400001-B5A3-F393-E0A9-E50E24DCCA9E");
+    BluetoothUUID lower = std::string("6e400001-b5a3-f393-e0a9-e50e24dcca9e");
+    EXPECT_EQ(upper, lower);
+    EXPECT_EQ(upper.str(), "6e400001-b5a3-f393-e0a9-e50e24dcca9e");
+    EXPECT_FALSE(upper.is_short());
+}
+
+TEST(BluetoothUUIDTest, AcceptsUndashedForm) {
+    EXPECT_EQ(BluetoothUUID("0000180F00001000800000805F9B34FB"), BATTERY_SERVICE);
+}
+
+TEST(BluetoothUUIDTest, RejectsInvalidText) {
+    EXPECT_THROW(BluetoothUUID("180"), std::invalid_argument);
+    EXPECT_THROW(BluetoothUUID("18g0"), std::invalid_argument);
+    EXPECT_THROW(BluetoothUUID("0000180f-0000-1000-8000_00805f9b34fb"), std::invalid_argument);
+    EXPECT_THROW(BluetoothUUID("0000180f-0000-1000-8000-00805f9b34fb0"), std::invalid_argument);
+}
+
+TEST(BluetoothUUIDTest, BytesRoundTrip) {
+    const uint8_t data[16] = {0x6E, 0x40, 0x00, 0x01, 0xB5, 0xA3, 0xF3, 0x93,
+                              0xE0, 0xA9, 0xE5, 0x0E, 0x24, 0xDC, 0xCA, 0x9E};
+    BluetoothUUID uuid = BluetoothUUID::from_bytes(data);
+    EXPECT_EQ(uuid, BluetoothUUID("6e400001-b5a3-f393-e0a9-e50e24dcca9e"));
+
+    auto bytes = uuid.bytes();
+    EXPECT_TRUE(std::equal(bytes.begin(), bytes.end(), data));
+}
+
+TEST(BluetoothUUIDTest, ConvertsToString) {
+    std::string text = BATTERY_SERVICE;
+    EXPECT_EQ(text, "0000180f-0000-1000-8000-00805f9b34fb");
+
+    std::ostringstream stream;
+    stream << BATTERY_SERVICE;
+    EXPECT_EQ(stream.str(), text);
+}
+
+TEST(BluetoothUUIDTest, UsableAsKey) {
+    std::unordered_map<BluetoothUUID, int> hashed;
+    std::map<BluetoothUUID, int> ordered;
+    for (uint16_t i = 0; i < 0x2000; i++) {
+        hashed[BluetoothUUID::from_uuid16(i)] = i;
+        ordered[BluetoothUUID::from_uuid16(i)] = i;
+    }
+
+    EXPECT_EQ(hashed.size(), 0x2000);
+    EXPECT_EQ(ordered.size(), 0x2000);
+    EXPECT_EQ(hashed.at("180f"), 0x180F);
+    EXPECT_EQ(ordered.at("180F"), 0x180F);
+    EXPECT_EQ(ordered.begin()->first, BluetoothUUID::from_uuid16(0));
+}
@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+
+#include <simpleble/Adapter.h>
+#include <simpleble/PeripheralSafe.h>
+
+#include "helpers/Fixtures.h"
+
+using namespace SimpleBLE;
+
+using CharacteristicHandleTest = PlainPeripheralTest;
+
+TEST_F(CharacteristicHandleTest, RequiresConnection) {
+    EXPECT_THROW(peripheral.resolve(SERVICE, CHARACTERISTIC), Exception::NotConnected);
+
+    CharacteristicHandle handle;
+    EXPECT_FALSE(handle.initialized());
+    EXPECT_FALSE(handle.is_valid());
+    EXPECT_THROW(handle.service(), Exception::NotInitialized);
+}
+
+TEST_F(CharacteristicHandleTest, OperatesThroughHandle) {
+    peripheral.connect();
+    CharacteristicHandle handle = peripheral.resolve(SERVICE, CHARACTERISTIC);
+    ASSERT_TRUE(handle.is_valid());
+    EXPECT_EQ(handle.service(), SERVICE);
+    EXPECT_EQ(handle.characteristic(), CHARACTERISTIC);
+
+    for (int i = 0; i < 1000; i++) {
+        peripheral.write_command(handle, ByteArray("x"));
+    }
+    EXPECT_NO_THROW(peripheral.write_request(handle, ByteArray("x")));
+    EXPECT_TRUE(peripheral.read(handle).empty());
+    EXPECT_NO_THROW(peripheral.notify(handle, [](ByteArray) {}));
+    EXPECT_NO_THROW(peripheral.unsubscribe(handle));
+}
+
+TEST_F(CharacteristicHandleTest, InvalidatedOnDisconnect) {
+    peripheral.connect();
+    CharacteristicHandle handle = peripheral.resolve(SERVICE, CHARACTERISTIC);
+    peripheral.disconnect();
+    EXPECT_FALSE(handle.is_valid());
+
+    // Reconnecting does not bring the handle back, it has to be resolved again.
+    peripheral.connect();
+    EXPECT_THROW(peripheral.read(handle), Exception::InvalidReference);
+    EXPECT_THROW(peripheral.write_command(handle, ByteArray("x")), Exception::InvalidReference);
+    EXPECT_THROW(peripheral.notify(handle, [](ByteArray) {}), Exception::InvalidReference);
+
+    handle = peripheral.resolve(SERVICE, CHARACTERISTIC);
+    EXPECT_NO_THROW(peripheral.read(handle));
+}
+
+TEST_F(CharacteristicHandleTest, SafeReportsFailure) {
+    Safe::Peripheral safe(peripheral);
+    EXPECT_FALSE(safe.resolve(SERVICE, CHARACTERISTIC).has_value());
+
+    peripheral.connect();
+    auto handle = safe.resolve(SERVICE, CHARACTERISTIC);
+    ASSERT_TRUE(handle.has_value());
+    EXPECT_TRUE(safe.write_command(*handle, ByteArray("x")));
+
+    peripheral.disconnect();
+    EXPECT_FALSE(safe.read(*handle).has_value());
+    EXPECT_FALSE(safe.write_request(*handle, ByteArray("x")));
+}
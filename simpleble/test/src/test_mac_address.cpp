@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+
+#include <simpleble/MacAddress.h>
+
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+using namespace SimpleBLE;
+
+static constexpr MacAddress ADDRESS = "12:34:56:78:9A:BC";
+
+static_assert(ADDRESS.value() == 0x123456789ABC, "addresses are parsed at compile time");
+static_assert(ADDRESS == MacAddress("12:34:56:78:9a:bc"), "parsing ignores case");
+
+TEST(MacAddressTest, DefaultIsZero) {
+    MacAddress address;
+    EXPECT_EQ(address.value(), 0);
+    EXPECT_EQ(address.str(), "00:00:00:00:00:00");
+}
+
+TEST(MacAddressTest, FormatsUppercase) {
+    EXPECT_EQ(MacAddress("aa:bb:cc:dd:ee:ff").str(), "AA:BB:CC:DD:EE:FF");
+
+    std::string text = ADDRESS;
+    EXPECT_EQ(text, "12:34:56:78:9A:BC");
+}
+
+TEST(MacAddressTest, KeepsOnlyFortyEightBits) {
+    EXPECT_EQ(MacAddress(0xFFFF123456789ABC), ADDRESS);
+}
+
+TEST(MacAddressTest, RejectsInvalidText) {
+    EXPECT_THROW(MacAddress(""), std::invalid_argument);
+    EXPECT_THROW(MacAddress("12:34:56:78:9A"), std::invalid_argument);
+    EXPECT_THROW(MacAddress("12-34-56-78-9A-BC"), std::invalid_argument);
+    EXPECT_THROW(MacAddress("12:34:56:78:9A:BG"), std::invalid_argument);
+
+    EXPECT_FALSE(MacAddress::try_parse("12:34:56:78:9A:BG"));
+    EXPECT_FALSE(MacAddress::try_parse("A1B2C3D4-E5F6-0718-293A-4B5C6D7E8F90"));
+    EXPECT_EQ(MacAddress::try_parse("12:34:56:78:9a:bc"), ADDRESS);
+}
+
+TEST(MacAddressTest, BytesRoundTrip) {
+    const uint8_t data[6] = {0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC};
+    EXPECT_EQ(MacAddress::from_bytes(data), ADDRESS);
+
+    auto bytes = ADDRESS.bytes();
+    EXPECT_TRUE(std::equal(bytes.begin(), bytes.end(), data));
+}
+
+TEST(MacAddressTest, UsableAsKey) {
+    std::unordered_map<MacAddress, int> hashed;
+    std::map<MacAddress, int> ordered;
+    for (int i = 0; i < 1000; i++) {
+        hashed[MacAddress(0xC0FFEE000000 + i)] = i;
+        ordered[MacAddress(0xC0FFEE000000 + i)] = i;
+    }
+
+    EXPECT_EQ(hashed.size(), 1000);
+    EXPECT_EQ(ordered.size(), 1000);
+    EXPECT_EQ(hashed.at("C0:FF:EE:00:01:00"), 0x100);
+    EXPECT_EQ(ordered.at("c0:ff:ee:00:01:00"), 0x100);
+    EXPECT_EQ(ordered.rbegin()->first, MacAddress("C0:FF:EE:00:03:E7"));
+}
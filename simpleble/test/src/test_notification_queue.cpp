@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+
+#include <simpleble/Adapter.h>
+#include <simpleble/PeripheralSafe.h>
+
+#include "helpers/Fixtures.h"
+
+#include "NotificationRing.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace SimpleBLE;
+using namespace std::chrono_literals;
+
+using NotificationQueueTest = PlainPeripheralTest;
+
+TEST_F(NotificationQueueTest, RequiresConnection) {
+    EXPECT_THROW(peripheral.notify_queue(SERVICE, CHARACTERISTIC, 8), Exception::NotConnected);
+
+    NotificationQueue queue;
+    EXPECT_FALSE(queue.initialized());
+    EXPECT_THROW(queue.size(), Exception::NotInitialized);
+}
+
+TEST_F(NotificationQueueTest, SafeReportsFailure) {
+    Safe::Peripheral safe(peripheral);
+    EXPECT_FALSE(safe.notify_queue(SERVICE, CHARACTERISTIC, 8).has_value());
+
+    peripheral.connect();
+    auto queue = safe.notify_queue(SERVICE, CHARACTERISTIC, 8);
+    ASSERT_TRUE(queue.has_value());
+    queue->close();
+}
+
+static Notification numbered(uint32_t value) {
+    ByteArray payload(reinterpret_cast<const uint8_t*>(&value), sizeof(value));
+    return Notification{payload, std::chrono::steady_clock::now()};
+}
+
+static uint32_t number(const Notification& notification) {
+    uint32_t value = 0;
+    std::memcpy(&value, notification.payload.data(), sizeof(value));
+    return value;
+}
+
+TEST(NotificationRingTest, KeepsOrder) {
+    NotificationRing ring(4, OverflowPolicy::DROP_OLDEST);
+    for (uint32_t i = 0; i < 3; i++) EXPECT_TRUE(ring.push(numbered(i)));
+    EXPECT_EQ(ring.size(), 3);
+
+    Notification notification;
+    for (uint32_t i = 0; i < 3; i++) {
+        ASSERT_TRUE(ring.pop(notification));
+        EXPECT_EQ(number(notification), i);
+    }
+    EXPECT_FALSE(ring.pop(notification));
+    EXPECT_EQ(ring.dropped(), 0);
+}
+
+TEST(NotificationRingTest, DropOldestKeepsLatest) {
+    NotificationRing ring(2, OverflowPolicy::DROP_OLDEST);
+    for (uint32_t i = 0; i < 5; i++) EXPECT_TRUE(ring.push(numbered(i)));
+    EXPECT_EQ(ring.size(), 2);
+    EXPECT_EQ(ring.dropped(), 3);
+
+    Notification notification;
+    ASSERT_TRUE(ring.pop(notification));
+    EXPECT_EQ(number(notification), 3);
+    ASSERT_TRUE(ring.pop(notification));
+    EXPECT_EQ(number(notification), 4);
+}
+
+TEST(NotificationRingTest, DropNewestKeepsEarliest) {
+    NotificationRing ring(1, OverflowPolicy::DROP_NEWEST);
+    EXPECT_TRUE(ring.push(numbered(0)));
+    EXPECT_FALSE(ring.push(numbered(1)));
+    EXPECT_EQ(ring.dropped(), 1);
+
+    Notification notification;
+    ASSERT_TRUE(ring.pop(notification));
+    EXPECT_EQ(number(notification), 0);
+}
+
+TEST(NotificationRingTest, CloseWakesWaiter) {
+    NotificationRing ring(4, OverflowPolicy::DROP_OLDEST);
+    std::thread closer([&ring]() {
+        std::this_thread::sleep_for(50ms);
+        ring.close();
+    });
+
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(ring.wait_for(5000));
+    EXPECT_LT(std::chrono::steady_clock::now() - start, 2500ms);
+    closer.join();
+
+    EXPECT_FALSE(ring.is_open());
+    EXPECT_FALSE(ring.close());
+    EXPECT_FALSE(ring.push(numbered(0)));
+    EXPECT_EQ(ring.dropped(), 0);
+}
+
+// Every notification is either consumed exactly once or counted as dropped, and each producer's notifications
+// come out in the order they were pushed.
+static void run_producers_and_consumers(OverflowPolicy policy) {
+    constexpr uint32_t PRODUCERS = 4;
+    constexpr uint32_t PER_PRODUCER = 20000;
+
+    NotificationRing ring(16, policy);
+    std::atomic<uint64_t> consumed{0};
+    std::atomic<uint32_t> producers_done{0};
+    std::vector<std::vector<uint32_t>> last_seen(2, std::vector<uint32_t>(PRODUCERS, 0));
+    std::atomic<bool> ordered{true};
+
+    std::vector<std::thread> producers;
+    for (uint32_t p = 0; p < PRODUCERS; p++) {
+        producers.emplace_back([&ring, &producers_done, p]() {
+            for (uint32_t i = 1; i <= PER_PRODUCER; i++) ring.push(numbered((p << 24) | i));
+            producers_done++;
+        });
+    }
+
+    std::vector<std::thread> consumers;
+    for (size_t c = 0; c < 2; c++) {
+        consumers.emplace_back([&, c]() {
+            Notification notification;
+            while (true) {
+                if (ring.pop(notification)) {
+                    uint32_t value = number(notification);
+                    uint32_t& last = last_seen[c][value >> 24];
+                    if ((value & 0xFFFFFF) <= last) ordered = false;
+                    last = value & 0xFFFFFF;
+                    consumed++;
+                } else if (producers_done == PRODUCERS) {
+                    if (!ring.pop(notification)) break;
+                    consumed++;
+                } else {
+                    ring.wait_for(10);
+                }
+            }
+        });
+    }
+
+    for (auto& producer : producers) producer.join();
+    for (auto& consumer : consumers) consumer.join();
+
+    EXPECT_TRUE(ordered);
+    EXPECT_EQ(consumed + ring.dropped(), uint64_t(PRODUCERS) * PER_PRODUCER);
+    EXPECT_EQ(ring.size(), 0);
+}
+
+TEST(NotificationRingTest, ConcurrentDropOldest) { run_producers_and_consumers(OverflowPolicy::DROP_OLDEST); }
+
+TEST(NotificationRingTest, ConcurrentDropNewest) { run_producers_and_consumers(OverflowPolicy::DROP_NEWEST); }
@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include <simpleble/Adapter.h>
+#include <simpleble/PeripheralSafe.h>
+
+#include "helpers/Fixtures.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <vector>
+
+using namespace SimpleBLE;
+using namespace std::chrono_literals;
+
+static const BluetoothUUID DESCRIPTOR = "00002902-0000-1000-8000-00805f9b34fb";
+
+// The plain backend completes everything through the default implementation on the shared worker pool.
+using PeripheralAsyncTest = PlainPeripheralTest;
+
+TEST_F(PeripheralAsyncTest, RequiresConnection) {
+    EXPECT_THROW(peripheral.read_async(SERVICE, CHARACTERISTIC), Exception::NotConnected);
+    EXPECT_THROW(peripheral.write_request_async(SERVICE, CHARACTERISTIC, ByteArray("x")), Exception::NotConnected);
+    EXPECT_THROW(peripheral.write_async(SERVICE, CHARACTERISTIC, DESCRIPTOR, ByteArray("x"), [](std::exception_ptr) {}),
+                 Exception::NotConnected);
+}
+
+TEST_F(PeripheralAsyncTest, FuturesResolve) {
+    peripheral.connect();
+
+    auto read = peripheral.read_async(SERVICE, CHARACTERISTIC);
+    auto write_request = peripheral.write_request_async(SERVICE, CHARACTERISTIC, ByteArray("x"));
+    auto write_command = peripheral.write_command_async(SERVICE, CHARACTERISTIC, ByteArray("x"));
+    auto descriptor_read = peripheral.read_async(SERVICE, CHARACTERISTIC, DESCRIPTOR);
+    auto descriptor_write = peripheral.write_async(SERVICE, CHARACTERISTIC, DESCRIPTOR, ByteArray("x"));
+
+    ASSERT_EQ(read.wait_for(1s), std::future_status::ready);
+    EXPECT_TRUE(read.get().empty());
+    ASSERT_EQ(write_request.wait_for(1s), std::future_status::ready);
+    EXPECT_NO_THROW(write_request.get());
+    ASSERT_EQ(write_command.wait_for(1s), std::future_status::ready);
+    EXPECT_NO_THROW(write_command.get());
+    ASSERT_EQ(descriptor_read.wait_for(1s), std::future_status::ready);
+    EXPECT_NO_THROW(descriptor_read.get());
+    ASSERT_EQ(descriptor_write.wait_for(1s), std::future_status::ready);
+    EXPECT_NO_THROW(descriptor_write.get());
+}
+
+// Operations of one peripheral complete in the order they were issued, however many are in flight.
+TEST_F(PeripheralAsyncTest, PipelinedInOrder) {
+    peripheral.connect();
+
+    const int count = 500;
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<int> completed;
+    int failures = 0;
+
+    for (int i = 0; i < count; i++) {
+        auto done = [&, i](std::exception_ptr error) {
+            std::scoped_lock lock(mutex);
+            if (error) failures++;
+            completed.push_back(i);
+            cv.notify_all();
+        };
+
+        if (i % 2 == 0) {
+            peripheral.write_command_async(SERVICE, CHARACTERISTIC, ByteArray("x"), done);
+        } else {
+            peripheral.read_async(SERVICE, CHARACTERISTIC,
+                                  [done](ByteArray value, std::exception_ptr error) { done(error); });
+        }
+    }
+
+    std::unique_lock lock(mutex);
+    ASSERT_TRUE(cv.wait_for(lock, 5s, [&]() { return completed.size() == count; }));
+    EXPECT_EQ(failures, 0);
+    for (int i = 0; i < count; i++) {
+        ASSERT_EQ(completed[i], i);
+    }
+}
+
+TEST_F(PeripheralAsyncTest, SafeReportsFailure) {
+    Safe::Peripheral safe(peripheral);
+    EXPECT_FALSE(safe.read_async(SERVICE, CHARACTERISTIC, [](std::optional<ByteArray>) {}));
+
+    peripheral.connect();
+    std::promise<std::optional<ByteArray>> result;
+    EXPECT_TRUE(safe.read_async(SERVICE, CHARACTERISTIC,
+                                [&result](std::optional<ByteArray> value) { result.set_value(value); }));
+
+    auto future = result.get_future();
+    ASSERT_EQ(future.wait_for(1s), std::future_status::ready);
+    EXPECT_TRUE(future.get().has_value());
+}
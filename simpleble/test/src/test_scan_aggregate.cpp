@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include <simpleble/Adapter.h>
+
+#include "helpers/Fixtures.h"
+
+#include <vector>
+
+using namespace SimpleBLE;
+
+// Every call to get_adapters() on the plain backend returns a new adapter, all of which hear the same peripheral.
+class ScanAggregateTest : public ScanRecorderTest {
+  protected:
+    void SetUp() override {
+        std::vector<Adapter> adapters;
+        for (int i = 0; i < 2; i++) {
+            auto backend_adapters = Adapter::get_adapters();
+            ASSERT_FALSE(backend_adapters.empty());
+            adapters.push_back(backend_adapters.at(0));
+        }
+        adapter = Adapter::aggregate(adapters);
+        watch(adapter);
+    }
+};
+
+TEST_F(ScanAggregateTest, PeripheralsAreMergedByAddress) {
+    adapter.scan_start();
+    adapter.scan_stop();
+
+    // Each adapter reports the peripheral as found and then updated.
+    EXPECT_EQ(found.size(), 1);
+    EXPECT_EQ(updated, 3);
+
+    auto results = adapter.scan_get_results();
+    ASSERT_EQ(results.size(), 1);
+    EXPECT_EQ(results.at(0).address(), "11:22:33:44:55:66");
+    EXPECT_EQ(results.at(0).rssi(), -60);
+
+    auto sightings = results.at(0).sightings();
+    ASSERT_EQ(sightings.size(), 2);
+    for (auto& sighting : sightings) {
+        EXPECT_EQ(sighting.adapter_identifier, "Plain Adapter");
+        EXPECT_EQ(sighting.rssi, -60);
+    }
+}
+
+TEST_F(ScanAggregateTest, ConnectionGoesThroughOneAdapter) {
+    adapter.scan_start();
+    adapter.scan_stop();
+
+    Peripheral peripheral = adapter.scan_get_results().at(0);
+    int connected = 0;
+    int disconnected = 0;
+    peripheral.set_callback_on_connected([&]() { connected++; });
+    peripheral.set_callback_on_disconnected([&]() { disconnected++; });
+
+    peripheral.connect();
+    EXPECT_TRUE(peripheral.is_connected());
+    EXPECT_EQ(peripheral.mtu(), 247);
+    EXPECT_EQ(adapter.get_connected_peripherals().size(), 1);
+
+    peripheral.disconnect();
+    EXPECT_FALSE(peripheral.is_connected());
+    EXPECT_TRUE(adapter.get_connected_peripherals().empty());
+    EXPECT_EQ(connected, 1);
+    EXPECT_EQ(disconnected, 1);
+}
+
+TEST_F(ScanAggregateTest, EmptyAggregateIsRejected) {
+    EXPECT_THROW(Adapter::aggregate({}), Exception::OperationFailed);
+}
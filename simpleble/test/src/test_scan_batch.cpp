@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include <simpleble/Adapter.h>
+
+#include "helpers/Fixtures.h"
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace SimpleBLE;
+using namespace std::chrono_literals;
+
+using ScanBatchTest = PlainAdapterTest;
+
+TEST_F(ScanBatchTest, UnchangedUpdatesAreDropped) {
+    std::vector<ScanUpdate> received;
+    adapter.set_callback_on_scan_updated_batch(
+        [&received](std::vector<ScanUpdate> batch) { received.insert(received.end(), batch.begin(), batch.end()); },
+        10);
+
+    scan(3);
+    std::this_thread::sleep_for(50ms);
+    adapter.set_callback_on_scan_updated_batch(nullptr);
+
+    EXPECT_EQ(found.size(), 3);
+    EXPECT_EQ(updated, 0);
+    EXPECT_TRUE(received.empty());
+}
+
+TEST_F(ScanBatchTest, ClearingBatchCallbackRestoresUpdates) {
+    adapter.set_callback_on_scan_updated_batch([](std::vector<ScanUpdate> batch) {}, 10);
+    scan(1);
+    EXPECT_EQ(updated, 0);
+
+    adapter.set_callback_on_scan_updated_batch(nullptr);
+    scan(2);
+    EXPECT_EQ(found.size(), 3);
+    EXPECT_EQ(updated, 2);
+}
+
+class ScanBatchDiffTest : public FakeAdapterTest {
+  protected:
+    void SetUp() override {
+        FakeAdapterTest::SetUp();
+        adapter.set_callback_on_scan_updated_batch(
+            [this](std::vector<ScanUpdate> batch) {
+                std::scoped_lock lock(mutex);
+                batches.push_back(std::move(batch));
+            },
+            10);
+    }
+
+    void TearDown() override { adapter.set_callback_on_scan_updated_batch(nullptr); }
+
+    // Collects the masks reported for each address, checking that no batch holds an address twice.
+    std::map<BluetoothAddress, std::vector<uint8_t>> received() {
+        // Long enough for any pending updates to go out with the next batch.
+        std::this_thread::sleep_for(50ms);
+
+        std::scoped_lock lock(mutex);
+        std::map<BluetoothAddress, std::vector<uint8_t>> masks;
+        for (auto& batch : batches) {
+            std::map<BluetoothAddress, int> count;
+            for (auto& update : batch) {
+                EXPECT_EQ(++count[update.peripheral.address()], 1);
+                masks[update.peripheral.address()].push_back(update.changed);
+            }
+        }
+        batches.clear();
+        return masks;
+    }
+
+    std::mutex mutex;
+    std::vector<std::vector<ScanUpdate>> batches;
+};
+
+TEST_F(ScanBatchDiffTest, ChangedPeripheralIsReportedOncePerBatch) {
+    advertise("00:00:00:00:00:0A");
+    advertise("00:00:00:00:00:0B");
+    EXPECT_EQ(found.size(), 2);
+
+    for (int16_t rssi = -59; rssi <= -50; rssi++) {
+        peripherals["00:00:00:00:00:0A"]->set_rssi(rssi);
+        advertise("00:00:00:00:00:0A");
+        advertise("00:00:00:00:00:0B");
+    }
+
+    // Updates spread over several batches are reported once in each, always with the field that changed.
+    auto masks = received();
+    EXPECT_EQ(masks.count("00:00:00:00:00:0B"), 0);
+    ASSERT_EQ(masks.count("00:00:00:00:00:0A"), 1);
+    EXPECT_GE(masks["00:00:00:00:00:0A"].size(), 1);
+    for (uint8_t changed : masks["00:00:00:00:00:0A"]) {
+        EXPECT_EQ(changed, ScanUpdate::RSSI);
+    }
+    EXPECT_EQ(updated, 0);
+}
+
+TEST_F(ScanBatchDiffTest, MaskCoversEveryChangedField) {
+    advertise("00:00:00:00:00:0A");
+    advertise("00:00:00:00:00:0B");
+
+    peripherals["00:00:00:00:00:0A"]->set_rssi(-40);
+    peripherals["00:00:00:00:00:0A"]->set_manufacturer_data({{0x004C, ByteArray("a")}});
+    peripherals["00:00:00:00:00:0B"]->set_manufacturer_data({{0x004C, ByteArray("b")}});
+    advertise("00:00:00:00:00:0A");
+    advertise("00:00:00:00:00:0B");
+
+    auto masks = received();
+    EXPECT_EQ(masks["00:00:00:00:00:0A"], std::vector<uint8_t>({ScanUpdate::RSSI | ScanUpdate::MANUFACTURER_DATA}));
+    EXPECT_EQ(masks["00:00:00:00:00:0B"], std::vector<uint8_t>({ScanUpdate::MANUFACTURER_DATA}));
+
+    // The next batch compares against what was reported, so advertising the same data again is suppressed.
+    advertise("00:00:00:00:00:0A");
+    advertise("00:00:00:00:00:0B");
+    EXPECT_TRUE(received().empty());
+}
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+
+#include <simpleble/Adapter.h>
+
+#include "helpers/Fixtures.h"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace SimpleBLE;
+using namespace std::chrono_literals;
+
+using ScanCacheTest = PlainAdapterTest;
+
+TEST_F(ScanCacheTest, PeripheralBeingHeardFromIsKept) {
+    adapter.set_scan_cache_limits(1, 1);
+    for (int i = 0; i < 3; i++) {
+        scan();
+        std::this_thread::sleep_for(5ms);
+    }
+
+    EXPECT_EQ(found.size(), 3);
+    EXPECT_TRUE(lost.empty());
+}
+
+using ScanCacheEvictionTest = FakeAdapterTest;
+
+TEST_F(ScanCacheEvictionTest, OverflowEvictsLeastRecentlyHeardFrom) {
+    adapter.set_scan_cache_limits(2, 0);
+    advertise("00:00:00:00:00:0A");
+    advertise("00:00:00:00:00:0B");
+    advertise("00:00:00:00:00:0C");
+    EXPECT_EQ(lost, std::vector<BluetoothAddress>({"00:00:00:00:00:0A"}));
+
+    // Hearing from B again makes C the least recently heard from.
+    advertise("00:00:00:00:00:0B");
+    advertise("00:00:00:00:00:0D");
+    EXPECT_EQ(lost, std::vector<BluetoothAddress>({"00:00:00:00:00:0A", "00:00:00:00:00:0C"}));
+
+    // An evicted peripheral is found again when it reappears.
+    advertise("00:00:00:00:00:0A");
+    EXPECT_EQ(found.size(), 5);
+    EXPECT_EQ(found.back(), "00:00:00:00:00:0A");
+    EXPECT_EQ(lost.back(), "00:00:00:00:00:0B");
+}
+
+TEST_F(ScanCacheEvictionTest, TtlExpiresStalePeripherals) {
+    adapter.set_scan_cache_limits(0, 20);
+    advertise("00:00:00:00:00:0A");
+    advertise("00:00:00:00:00:0B");
+    advertise("00:00:00:00:00:0A");
+    EXPECT_TRUE(lost.empty());
+
+    std::this_thread::sleep_for(40ms);
+    advertise("00:00:00:00:00:0C");
+    EXPECT_EQ(lost, std::vector<BluetoothAddress>({"00:00:00:00:00:0B", "00:00:00:00:00:0A"}));
+}
+
+TEST_F(ScanCacheEvictionTest, ConnectedAndPinnedAreKept) {
+    adapter.set_scan_cache_limits(1, 0);
+    adapter.set_scan_cache_pinned("00:00:00:00:00:0b", true);
+
+    advertise("00:00:00:00:00:0A")->connect();
+    advertise("00:00:00:00:00:0B");
+    advertise("00:00:00:00:00:0C");
+    advertise("00:00:00:00:00:0D");
+    EXPECT_EQ(lost, std::vector<BluetoothAddress>({"00:00:00:00:00:0C"}));
+
+    peripherals["00:00:00:00:00:0A"]->disconnect();
+    adapter.set_scan_cache_pinned("00:00:00:00:00:0B", false);
+    advertise("00:00:00:00:00:0E");
+    EXPECT_EQ(lost, std::vector<BluetoothAddress>(
+                        {"00:00:00:00:00:0C", "00:00:00:00:00:0A", "00:00:00:00:00:0B", "00:00:00:00:00:0D"}));
+}
+
+TEST_F(ScanCacheEvictionTest, LostOnlyReportsFoundPeripherals) {
+    ScanFilter filter;
+    filter.pattern = "00:00:00:00:00:0A";
+    adapter.set_scan_filter(filter);
+    adapter.set_scan_cache_limits(1, 0);
+
+    advertise("00:00:00:00:00:0A");
+    advertise("00:00:00:00:00:0B");
+    advertise("00:00:00:00:00:0C");
+    EXPECT_EQ(found, std::vector<BluetoothAddress>({"00:00:00:00:00:0A"}));
+    EXPECT_EQ(lost, std::vector<BluetoothAddress>({"00:00:00:00:00:0A"}));
+}
+
+TEST_F(ScanCacheEvictionTest, AddressesOtherThanMacAreKeptAsText) {
+    // macOS identifies peripherals by a UUID, which is pinned regardless of case like a MAC address.
+    adapter.set_scan_cache_limits(1, 0);
+    adapter.set_scan_cache_pinned("a1b2c3d4-e5f6-0718-293a-4b5c6d7e8f90", true);
+
+    advertise("A1B2C3D4-E5F6-0718-293A-4B5C6D7E8F90");
+    advertise("00:00:00:00:00:0A");
+    advertise("B1B2C3D4-E5F6-0718-293A-4B5C6D7E8F90");
+    EXPECT_EQ(lost, std::vector<BluetoothAddress>({"00:00:00:00:00:0A"}));
+    EXPECT_EQ(found.size(), 3);
+}
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+
+#include <simpleble/Adapter.h>
+
+#include "helpers/Fixtures.h"
+
+#include <vector>
+
+using namespace SimpleBLE;
+
+class ScanFilterTest : public PlainAdapterTest {
+  protected:
+    size_t scan(const ScanFilter& filter) {
+        found.clear();
+        updated = 0;
+        adapter.set_scan_filter(filter);
+        PlainAdapterTest::scan();
+        return found.size();
+    }
+};
+
+TEST_F(ScanFilterTest, DefaultFilterReportsEverything) {
+    EXPECT_EQ(scan(ScanFilter()), 1);
+    EXPECT_EQ(found.at(0), "11:22:33:44:55:66");
+    EXPECT_EQ(updated, 1);
+}
+
+TEST_F(ScanFilterTest, PatternMatchesAddressOrNamePrefix) {
+    ScanFilter filter;
+    filter.pattern = "11:22";
+    EXPECT_EQ(scan(filter), 1);
+    filter.pattern = "Plain";
+    EXPECT_EQ(scan(filter), 1);
+    filter.pattern = "Peripheral";
+    EXPECT_EQ(scan(filter), 0);
+}
+
+TEST_F(ScanFilterTest, RssiThreshold) {
+    ScanFilter filter;
+    filter.rssi_threshold = -60;
+    EXPECT_EQ(scan(filter), 1);
+    filter.rssi_threshold = -59;
+    EXPECT_EQ(scan(filter), 0);
+}
+
+TEST_F(ScanFilterTest, PathlossThreshold) {
+    ScanFilter filter;
+    filter.pathloss_threshold = 65;
+    EXPECT_EQ(scan(filter), 1);
+    filter.pathloss_threshold = 64;
+    EXPECT_EQ(scan(filter), 0);
+}
+
+using ScanFilterTxPowerTest = FakeAdapterTest;
+
+TEST_F(ScanFilterTxPowerTest, PathlossNeedsAdvertisedTxPower) {
+    ScanFilter filter;
+    filter.pathloss_threshold = 65;
+    adapter.set_scan_filter(filter);
+
+    // A TX power of 0 dBm is a valid value, only a missing one makes the pathloss unknown.
+    advertise("00:00:00:00:00:0A")->set_tx_power(0);
+    advertise("00:00:00:00:00:0A");
+    advertise("00:00:00:00:00:0B");
+    EXPECT_EQ(found, std::vector<BluetoothAddress>({"00:00:00:00:00:0A"}));
+}
+
+TEST_F(ScanFilterTest, ServiceUuids) {
+    ScanFilter filter;
+    filter.service_uuids = {"0000180f-0000-1000-8000-00805f9b34fb"};
+    EXPECT_EQ(scan(filter), 0);
+    EXPECT_TRUE(adapter.scan_get_results().empty());
+}
+
+TEST_F(ScanFilterTest, DuplicateDataSuppressesUnchangedUpdates) {
+    ScanFilter filter;
+    filter.duplicate_data = false;
+    EXPECT_EQ(scan(filter), 1);
+    EXPECT_EQ(updated, 1);
+
+    // Scanning again under the same filter hears the same manufacturer data.
+    PlainAdapterTest::scan();
+    EXPECT_EQ(found.size(), 2);
+    EXPECT_EQ(updated, 1);
+}
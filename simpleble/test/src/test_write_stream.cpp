@@ -0,0 +1,33 @@
+#include <gtest/gtest.h>
+
+#include <simpleble/Adapter.h>
+
+#include "helpers/Fixtures.h"
+
+#include <string>
+
+using namespace SimpleBLE;
+
+// The plain backend has no dedicated write channel, so streams fall back to write commands.
+using WriteStreamTest = PlainPeripheralTest;
+
+TEST_F(WriteStreamTest, RequiresConnection) {
+    EXPECT_THROW(peripheral.open_write_stream(SERVICE, CHARACTERISTIC), Exception::NotConnected);
+}
+
+TEST_F(WriteStreamTest, FallbackSendsEverything) {
+    peripheral.connect();
+    auto stream = peripheral.open_write_stream(SERVICE, CHARACTERISTIC);
+    ASSERT_TRUE(stream.initialized());
+    EXPECT_TRUE(stream.is_open());
+    EXPECT_EQ(peripheral.mtu(), stream.mtu());
+
+    ByteArray data(std::string(1000, 'x'));
+    EXPECT_EQ(data.size(), stream.write(data));
+    EXPECT_TRUE(stream.wait_writable(0));
+
+    stream.close();
+    EXPECT_FALSE(stream.is_open());
+    EXPECT_FALSE(stream.wait_writable(0));
+    EXPECT_THROW(stream.write(data), Exception::OperationFailed);
+}
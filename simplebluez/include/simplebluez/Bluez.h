@@ -6,6 +6,7 @@
 #include <simplebluez/standard/Agent.h>
 #include <simplebluez/standard/BluezRoot.h>
 #include <simplebluez/standard/CustomRoot.h>
+#include <chrono>
 #include <vector>
 
 namespace SimpleBluez {
@@ -24,6 +25,17 @@ class Bluez {
     void init();
     void run_async();
 
+    /**
+     * Block until there is D-Bus traffic to process (or max_wait elapses) and dispatch it.
+     * Unlike run_async(), this does not require the caller to poll in a tight loop.
+     */
+    void run_async(std::chrono::milliseconds max_wait);
+
+    /**
+     * Wake up a thread blocked in run_async(max_wait).
+     */
+    void wakeup_async();
+
     std::shared_ptr<CustomRoot> root_custom();
     std::shared_ptr<BluezRoot> root_bluez();
 
@@ -2,8 +2,81 @@
 
 #include "kvn/kvn_bytearray.h"
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+
 namespace SimpleBluez {
 
 using ByteArray = kvn::bytearray;
 
-}
+/**
+ * 128-bit UUID held as two halves, most significant first, so that lookups don't have to go through text.
+ */
+struct UUID128 {
+    uint64_t high = 0;
+    uint64_t low = 0;
+
+    /**
+     * Parse the 128-bit text form used by BlueZ, in any case.
+     */
+    static std::optional<UUID128> parse(std::string_view text) {
+        if (text.size() != 36) return std::nullopt;
+
+        UUID128 uuid;
+        size_t digits = 0;
+        for (size_t i = 0; i < text.size(); i++) {
+            char c = text[i];
+            if (i == 8 || i == 13 || i == 18 || i == 23) {
+                if (c != '-') return std::nullopt;
+                continue;
+            }
+
+            uint64_t nibble;
+            if (c >= '0' && c <= '9') {
+                nibble = c - '0';
+            } else if (c >= 'a' && c <= 'f') {
+                nibble = c - 'a' + 10;
+            } else if (c >= 'A' && c <= 'F') {
+                nibble = c - 'A' + 10;
+            } else {
+                return std::nullopt;
+            }
+
+            uint64_t& half = digits < 16 ? uuid.high : uuid.low;
+            half = (half << 4) | nibble;
+            digits++;
+        }
+        return uuid;
+    }
+
+    /**
+     * Format as the lowercase 128-bit text form used by BlueZ.
+     */
+    std::string str() const {
+        static constexpr char HEX[] = "0123456789abcdef";
+
+        std::string text;
+        text.reserve(36);
+        for (size_t i = 0; i < 32; i++) {
+            if (i == 8 || i == 12 || i == 16 || i == 20) text += '-';
+            uint64_t half = i < 16 ? high : low;
+            text += HEX[(half >> (60 - 4 * (i % 16))) & 0x0F];
+        }
+        return text;
+    }
+
+    bool operator==(const UUID128& other) const { return high == other.high && low == other.low; }
+    bool operator!=(const UUID128& other) const { return !(*this == other); }
+
+    struct Hash {
+        size_t operator()(const UUID128& uuid) const {
+            return std::hash<uint64_t>{}(uuid.high ^ (uuid.low * 0x9E3779B97F4A7C15ULL));
+        }
+    };
+};
+
+}  // namespace SimpleBluez
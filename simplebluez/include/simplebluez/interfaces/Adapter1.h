@@ -3,6 +3,8 @@
 #include <simpledbus/advanced/Interface.h>
 #include <simpledbus/advanced/InterfaceRegistry.h>
 
+#include <exception>
+#include <functional>
 #include <optional>
 #include <string>
 #include <vector>
@@ -29,6 +31,13 @@ class Adapter1 : public SimpleDBus::Interface {
 
     // ----- METHODS -----
     void RemoveDevice(std::string device_path);
+
+    /**
+     * Non-blocking form of RemoveDevice(). The callback runs on the thread dispatching the connection once the
+     * reply arrives, with an error reply or timeout passed as the error.
+     */
+    void RemoveDeviceAsync(std::string device_path, std::function<void(std::exception_ptr error)> callback);
+
     void StartDiscovery();
     void StopDiscovery();
     void SetDiscoveryFilter(DiscoveryFilter filter);
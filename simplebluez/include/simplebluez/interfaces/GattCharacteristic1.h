@@ -5,7 +5,10 @@
 
 #include <simplebluez/Types.h>
 
+#include <exception>
+#include <functional>
 #include <string>
+#include <tuple>
 
 namespace SimpleBluez {
 
@@ -22,11 +25,33 @@ class GattCharacteristic1 : public SimpleDBus::Interface {
     void WriteValue(const ByteArray& value, WriteType type);
     ByteArray ReadValue();
 
+    /**
+     * Non-blocking forms of WriteValue() and ReadValue(). The callback runs on the thread dispatching the
+     * connection once the reply arrives, with an error reply or timeout passed as the error.
+     */
+    void WriteValueAsync(const ByteArray& value, WriteType type, std::function<void(std::exception_ptr error)> callback);
+    void ReadValueAsync(std::function<void(ByteArray value, std::exception_ptr error)> callback);
+
+    /**
+     * Returns a SOCK_SEQPACKET socket delivering one notification per packet, together with the MTU
+     * of the link. Notifications stop when the socket is closed.
+     */
+    std::tuple<SimpleDBus::UnixFd, uint16_t> AcquireNotify();
+
+    /**
+     * Returns a SOCK_SEQPACKET socket on which every packet is sent as a write command, together with
+     * the MTU of the link. Writes are no longer accepted once the socket is closed.
+     */
+    std::tuple<SimpleDBus::UnixFd, uint16_t> AcquireWrite();
+
     // ----- PROPERTIES -----
     Property<std::string>& UUID = property<std::string>("UUID");
     Property<SimpleDBus::ObjectPath>& Service = property<SimpleDBus::ObjectPath>("Service");
     Property<ByteArray>& Value = property<ByteArray>("Value");
     Property<bool>& Notifying = property<bool>("Notifying");
+    // BlueZ takes their presence on a local characteristic as support for AcquireNotify and AcquireWrite.
+    Property<bool>& NotifyAcquired = property<bool>("NotifyAcquired").optional();
+    Property<bool>& WriteAcquired = property<bool>("WriteAcquired").optional();
     Property<std::vector<std::string>>& Flags = property<std::vector<std::string>>("Flags", {"read", "write", "notify"});
     Property<uint16_t>& MTU = property<uint16_t>("MTU");
 
@@ -37,6 +62,12 @@ class GattCharacteristic1 : public SimpleDBus::Interface {
     kvn::safe_callback<void()> OnStartNotify;
     kvn::safe_callback<void()> OnStopNotify;
 
+    /**
+     * Called when a client subscribes through AcquireNotify, with the MTU of its link. Returns the socket handed
+     * to BlueZ, or an invalid descriptor to decline, in which case BlueZ falls back to StartNotify.
+     */
+    kvn::safe_callback<SimpleDBus::UnixFd(uint16_t mtu)> OnAcquireNotify;
+
     void message_handle(SimpleDBus::Message& msg) override;
 
   private:
@@ -5,6 +5,8 @@
 
 #include <simplebluez/Types.h>
 
+#include <exception>
+#include <functional>
 #include <string>
 
 namespace SimpleBluez {
@@ -18,6 +20,12 @@ class GattDescriptor1 : public SimpleDBus::Interface {
     void WriteValue(const ByteArray& value);
     ByteArray ReadValue();
 
+    /**
+     * Non-blocking forms of WriteValue() and ReadValue(), see GattCharacteristic1.
+     */
+    void WriteValueAsync(const ByteArray& value, std::function<void(std::exception_ptr error)> callback);
+    void ReadValueAsync(std::function<void(ByteArray value, std::exception_ptr error)> callback);
+
     // ----- PROPERTIES -----
     Property<std::string>& UUID = property<std::string>("UUID");
     Property<ByteArray>& Value = property<ByteArray>("Value");
@@ -5,6 +5,10 @@
 
 #include <simplebluez/interfaces/LEAdvertisement1.h>
 #include <simpledbus/interfaces/ObjectManager.h>
+#include <simpledbus/interfaces/Properties.h>
+
+#include <string>
+#include <vector>
 
 namespace SimpleBluez {
 
@@ -69,6 +73,18 @@ class Advertisement : public SimpleDBus::Proxy {
     bool include_tx_power();
     void include_tx_power(bool include);
 
+    /**
+     * Take over every property of another advertisement, without any bus traffic. Returns the names of the
+     * properties that changed, to be passed to announce() while the advertisement is registered.
+     */
+    std::vector<std::string> assign(Advertisement& other);
+
+    /**
+     * Send the current values of the given properties with a single PropertiesChanged. BlueZ applies changes of
+     * the advertising data on the fly, but the advertising parameters only when the advertisement is registered.
+     */
+    void announce(const std::vector<std::string>& properties);
+
     // ----- INTERNAL CALLBACKS -----
     void on_registration() override;
 
@@ -77,6 +93,7 @@ class Advertisement : public SimpleDBus::Proxy {
 
     std::shared_ptr<LEAdvertisement1> le_advertisement1();
     std::shared_ptr<SimpleDBus::Interfaces::ObjectManager> object_manager();
+    std::shared_ptr<SimpleDBus::Interfaces::Properties> properties();
 };
 
 }  // namespace SimpleBluez
\ No newline at end of file
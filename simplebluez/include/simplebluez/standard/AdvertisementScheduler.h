@@ -0,0 +1,97 @@
+#pragma once
+
+#include <simplebluez/standard/Adapter.h>
+#include <simplebluez/standard/Advertisement.h>
+#include <simplebluez/standard/CustomRoot.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace SimpleBluez {
+
+/**
+ * Time-multiplexes any number of advertisements over the advertising instances the adapter has left.
+ *
+ * The scheduled advertisements are never registered themselves, they only describe payloads. The scheduler
+ * registers one advertisement of its own per instance and copies the payload going on air into it, so that
+ * rotating a payload usually costs a single PropertiesChanged. Only payloads with different advertising
+ * parameters (type, intervals, TX power, duration or timeout) have the instance registered again.
+ *
+ * Nothing happens in the background: rotate() has to be called whenever the time it returned is reached, from
+ * a thread of its own. It waits for BlueZ to register and unregister instances, and BlueZ reads the
+ * advertisements back from the application before answering, so calling it from the thread driving
+ * Bluez::run_async() leaves nobody to answer and blocks until the D-Bus call times out.
+ */
+class AdvertisementScheduler {
+  public:
+    /**
+     * The advertisements of the scheduler are created under the given root, named after the given prefix.
+     */
+    AdvertisementScheduler(std::shared_ptr<Adapter> adapter, std::shared_ptr<CustomRoot> root,
+                           const std::string& name = "rotation");
+    virtual ~AdvertisementScheduler();
+
+    /**
+     * Schedule an advertisement, which stays on air for the given time whenever it is picked. Instances are
+     * shared in proportion to the weight, so that an advertisement with twice the weight of another one spends
+     * twice the time on air. Changes made to the advertisement afterwards are picked up by the next rotate().
+     */
+    void add(const std::shared_ptr<Advertisement>& advertisement, std::chrono::milliseconds interval,
+             uint32_t weight = 1);
+    void remove(const std::shared_ptr<Advertisement>& advertisement);
+
+    /**
+     * Put the next advertisements on air where their time is up and return when this has to be called again.
+     * The first call claims the instances that are free at that point. Blocks on BlueZ, so it must not be
+     * called from the thread dispatching the connection.
+     */
+    std::chrono::steady_clock::time_point rotate(
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+
+    /**
+     * Take every advertisement off air and release the instances. The next rotate() starts over.
+     */
+    void stop();
+
+    /**
+     * Advertisements currently on air, in instance order.
+     */
+    std::vector<std::shared_ptr<Advertisement>> on_air();
+
+  private:
+    struct Entry {
+        std::shared_ptr<Advertisement> advertisement;
+        std::chrono::milliseconds interval;
+        uint32_t weight;
+        // Time on air so far, scaled by the weight. The entry with the lowest one goes on air next.
+        double pass;
+        bool on_air;
+    };
+
+    struct Slot {
+        std::shared_ptr<Advertisement> advertisement;
+        std::shared_ptr<Advertisement> source;
+        std::chrono::steady_clock::time_point until;
+    };
+
+    std::shared_ptr<Adapter> _adapter;
+    std::shared_ptr<CustomRoot> _root;
+    const std::string _name;
+
+    std::mutex _mutex;
+    std::vector<Entry> _entries;
+    std::vector<Slot> _slots;
+    bool _claimed = false;
+
+    void slots_claim();
+    std::vector<Entry>::iterator entry_find(const std::shared_ptr<Advertisement>& advertisement);
+    Entry* entry_next();
+    void slot_apply(Slot& slot);
+    void slot_clear(Slot& slot);
+};
+
+}  // namespace SimpleBluez
@@ -5,10 +5,29 @@
 #include <simplebluez/interfaces/GattCharacteristic1.h>
 #include <simplebluez/Types.h>
 
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+
 namespace SimpleBluez {
 
 class Characteristic : public SimpleDBus::Proxy {
   public:
+    // GATT operations announced through Flags, see capabilities().
+    enum Capability : uint8_t {
+        CAN_READ = 1 << 0,
+        CAN_WRITE_REQUEST = 1 << 1,
+        CAN_WRITE_COMMAND = 1 << 2,
+        CAN_NOTIFY = 1 << 3,
+        CAN_INDICATE = 1 << 4,
+        // Notifications can be received through acquire_notify().
+        CAN_NOTIFY_ACQUIRE = 1 << 5,
+        // Write commands can be sent through acquire_write().
+        CAN_WRITE_ACQUIRE = 1 << 6,
+    };
+
     Characteristic(std::shared_ptr<SimpleDBus::Connection> conn, const std::string& bus_name, const std::string& path);
     virtual ~Characteristic();
 
@@ -21,9 +40,49 @@ class Characteristic : public SimpleDBus::Proxy {
     ByteArray read();
     void write_request(ByteArray value);
     void write_command(ByteArray value);
+
+    /**
+     * Non-blocking forms of read(), write_request() and write_command(). The callback runs on the thread
+     * driving Bluez::run_async() once BlueZ replies, so it must not wait for other calls on this connection.
+     */
+    void read_async(std::function<void(ByteArray value, std::exception_ptr error)> callback);
+    void write_request_async(ByteArray value, std::function<void(std::exception_ptr error)> callback);
+    void write_command_async(ByteArray value, std::function<void(std::exception_ptr error)> callback);
+
     void start_notify();
     void stop_notify();
 
+    /**
+     * Subscribe through AcquireNotify, which delivers notifications over a socket watched by the connection
+     * event loop instead of as PropertiesChanged signals. Payloads go to the on_value_changed callback, but
+     * value() is not updated. Notifications stop on release_notify() or when BlueZ closes the socket.
+     */
+    void acquire_notify();
+    void release_notify();
+    bool notify_acquired();
+
+    /**
+     * Socket for write commands through AcquireWrite, along with the MTU of the link. Closing the socket
+     * releases it, the caller owns it from here on.
+     */
+    std::tuple<SimpleDBus::UnixFd, uint16_t> acquire_write();
+
+    /**
+     * Server role: queue values for subscribed clients. Queued values are sent back to back by the thread
+     * driving Bluez::run_async(max_wait), which also updates value(). Clients that acquired notifications
+     * receive them through their socket, the others as PropertiesChanged signals. While a client holds the
+     * socket, values longer than its MTU allows are rejected with std::invalid_argument.
+     */
+    void notify(ByteArray value);
+    void notify(std::vector<ByteArray> values);
+
+    /**
+     * Server role: whether clients may subscribe through AcquireNotify, which avoids a D-Bus message per
+     * notification. Otherwise BlueZ is told to fall back to StartNotify. BlueZ looks for the NotifyAcquired
+     * property announcing it when the application is registered, so this has to be set up before.
+     */
+    void allow_acquire_notify(bool allow);
+
     // ----- PROPERTIES -----
     std::vector<std::shared_ptr<Descriptor>> descriptors();
 
@@ -40,6 +99,7 @@ class Characteristic : public SimpleDBus::Proxy {
 
     std::vector<std::string> flags();
     void flags(std::vector<std::string> flags);
+    uint8_t capabilities();
 
     uint16_t mtu();
 
@@ -60,6 +120,29 @@ class Characteristic : public SimpleDBus::Proxy {
     void on_registration() override;
 
   private:
+    // Upper bound on the notifications handled per event loop wakeup, so that a busy socket can't starve the bus.
+    static constexpr int NOTIFY_BURST = 32;
+
+    std::mutex _notify_mutex;
+    SimpleDBus::UnixFd _notify_fd;
+
+    void notify_socket_read(GattCharacteristic1& characteristic1, int fd, std::vector<uint8_t>& buffer);
+
+    std::mutex _server_notify_mutex;
+    // Values not handed to BlueZ yet, including those waiting for a full socket to drain.
+    std::deque<ByteArray> _server_notify_queue;
+    SimpleDBus::UnixFd _server_notify_wakeup;
+    // Shared with a flush in progress, which sends through it without holding the mutex.
+    std::shared_ptr<SimpleDBus::UnixFd> _server_notify_socket;
+    size_t _server_notify_max_length = 0;
+    // PropertiesChanged without arguments, copied for every value sent as a signal.
+    SimpleDBus::Message _server_notify_signal;
+
+    void server_notify_flush();
+    SimpleDBus::UnixFd server_notify_acquire(uint16_t mtu);
+    void server_notify_socket_event(int fd);
+    void server_notify_release();
+
     std::shared_ptr<SimpleDBus::Proxy> path_create(const std::string& path) override;
 
     std::shared_ptr<SimpleDBus::Interfaces::Properties> properties();
@@ -5,6 +5,9 @@
 #include <simpledbus/advanced/Proxy.h>
 #include <simpledbus/interfaces/Properties.h>
 
+#include <exception>
+#include <functional>
+
 namespace SimpleBluez {
 
 class Descriptor : public SimpleDBus::Proxy {
@@ -16,6 +19,12 @@ class Descriptor : public SimpleDBus::Proxy {
     ByteArray read();
     void write(ByteArray value);
 
+    /**
+     * Non-blocking forms of read() and write(), see Characteristic::read_async().
+     */
+    void read_async(std::function<void(ByteArray value, std::exception_ptr error)> callback);
+    void write_async(ByteArray value, std::function<void(std::exception_ptr error)> callback);
+
     // ----- PROPERTIES -----
     std::string uuid();
     ByteArray value();
@@ -5,11 +5,21 @@
 #include <simplebluez/standard/Service.h>
 #include <simplebluez/interfaces/Battery1.h>
 #include <simplebluez/interfaces/Device1.h>
+#include <simplebluez/Types.h>
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
 
 namespace SimpleBluez {
 
 class Device : public SimpleDBus::Proxy {
   public:
+    struct CharacteristicEntry {
+        std::shared_ptr<Characteristic> characteristic;
+        uint8_t capabilities = 0;  // Characteristic::Capability bits
+    };
+
     Device(std::shared_ptr<SimpleDBus::Connection> conn, const std::string& bus_name, const std::string& path);
     virtual ~Device();
 
@@ -17,6 +27,18 @@ class Device : public SimpleDBus::Proxy {
     std::shared_ptr<Characteristic> get_characteristic(const std::string& service_uuid,
                                                        const std::string& characteristic_uuid);
 
+    /**
+     * Look up a characteristic together with its capabilities.
+     *
+     * Once services are resolved, lookups go through an index keyed by service and characteristic UUID,
+     * so their cost does not depend on the size of the GATT table. The index is built on first use and
+     * only built again once attributes below the device are added or removed, lookups that miss don't touch
+     * it. The UUIDs of the index are parsed when it is built, so callers holding them in binary form don't
+     * have to format them first.
+     */
+    CharacteristicEntry characteristic_entry(const std::string& service_uuid, const std::string& characteristic_uuid);
+    CharacteristicEntry characteristic_entry(const UUID128& service_uuid, const UUID128& characteristic_uuid);
+
     // ----- PROPERTIES -----
     std::vector<std::shared_ptr<Service>> services();
     std::vector<std::string> uuids();
@@ -27,6 +49,7 @@ class Device : public SimpleDBus::Proxy {
     std::string alias();
     int16_t rssi();
     int16_t tx_power();
+    bool has_tx_power();
 
     std::map<uint16_t, ByteArray> manufacturer_data();
     std::map<std::string, ByteArray> service_data();
@@ -54,11 +77,29 @@ class Device : public SimpleDBus::Proxy {
     void set_on_battery_percentage_changed(std::function<void(uint8_t new_value)> callback);
     void clear_on_battery_percentage_changed();
 
+    // ----- INTERNAL CALLBACKS -----
+    void on_descendant_changed(const std::string& path) override;
+
   private:
     std::shared_ptr<SimpleDBus::Proxy> path_create(const std::string& path) override;
 
     std::shared_ptr<Device1> device1();
     std::shared_ptr<Battery1> battery1();
+
+    using GattIndex =
+        std::unordered_map<UUID128, std::unordered_map<UUID128, CharacteristicEntry, UUID128::Hash>, UUID128::Hash>;
+
+    std::mutex _gatt_index_mutex;
+    GattIndex _gatt_index;
+    bool _gatt_index_valid = false;
+    // Bumped on every change of the attributes, so that an index built meanwhile is not kept.
+    uint64_t _gatt_index_generation = 0;
+
+    static const CharacteristicEntry* gatt_index_find(const GattIndex& index, const UUID128& service_uuid,
+                                                      const UUID128& characteristic_uuid);
+    static CharacteristicEntry gatt_index_lookup(const GattIndex& index, const UUID128& service_uuid,
+                                                 const UUID128& characteristic_uuid);
+    GattIndex gatt_index_build();
 };
 
 }  // namespace SimpleBluez
@@ -26,6 +26,10 @@ void Bluez::init() {
 
 void Bluez::run_async() { _conn->read_write_dispatch(); }
 
+void Bluez::run_async(std::chrono::milliseconds max_wait) { _conn->event_loop_iterate(max_wait); }
+
+void Bluez::wakeup_async() { _conn->event_loop_wakeup(); }
+
 std::shared_ptr<CustomRoot> Bluez::root_custom() { return _custom_root; }
 
 std::shared_ptr<BluezRoot> Bluez::root_bluez() { return _bluez_root; }
@@ -12,7 +12,9 @@ const SimpleDBus::AutoRegisterInterface<Adapter1> Adapter1::registry{
 };
 
 Adapter1::Adapter1(std::shared_ptr<SimpleDBus::Connection> conn, std::shared_ptr<SimpleDBus::Proxy> proxy)
-    : SimpleDBus::Interface(conn, proxy, "org.bluez.Adapter1") {}
+    : SimpleDBus::Interface(conn, proxy, "org.bluez.Adapter1") {
+    property_cache_enable();
+}
 
 // IMPORTANT: The destructor is defined here (instead of inline) to anchor the vtable to this object file.
 // This prevents the linker from stripping this translation unit and ensures the static 'registry' variable is
@@ -38,61 +40,49 @@ SimpleDBus::Holder Adapter1::GetDiscoveryFilters() {
 }
 
 void Adapter1::SetDiscoveryFilter(DiscoveryFilter filter) {
-    SimpleDBus::Holder properties = SimpleDBus::Holder::create<std::map<std::string, SimpleDBus::Holder>>();
+    std::map<std::string, SimpleDBus::Holder> properties;
 
     if (filter.UUIDs.size() > 0) {
-        SimpleDBus::Holder uuids = SimpleDBus::Holder::create<std::vector<SimpleDBus::Holder>>();
-        for (size_t i = 0; i < filter.UUIDs.size(); i++) {
-            uuids.array_append(SimpleDBus::Holder::create<std::string>(filter.UUIDs.at(i)));
-        }
-        properties.dict_append(SimpleDBus::Holder::Type::ARRAY, "UUIDs", uuids);
+        properties["UUIDs"] = SimpleDBus::Holder::create(filter.UUIDs);
     }
 
     if (filter.RSSI.has_value()) {
-        properties.dict_append(SimpleDBus::Holder::Type::INT16, "RSSI",
-                               SimpleDBus::Holder::create<int16_t>(filter.RSSI.value()));
+        properties["RSSI"] = SimpleDBus::Holder::create<int16_t>(filter.RSSI.value());
     }
 
     if (filter.Pathloss.has_value()) {
-        properties.dict_append(SimpleDBus::Holder::Type::UINT16, "Pathloss",
-                               SimpleDBus::Holder::create<uint16_t>(filter.Pathloss.value()));
+        properties["Pathloss"] = SimpleDBus::Holder::create<uint16_t>(filter.Pathloss.value());
     }
 
     switch (filter.Transport) {
         case DiscoveryFilter::TransportType::AUTO: {
-            properties.dict_append(SimpleDBus::Holder::Type::STRING, "Transport",
-                                   SimpleDBus::Holder::create<std::string>("auto"));
+            properties["Transport"] = SimpleDBus::Holder::create<std::string>("auto");
             break;
         }
         case DiscoveryFilter::TransportType::BREDR: {
-            properties.dict_append(SimpleDBus::Holder::Type::STRING, "Transport",
-                                   SimpleDBus::Holder::create<std::string>("bredr"));
+            properties["Transport"] = SimpleDBus::Holder::create<std::string>("bredr");
             break;
         }
         case DiscoveryFilter::TransportType::LE: {
-            properties.dict_append(SimpleDBus::Holder::Type::STRING, "Transport",
-                                   SimpleDBus::Holder::create<std::string>("le"));
+            properties["Transport"] = SimpleDBus::Holder::create<std::string>("le");
             break;
         }
     }
 
     if (!filter.DuplicateData) {
-        properties.dict_append(SimpleDBus::Holder::Type::BOOLEAN, "DuplicateData",
-                               SimpleDBus::Holder::create<bool>(false));
+        properties["DuplicateData"] = SimpleDBus::Holder::create<bool>(false);
     }
 
     if (filter.Discoverable) {
-        properties.dict_append(SimpleDBus::Holder::Type::BOOLEAN, "Discoverable",
-                               SimpleDBus::Holder::create<bool>(false));
+        properties["Discoverable"] = SimpleDBus::Holder::create<bool>(true);
     }
 
     if (filter.Pattern.size() > 0) {
-        properties.dict_append(SimpleDBus::Holder::Type::STRING, "Pattern",
-                               SimpleDBus::Holder::create<std::string>(filter.Pattern));
+        properties["Pattern"] = SimpleDBus::Holder::create<std::string>(filter.Pattern);
     }
 
     auto msg = create_method_call("SetDiscoveryFilter");
-    msg.append_argument(properties, "a{sv}");
+    msg.append(properties);
     _conn->send_with_reply(msg);
 }
 
@@ -101,3 +91,17 @@ void Adapter1::RemoveDevice(std::string device_path) {
     msg.append_argument(SimpleDBus::Holder::create<SimpleDBus::ObjectPath>(device_path), "o");
     _conn->send_with_reply(msg);
 }
+
+void Adapter1::RemoveDeviceAsync(std::string device_path, std::function<void(std::exception_ptr error)> callback) {
+    auto msg = create_method_call("RemoveDevice");
+    msg.append_argument(SimpleDBus::Holder::create<SimpleDBus::ObjectPath>(device_path), "o");
+    _conn->send_async(msg, [callback = std::move(callback)](SimpleDBus::PendingCall& call) {
+        std::exception_ptr error;
+        try {
+            call.get();
+        } catch (...) {
+            error = std::current_exception();
+        }
+        callback(error);
+    });
+}
@@ -12,7 +12,10 @@ const SimpleDBus::AutoRegisterInterface<Device1> Device1::registry{
 };
 
 Device1::Device1(std::shared_ptr<SimpleDBus::Connection> conn, std::shared_ptr<SimpleDBus::Proxy> proxy)
-    : SimpleDBus::Interface(conn, proxy, "org.bluez.Device1") {}
+    : SimpleDBus::Interface(conn, proxy, "org.bluez.Device1") {
+    // BlueZ announces every change of these properties through PropertiesChanged.
+    property_cache_enable();
+}
 
 // IMPORTANT: The destructor is defined here (instead of inline) to anchor the vtable to this object file.
 // This prevents the linker from stripping this translation unit and ensures the static 'registry' variable is
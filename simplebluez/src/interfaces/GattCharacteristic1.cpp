@@ -13,7 +13,10 @@ const SimpleDBus::AutoRegisterInterface<GattCharacteristic1> GattCharacteristic1
 
 GattCharacteristic1::GattCharacteristic1(std::shared_ptr<SimpleDBus::Connection> conn,
                                          std::shared_ptr<SimpleDBus::Proxy> proxy)
-    : SimpleDBus::Interface(conn, proxy, "org.bluez.GattCharacteristic1") {}
+    : SimpleDBus::Interface(conn, proxy, "org.bluez.GattCharacteristic1") {
+    // Notifying is polled while waiting for StopNotify to settle, serve it from the signal-fed cache.
+    property_cache_enable();
+}
 
 // IMPORTANT: The destructor is defined here (instead of inline) to anchor the vtable to this object file.
 // This prevents the linker from stripping this translation unit and ensures the static 'registry' variable is
@@ -31,38 +34,85 @@ void GattCharacteristic1::StopNotify() {
 }
 
 void GattCharacteristic1::WriteValue(const ByteArray& value, WriteType type) {
-    SimpleDBus::Holder value_data = SimpleDBus::Holder::create<std::vector<SimpleDBus::Holder>>();
-    for (size_t i = 0; i < value.size(); i++) {
-        value_data.array_append(SimpleDBus::Holder::create<uint8_t>(value[i]));
-    }
-
-    SimpleDBus::Holder options = SimpleDBus::Holder::create<std::map<std::string, SimpleDBus::Holder>>();
+    std::map<std::string, SimpleDBus::Holder> options;
     if (type == WriteType::REQUEST) {
-        options.dict_append(SimpleDBus::Holder::Type::STRING, "type",
-                            SimpleDBus::Holder::create<std::string>("request"));
+        options["type"] = SimpleDBus::Holder::create<std::string>("request");
     } else if (type == WriteType::COMMAND) {
-        options.dict_append(SimpleDBus::Holder::Type::STRING, "type",
-                            SimpleDBus::Holder::create<std::string>("command"));
+        options["type"] = SimpleDBus::Holder::create<std::string>("command");
     }
 
     auto msg = create_method_call("WriteValue");
-    msg.append_argument(value_data, "ay");
-    msg.append_argument(options, "a{sv}");
+    msg.append(value, options);
     _conn->send_with_reply(msg);
 }
 
+void GattCharacteristic1::WriteValueAsync(const ByteArray& value, WriteType type,
+                                          std::function<void(std::exception_ptr error)> callback) {
+    std::map<std::string, SimpleDBus::Holder> options;
+    options["type"] = SimpleDBus::Holder::create<std::string>(type == WriteType::REQUEST ? "request" : "command");
+
+    auto msg = create_method_call("WriteValue");
+    msg.append(value, options);
+    _conn->send_async(msg, [callback = std::move(callback)](SimpleDBus::PendingCall& call) {
+        std::exception_ptr error;
+        try {
+            call.get();
+        } catch (...) {
+            error = std::current_exception();
+        }
+        callback(error);
+    });
+}
+
+void GattCharacteristic1::ReadValueAsync(std::function<void(ByteArray value, std::exception_ptr error)> callback) {
+    auto msg = create_method_call("ReadValue");
+    msg.append(std::map<std::string, SimpleDBus::Holder>());
+
+    // The value is only cached if the characteristic is still around by the time the reply arrives.
+    _conn->send_async(msg, [this, proxy = _proxy, callback = std::move(callback)](SimpleDBus::PendingCall& call) {
+        ByteArray value;
+        std::exception_ptr error;
+        try {
+            value = call.get().extract<ByteArray>();
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        // Held while the value is stored, as the proxy owns this interface.
+        if (auto owner = proxy.lock(); !error && owner) {
+            Value.set(SimpleDBus::Holder::create<ByteArray>(value));
+        }
+        callback(std::move(value), error);
+    });
+}
+
 ByteArray GattCharacteristic1::ReadValue() {
     auto msg = create_method_call("ReadValue");
 
     // NOTE: ReadValue requires an additional argument, which currently is not supported
-    SimpleDBus::Holder options = SimpleDBus::Holder::create<std::map<std::string, SimpleDBus::Holder>>();
-    msg.append_argument(options, "a{sv}");
+    msg.append(std::map<std::string, SimpleDBus::Holder>());
+
+    SimpleDBus::Message reply_msg = _conn->send_with_reply(msg);
+    ByteArray value = reply_msg.extract<ByteArray>();
+
+    Value.set(SimpleDBus::Holder::create<ByteArray>(value));
+    return value;
+}
+
+std::tuple<SimpleDBus::UnixFd, uint16_t> GattCharacteristic1::AcquireNotify() {
+    auto msg = create_method_call("AcquireNotify");
+    msg.append(std::map<std::string, SimpleDBus::Holder>());
 
     SimpleDBus::Message reply_msg = _conn->send_with_reply(msg);
-    SimpleDBus::Holder value = reply_msg.extract();
+    return reply_msg.extract<SimpleDBus::UnixFd, uint16_t>();
+}
+
+std::tuple<SimpleDBus::UnixFd, uint16_t> GattCharacteristic1::AcquireWrite() {
+    auto msg = create_method_call("AcquireWrite");
+    msg.append(std::map<std::string, SimpleDBus::Holder>());
 
-    Value.set(value);
-    return Value();
+    SimpleDBus::Message reply_msg = _conn->send_with_reply(msg);
+    return reply_msg.extract<SimpleDBus::UnixFd, uint16_t>();
 }
 
 void GattCharacteristic1::message_handle(SimpleDBus::Message& msg) {
@@ -98,5 +148,24 @@ void GattCharacteristic1::message_handle(SimpleDBus::Message& msg) {
         Notifying.set(false).emit();
 
         OnStopNotify();
+    } else if (msg.is_method_call(_interface_name, "AcquireNotify")) {
+        auto options = msg.extract<std::map<std::string, SimpleDBus::Holder>>();
+        uint16_t mtu = options.count("mtu") != 0 ? options["mtu"].get<uint16_t>() : 23;
+
+        SimpleDBus::UnixFd fd = OnAcquireNotify(mtu);
+        if (!fd.is_valid()) {
+            SimpleDBus::Message error = SimpleDBus::Message::create_error(msg, "org.bluez.Error.NotSupported",
+                                                                          "Notifications are not acquirable");
+            _conn->send(error);
+            return;
+        }
+
+        SimpleDBus::Message reply = SimpleDBus::Message::create_method_return(msg);
+        reply.append(fd, mtu);
+        _conn->send(reply);
+
+        NotifyAcquired.set(true).emit();
+
+        OnStartNotify();
     }
 }
\ No newline at end of file
@@ -20,16 +20,8 @@ GattDescriptor1::GattDescriptor1(std::shared_ptr<SimpleDBus::Connection> conn, s
 GattDescriptor1::~GattDescriptor1() = default;
 
 void GattDescriptor1::WriteValue(const ByteArray& value) {
-    SimpleDBus::Holder value_data = SimpleDBus::Holder::create<std::vector<SimpleDBus::Holder>>();
-    for (size_t i = 0; i < value.size(); i++) {
-        value_data.array_append(SimpleDBus::Holder::create<uint8_t>(value[i]));
-    }
-
-    SimpleDBus::Holder options = SimpleDBus::Holder::create<std::map<std::string, SimpleDBus::Holder>>();
-
     auto msg = create_method_call("WriteValue");
-    msg.append_argument(value_data, "ay");
-    msg.append_argument(options, "a{sv}");
+    msg.append(value, std::map<std::string, SimpleDBus::Holder>());
     _conn->send_with_reply(msg);
 }
 
@@ -37,12 +29,46 @@ ByteArray GattDescriptor1::ReadValue() {
     auto msg = create_method_call("ReadValue");
 
     // NOTE: ReadValue requires an additional argument, which currently is not supported
-    SimpleDBus::Holder options = SimpleDBus::Holder::create<std::map<std::string, SimpleDBus::Holder>>();
-    msg.append_argument(options, "a{sv}");
+    msg.append(std::map<std::string, SimpleDBus::Holder>());
 
     SimpleDBus::Message reply_msg = _conn->send_with_reply(msg);
-    SimpleDBus::Holder value = reply_msg.extract();
-    Value.set(value);
+    ByteArray value = reply_msg.extract<ByteArray>();
+    Value.set(SimpleDBus::Holder::create<ByteArray>(value));
+
+    return value;
+}
+
+void GattDescriptor1::WriteValueAsync(const ByteArray& value, std::function<void(std::exception_ptr error)> callback) {
+    auto msg = create_method_call("WriteValue");
+    msg.append(value, std::map<std::string, SimpleDBus::Holder>());
+    _conn->send_async(msg, [callback = std::move(callback)](SimpleDBus::PendingCall& call) {
+        std::exception_ptr error;
+        try {
+            call.get();
+        } catch (...) {
+            error = std::current_exception();
+        }
+        callback(error);
+    });
+}
+
+void GattDescriptor1::ReadValueAsync(std::function<void(ByteArray value, std::exception_ptr error)> callback) {
+    auto msg = create_method_call("ReadValue");
+    msg.append(std::map<std::string, SimpleDBus::Holder>());
+
+    _conn->send_async(msg, [this, proxy = _proxy, callback = std::move(callback)](SimpleDBus::PendingCall& call) {
+        ByteArray value;
+        std::exception_ptr error;
+        try {
+            value = call.get().extract<ByteArray>();
+        } catch (...) {
+            error = std::current_exception();
+        }
 
-    return Value();
+        // Held while the value is stored, as the proxy owns this interface.
+        if (auto owner = proxy.lock(); !error && owner) {
+            Value.set(SimpleDBus::Holder::create<ByteArray>(value));
+        }
+        callback(std::move(value), error);
+    });
 }
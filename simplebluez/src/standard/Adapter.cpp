@@ -77,10 +77,17 @@ void Adapter::device_remove(const std::string& path) { adapter1()->RemoveDevice(
 
 void Adapter::device_remove(const std::shared_ptr<Device>& device) { adapter1()->RemoveDevice(device->path()); }
 
+void Adapter::device_remove_async(const std::string& path, std::function<void(std::exception_ptr error)> callback) {
+    adapter1()->RemoveDeviceAsync(path, std::move(callback));
+}
+
 std::vector<std::shared_ptr<Device>> Adapter::device_paired_get() {
     // Traverse all child paths and return only those that are paired.
     std::vector<std::shared_ptr<Device>> paired_devices;
 
+    // Fetch whatever is out of date for all devices at once instead of one Get per device.
+    refresh_children_interfaces({"org.bluez.Device1"});
+
     for (auto& [path, child] : _children) {
         if (!child->valid()) continue;
 
@@ -97,6 +104,9 @@ std::vector<std::shared_ptr<Device>> Adapter::device_bonded_get() {
     // Traverse all child paths and return only those that are bonded.
     std::vector<std::shared_ptr<Device>> bonded_devices;
 
+    // See device_paired_get().
+    refresh_children_interfaces({"org.bluez.Device1"});
+
     for (auto& [path, child] : _children) {
         if (!child->valid()) continue;
 
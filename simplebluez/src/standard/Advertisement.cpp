@@ -16,6 +16,11 @@ void Advertisement::on_registration() {
                        std::static_pointer_cast<SimpleDBus::Interface>(
                            std::make_shared<SimpleDBus::Interfaces::ObjectManager>(_conn, shared_from_this()))));
 
+    _interfaces.emplace(
+        std::make_pair("org.freedesktop.DBus.Properties",
+                       std::static_pointer_cast<SimpleDBus::Interface>(
+                           std::make_shared<SimpleDBus::Interfaces::Properties>(_conn, shared_from_this()))));
+
     le_advertisement1()->OnRelease.load([this]() { _active.store(false); });
 }
 
@@ -28,6 +33,11 @@ std::shared_ptr<SimpleDBus::Interfaces::ObjectManager> Advertisement::object_man
         interface_get("org.freedesktop.DBus.ObjectManager"));
 }
 
+std::shared_ptr<SimpleDBus::Interfaces::Properties> Advertisement::properties() {
+    return std::dynamic_pointer_cast<SimpleDBus::Interfaces::Properties>(
+        interface_get("org.freedesktop.DBus.Properties"));
+}
+
 bool Advertisement::active() { return _active.load(); }
 
 void Advertisement::activate() { _active.store(true); }
@@ -108,4 +118,29 @@ void Advertisement::tx_power(int16_t power) { le_advertisement1()->TxPower(power
 
 bool Advertisement::include_tx_power() { return le_advertisement1()->IncludeTxPower(); }
 
-void Advertisement::include_tx_power(bool include) { le_advertisement1()->IncludeTxPower(include); }
\ No newline at end of file
+void Advertisement::include_tx_power(bool include) { le_advertisement1()->IncludeTxPower(include); }
+
+std::vector<std::string> Advertisement::assign(Advertisement& other) {
+    auto source = other.le_advertisement1()->handle_property_get_all().get<std::map<std::string, SimpleDBus::Holder>>();
+    auto target = le_advertisement1();
+
+    std::vector<std::string> changed;
+    for (auto& [name, value] : source) {
+        if (target->handle_property_get(name) == value) continue;
+
+        target->handle_property_set(name, value);
+        changed.push_back(name);
+    }
+    return changed;
+}
+
+void Advertisement::announce(const std::vector<std::string>& properties) {
+    if (properties.empty()) return;
+
+    auto advertisement1 = le_advertisement1();
+    std::map<std::string, SimpleDBus::Holder> changed;
+    for (auto& name : properties) {
+        changed[name] = advertisement1->handle_property_get(name);
+    }
+    this->properties()->PropertiesChanged("org.bluez.LEAdvertisement1", changed);
+}
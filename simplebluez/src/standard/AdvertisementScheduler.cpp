@@ -0,0 +1,171 @@
+#include <simplebluez/standard/AdvertisementScheduler.h>
+
+#include <algorithm>
+#include <exception>
+#include <set>
+#include <stdexcept>
+
+using namespace SimpleBluez;
+
+// Advertising parameters, which BlueZ only reads when the advertisement is registered.
+static const std::set<std::string> REGISTRATION_PROPERTIES = {"Type",    "MinInterval", "MaxInterval",
+                                                               "TxPower", "Duration",    "Timeout"};
+
+AdvertisementScheduler::AdvertisementScheduler(std::shared_ptr<Adapter> adapter, std::shared_ptr<CustomRoot> root,
+                                               const std::string& name)
+    : _adapter(std::move(adapter)), _root(std::move(root)), _name(name) {}
+
+AdvertisementScheduler::~AdvertisementScheduler() {
+    try {
+        stop();
+    } catch (const std::exception&) {
+        // The instances are released by BlueZ anyway once the connection goes away.
+    }
+
+    for (size_t i = 0; i < _slots.size(); i++) {
+        _root->advertisement_remove(_name + std::to_string(i));
+    }
+}
+
+void AdvertisementScheduler::add(const std::shared_ptr<Advertisement>& advertisement, std::chrono::milliseconds interval,
+                                 uint32_t weight) {
+    if (interval.count() <= 0 || weight == 0) throw std::invalid_argument("Interval and weight must be positive");
+
+    std::scoped_lock lock(_mutex);
+    if (entry_find(advertisement) != _entries.end()) return;
+
+    // Newcomers start level with the entry that is furthest behind, instead of claiming all the time they missed.
+    double pass = 0;
+    if (!_entries.empty()) {
+        pass = std::min_element(_entries.begin(), _entries.end(), [](const Entry& a, const Entry& b) {
+                   return a.pass < b.pass;
+               })->pass;
+    }
+    _entries.push_back(Entry{advertisement, interval, weight, pass, false});
+}
+
+void AdvertisementScheduler::remove(const std::shared_ptr<Advertisement>& advertisement) {
+    std::scoped_lock lock(_mutex);
+    auto it = entry_find(advertisement);
+    if (it == _entries.end()) return;
+
+    // The instance is handed to the next advertisement, or released, by the next rotate().
+    for (auto& slot : _slots) {
+        if (slot.source == advertisement) {
+            slot.source = nullptr;
+        }
+    }
+    _entries.erase(it);
+}
+
+std::chrono::steady_clock::time_point AdvertisementScheduler::rotate(std::chrono::steady_clock::time_point now) {
+    std::scoped_lock lock(_mutex);
+    if (!_claimed) {
+        slots_claim();
+    }
+
+    auto next_rotation = std::chrono::steady_clock::time_point::max();
+    for (auto& slot : _slots) {
+        if (!slot.source || slot.until <= now) {
+            if (slot.source) {
+                auto it = entry_find(slot.source);
+                if (it != _entries.end()) it->on_air = false;
+            }
+
+            // The advertisement whose time is up competes as well, and is simply kept when nobody else is waiting.
+            Entry* entry = entry_next();
+            if (!entry) {
+                slot_clear(slot);
+                continue;
+            }
+
+            entry->on_air = true;
+            entry->pass += static_cast<double>(entry->interval.count()) / entry->weight;
+            slot.source = entry->advertisement;
+            slot.until = now + entry->interval;
+        }
+
+        slot_apply(slot);
+        next_rotation = std::min(next_rotation, slot.until);
+    }
+    return next_rotation;
+}
+
+void AdvertisementScheduler::stop() {
+    std::scoped_lock lock(_mutex);
+    for (auto& slot : _slots) {
+        slot_clear(slot);
+    }
+    for (auto& entry : _entries) {
+        entry.on_air = false;
+    }
+    _claimed = false;
+}
+
+std::vector<std::shared_ptr<Advertisement>> AdvertisementScheduler::on_air() {
+    std::scoped_lock lock(_mutex);
+    std::vector<std::shared_ptr<Advertisement>> advertisements;
+    for (auto& slot : _slots) {
+        if (slot.source) advertisements.push_back(slot.source);
+    }
+    return advertisements;
+}
+
+void AdvertisementScheduler::slots_claim() {
+    uint8_t supported = _adapter->supported_advertisement_instances();
+    uint8_t active = _adapter->active_advertisement_instances();
+    size_t count = supported > active ? supported - active : 0;
+    if (count == 0) {
+        throw std::runtime_error("No available advertisement instances");
+    }
+
+    // Advertisements of a previous run are reused, so that their paths stay the same.
+    while (_slots.size() > count) {
+        _slots.pop_back();
+        _root->advertisement_remove(_name + std::to_string(_slots.size()));
+    }
+    while (_slots.size() < count) {
+        auto advertisement = _root->advertisement_add(_name + std::to_string(_slots.size()));
+        _slots.push_back(Slot{advertisement, nullptr, {}});
+    }
+    _claimed = true;
+}
+
+std::vector<AdvertisementScheduler::Entry>::iterator AdvertisementScheduler::entry_find(
+    const std::shared_ptr<Advertisement>& advertisement) {
+    return std::find_if(_entries.begin(), _entries.end(),
+                        [&advertisement](const Entry& entry) { return entry.advertisement == advertisement; });
+}
+
+AdvertisementScheduler::Entry* AdvertisementScheduler::entry_next() {
+    Entry* next = nullptr;
+    for (auto& entry : _entries) {
+        if (entry.on_air) continue;
+        if (!next || entry.pass < next->pass) next = &entry;
+    }
+    return next;
+}
+
+void AdvertisementScheduler::slot_apply(Slot& slot) {
+    std::vector<std::string> changed = slot.advertisement->assign(*slot.source);
+
+    // Also covers instances that BlueZ released on its own, for example after a timeout.
+    if (!slot.advertisement->active()) {
+        _adapter->register_advertisement(slot.advertisement);
+        return;
+    }
+
+    bool reregister = std::any_of(changed.begin(), changed.end(),
+                                  [](const std::string& name) { return REGISTRATION_PROPERTIES.count(name) > 0; });
+    if (reregister) {
+        _adapter->unregister_advertisement(slot.advertisement);
+        _adapter->register_advertisement(slot.advertisement);
+    } else {
+        slot.advertisement->announce(changed);
+    }
+}
+
+void AdvertisementScheduler::slot_clear(Slot& slot) {
+    _adapter->unregister_advertisement(slot.advertisement);
+    slot.source = nullptr;
+}
@@ -14,10 +14,10 @@ void BluezRoot::on_registration() {
 }
 
 void BluezRoot::load_managed_objects() {
-    SimpleDBus::Holder managed_objects = object_manager()->GetManagedObjects();
-    for (auto& [path, managed_interfaces] :
-         managed_objects.get<std::map<SimpleDBus::ObjectPath, SimpleDBus::Holder>>()) {
-        path_add(path, managed_interfaces);
+    // BlueZ caches every device it has ever seen along with their GATT attributes, of which only a handful
+    // are usually needed, so proxies are only built when first accessed.
+    for (auto& [path, managed_interfaces] : object_manager()->GetManagedObjectsDeferred()) {
+        path_add_deferred(path, std::move(managed_interfaces));
     }
 }
 
@@ -1,8 +1,18 @@
 #include <simplebluez/Exceptions.h>
 #include <simplebluez/standard/Characteristic.h>
 #include <simplebluez/standard/Descriptor.h>
+#include <simpledbus/base/Logging.h>
 #include "simplebluez/Types.h"
 
+#include <fcntl.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <algorithm>
+#include <cerrno>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+
 using namespace SimpleBluez;
 
 Characteristic::Characteristic(std::shared_ptr<SimpleDBus::Connection> conn, const std::string& bus_name,
@@ -20,7 +30,17 @@ void Characteristic::on_registration() {
     _interfaces.emplace(std::make_pair("org.freedesktop.DBus.Properties", properties));
 }
 
-Characteristic::~Characteristic() {}
+Characteristic::~Characteristic() {
+    release_notify();
+    server_notify_release();
+
+    SimpleDBus::UnixFd wakeup;
+    {
+        std::scoped_lock lock(_server_notify_mutex);
+        wakeup = std::move(_server_notify_wakeup);
+    }
+    if (wakeup.is_valid()) _conn->event_loop_remove_fd(wakeup.get());
+}
 
 std::shared_ptr<SimpleDBus::Proxy> Characteristic::path_create(const std::string& path) {
     return Proxy::create<Descriptor>(_conn, _bus_name, path);
@@ -51,6 +71,35 @@ void Characteristic::value(ByteArray value) { gattcharacteristic1()->Value.set(v
 std::vector<std::string> Characteristic::flags() { return gattcharacteristic1()->Flags; }
 void Characteristic::flags(std::vector<std::string> flags) { gattcharacteristic1()->Flags(flags); }
 
+uint8_t Characteristic::capabilities() {
+    uint8_t capabilities = 0;
+    for (auto& flag : flags()) {
+        if (flag == "read") {
+            capabilities |= CAN_READ;
+        } else if (flag == "write") {
+            capabilities |= CAN_WRITE_REQUEST;
+        } else if (flag == "write-without-response") {
+            capabilities |= CAN_WRITE_COMMAND;
+        } else if (flag == "notify") {
+            capabilities |= CAN_NOTIFY;
+        } else if (flag == "indicate") {
+            capabilities |= CAN_INDICATE;
+        } else if (flag == "notify-acquired") {
+            capabilities |= CAN_NOTIFY_ACQUIRE;
+        }
+    }
+
+    // BlueZ only exposes NotifyAcquired and WriteAcquired on remote characteristics that support
+    // AcquireNotify and AcquireWrite respectively.
+    if (gattcharacteristic1()->NotifyAcquired.valid()) {
+        capabilities |= CAN_NOTIFY_ACQUIRE;
+    }
+    if (gattcharacteristic1()->WriteAcquired.valid()) {
+        capabilities |= CAN_WRITE_ACQUIRE;
+    }
+    return capabilities;
+}
+
 uint16_t Characteristic::mtu() { return gattcharacteristic1()->MTU; }
 
 ByteArray Characteristic::read() { return gattcharacteristic1()->ReadValue(); }
@@ -63,10 +112,228 @@ void Characteristic::write_command(ByteArray value) {
     gattcharacteristic1()->WriteValue(value, GattCharacteristic1::WriteType::COMMAND);
 }
 
+void Characteristic::read_async(std::function<void(ByteArray value, std::exception_ptr error)> callback) {
+    gattcharacteristic1()->ReadValueAsync(std::move(callback));
+}
+
+void Characteristic::write_request_async(ByteArray value, std::function<void(std::exception_ptr error)> callback) {
+    gattcharacteristic1()->WriteValueAsync(value, GattCharacteristic1::WriteType::REQUEST, std::move(callback));
+}
+
+void Characteristic::write_command_async(ByteArray value, std::function<void(std::exception_ptr error)> callback) {
+    gattcharacteristic1()->WriteValueAsync(value, GattCharacteristic1::WriteType::COMMAND, std::move(callback));
+}
+
 void Characteristic::start_notify() { gattcharacteristic1()->StartNotify(); }
 
 void Characteristic::stop_notify() { gattcharacteristic1()->StopNotify(); }
 
+void Characteristic::acquire_notify() {
+    std::scoped_lock lock(_notify_mutex);
+    if (_notify_fd.is_valid()) return;
+
+    auto characteristic1 = gattcharacteristic1();
+    auto [fd, mtu] = characteristic1->AcquireNotify();
+    fcntl(fd.get(), F_SETFL, fcntl(fd.get(), F_GETFL) | O_NONBLOCK);
+
+    // Each packet holds a single notification, which never exceeds the MTU.
+    int raw_fd = fd.get();
+    std::vector<uint8_t> buffer(std::max<size_t>(mtu, 1));
+    _conn->event_loop_add_fd(raw_fd, [this, characteristic1, raw_fd, buffer]() mutable {
+        notify_socket_read(*characteristic1, raw_fd, buffer);
+    });
+    _notify_fd = std::move(fd);
+}
+
+void Characteristic::release_notify() {
+    SimpleDBus::UnixFd fd;
+    {
+        std::scoped_lock lock(_notify_mutex);
+        fd = std::move(_notify_fd);
+    }
+    if (!fd.is_valid()) return;
+
+    // The socket is closed only once the handler is gone, which is what tells BlueZ to stop notifying.
+    _conn->event_loop_remove_fd(fd.get());
+}
+
+bool Characteristic::notify_acquired() {
+    std::scoped_lock lock(_notify_mutex);
+    return _notify_fd.is_valid();
+}
+
+std::tuple<SimpleDBus::UnixFd, uint16_t> Characteristic::acquire_write() {
+    return gattcharacteristic1()->AcquireWrite();
+}
+
+void Characteristic::notify_socket_read(GattCharacteristic1& characteristic1, int fd, std::vector<uint8_t>& buffer) {
+    for (int i = 0; i < NOTIFY_BURST; i++) {
+        ssize_t length = recv(fd, buffer.data(), buffer.size(), MSG_DONTWAIT);
+        if (length > 0) {
+            characteristic1.Value.on_changed(ByteArray(buffer.data(), static_cast<size_t>(length)));
+            continue;
+        }
+        if (length < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+            return;
+        }
+
+        // Hung up by BlueZ, usually because the device disconnected.
+        release_notify();
+        return;
+    }
+}
+
+void Characteristic::notify(ByteArray value) { notify(std::vector<ByteArray>{std::move(value)}); }
+
+void Characteristic::notify(std::vector<ByteArray> values) {
+    if (values.empty()) return;
+
+    std::scoped_lock lock(_server_notify_mutex);
+    if (_server_notify_socket) {
+        for (auto& value : values) {
+            if (value.size() > _server_notify_max_length) {
+                throw std::invalid_argument("Value does not fit a notification at the MTU of the subscribed client");
+            }
+        }
+    }
+
+    if (!_server_notify_wakeup.is_valid()) {
+        SimpleDBus::UnixFd wakeup(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC));
+        if (!wakeup.is_valid()) throw std::runtime_error("Failed to create notification wakeup descriptor");
+
+        _server_notify_signal =
+            SimpleDBus::Message::create_signal(_path, "org.freedesktop.DBus.Properties", "PropertiesChanged");
+        int raw_fd = wakeup.get();
+        _conn->event_loop_add_fd(raw_fd, [this, raw_fd]() {
+            eventfd_t pending;
+            eventfd_read(raw_fd, &pending);
+            server_notify_flush();
+        });
+        _server_notify_wakeup = std::move(wakeup);
+    }
+
+    for (auto& value : values) {
+        _server_notify_queue.push_back(std::move(value));
+    }
+    eventfd_write(_server_notify_wakeup.get(), 1);
+}
+
+void Characteristic::allow_acquire_notify(bool allow) {
+    auto characteristic1 = gattcharacteristic1();
+    if (allow) {
+        characteristic1->OnAcquireNotify.load([this](uint16_t mtu) { return server_notify_acquire(mtu); });
+        characteristic1->NotifyAcquired.set(false);
+    } else {
+        characteristic1->OnAcquireNotify.unload();
+        characteristic1->NotifyAcquired.invalidate();
+        server_notify_release();
+    }
+}
+
+void Characteristic::server_notify_flush() {
+    // Taken out under the lock, so that notify() is never held up by the sends below. The socket stays open until
+    // the last of its references is dropped, even if it is released meanwhile.
+    std::deque<ByteArray> queue;
+    std::shared_ptr<SimpleDBus::UnixFd> socket;
+    size_t max_length;
+    {
+        std::scoped_lock lock(_server_notify_mutex);
+        queue.swap(_server_notify_queue);
+        socket = _server_notify_socket;
+        max_length = _server_notify_max_length;
+    }
+    if (queue.empty()) return;
+
+    if (!socket) {
+        for (auto& value : queue) {
+            SimpleDBus::Message msg = _server_notify_signal.copy();
+            msg.append(std::string("org.bluez.GattCharacteristic1"),
+                       std::map<std::string, SimpleDBus::Variant<ByteArray>>{{"Value", {value}}},
+                       std::vector<std::string>());
+            _conn->send(msg);
+        }
+        gattcharacteristic1()->Value.set(queue.back());
+        return;
+    }
+
+    std::optional<ByteArray> last;
+    while (!queue.empty()) {
+        ByteArray& value = queue.front();
+        // Only values queued before the client subscribed can get here, notify() rejects the others.
+        if (value.size() > max_length) {
+            LOG_WARN("Dropping a notification of {} bytes, the subscribed client takes at most {}", value.size(),
+                     max_length);
+            queue.pop_front();
+            continue;
+        }
+        if (send(socket->get(), value.data(), value.size(), MSG_DONTWAIT | MSG_NOSIGNAL) < 0) break;
+        last = std::move(value);
+        queue.pop_front();
+    }
+    if (last) gattcharacteristic1()->Value.set(*last);
+    if (queue.empty()) return;
+
+    // Signals would overtake what BlueZ still has to read from the socket, so the rest waits at the front of the
+    // queue until the socket drains. Should BlueZ close it instead, the release flushes the rest as signals.
+    {
+        std::scoped_lock lock(_server_notify_mutex);
+        _server_notify_queue.insert(_server_notify_queue.begin(), std::make_move_iterator(queue.begin()),
+                                    std::make_move_iterator(queue.end()));
+    }
+    _conn->event_loop_watch_writable(socket->get(), true);
+}
+
+SimpleDBus::UnixFd Characteristic::server_notify_acquire(uint16_t mtu) {
+    server_notify_release();
+
+    int sockets[2];
+    if (socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_NONBLOCK | SOCK_CLOEXEC, 0, sockets) != 0) {
+        return SimpleDBus::UnixFd();
+    }
+    SimpleDBus::UnixFd local(sockets[0]);
+    SimpleDBus::UnixFd remote(sockets[1]);
+
+    // BlueZ never writes to the socket, it only becomes readable once BlueZ closes it on unsubscribe.
+    int raw_fd = local.get();
+    _conn->event_loop_add_fd(raw_fd, [this, raw_fd]() { server_notify_socket_event(raw_fd); });
+
+    std::scoped_lock lock(_server_notify_mutex);
+    _server_notify_socket = std::make_shared<SimpleDBus::UnixFd>(std::move(local));
+    // BlueZ reads at most one MTU per packet, of which the ATT header takes 3 bytes.
+    _server_notify_max_length = mtu > 3 ? mtu - 3 : 0;
+    return remote;
+}
+
+void Characteristic::server_notify_socket_event(int fd) {
+    char buffer[1];
+    ssize_t length = recv(fd, buffer, sizeof(buffer), MSG_DONTWAIT);
+    if (length > 0 || (length < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))) {
+        // Still open, so this is the socket draining after a flush found it full.
+        _conn->event_loop_watch_writable(fd, false);
+        server_notify_flush();
+        return;
+    }
+
+    server_notify_release();
+
+    auto characteristic1 = gattcharacteristic1();
+    characteristic1->NotifyAcquired.set(false).emit();
+    characteristic1->OnStopNotify();
+}
+
+void Characteristic::server_notify_release() {
+    std::shared_ptr<SimpleDBus::UnixFd> socket;
+    {
+        std::scoped_lock lock(_server_notify_mutex);
+        socket = std::move(_server_notify_socket);
+        // Whatever still waits for the socket to drain goes out as signals instead.
+        if (socket && !_server_notify_queue.empty()) eventfd_write(_server_notify_wakeup.get(), 1);
+    }
+    if (!socket) return;
+
+    _conn->event_loop_remove_fd(socket->get());
+}
+
 std::shared_ptr<Descriptor> Characteristic::descriptor_add(const std::string& name) {
     const std::string descriptor_path = _path + "/descriptor_" + name;
     auto descriptor = Proxy::create<Descriptor>(_conn, _bus_name, descriptor_path);
@@ -36,6 +36,14 @@ ByteArray Descriptor::read() { return gattdescriptor1()->ReadValue(); }
 
 void Descriptor::write(ByteArray value) { gattdescriptor1()->WriteValue(value); }
 
+void Descriptor::read_async(std::function<void(ByteArray value, std::exception_ptr error)> callback) {
+    gattdescriptor1()->ReadValueAsync(std::move(callback));
+}
+
+void Descriptor::write_async(ByteArray value, std::function<void(std::exception_ptr error)> callback) {
+    gattdescriptor1()->WriteValueAsync(value, std::move(callback));
+}
+
 void Descriptor::set_on_value_changed(std::function<void(ByteArray new_value)> callback) {
     gattdescriptor1()->Value.on_changed.load(callback);
 }
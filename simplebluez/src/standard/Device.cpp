@@ -44,8 +44,101 @@ std::shared_ptr<Service> Device::get_service(const std::string& uuid) {
 
 std::shared_ptr<Characteristic> Device::get_characteristic(const std::string& service_uuid,
                                                            const std::string& characteristic_uuid) {
-    auto service = get_service(service_uuid);
-    return service->get_characteristic(characteristic_uuid);
+    return characteristic_entry(service_uuid, characteristic_uuid).characteristic;
+}
+
+Device::CharacteristicEntry Device::characteristic_entry(const std::string& service_uuid,
+                                                         const std::string& characteristic_uuid) {
+    // BlueZ only hands out 128-bit UUIDs, so anything else can't match.
+    auto service = UUID128::parse(service_uuid);
+    if (!service) throw Exception::ServiceNotFoundException(service_uuid);
+    auto characteristic = UUID128::parse(characteristic_uuid);
+    if (!characteristic) throw Exception::CharacteristicNotFoundException(characteristic_uuid);
+
+    return characteristic_entry(*service, *characteristic);
+}
+
+Device::CharacteristicEntry Device::characteristic_entry(const UUID128& service_uuid,
+                                                         const UUID128& characteristic_uuid) {
+    // The GATT table is only complete once services are resolved, until then walk the tree directly.
+    if (!services_resolved()) {
+        auto characteristic = get_service(service_uuid.str())->get_characteristic(characteristic_uuid.str());
+        return {characteristic, characteristic->capabilities()};
+    }
+
+    uint64_t generation;
+    {
+        std::scoped_lock lock(_gatt_index_mutex);
+        if (_gatt_index_valid) {
+            const CharacteristicEntry* entry = gatt_index_find(_gatt_index, service_uuid, characteristic_uuid);
+            if (!entry) return gatt_index_lookup(_gatt_index, service_uuid, characteristic_uuid);
+            if (entry->characteristic->valid()) return *entry;
+        }
+        generation = _gatt_index_generation;
+    }
+
+    // Walking the tree takes the locks of every proxy on the way, so it is done without holding up other lookups.
+    GattIndex index = gatt_index_build();
+
+    std::scoped_lock lock(_gatt_index_mutex);
+    if (generation != _gatt_index_generation) {
+        // Attributes changed during the walk. The result still answers this lookup, the next one builds again.
+        return gatt_index_lookup(index, service_uuid, characteristic_uuid);
+    }
+    _gatt_index = std::move(index);
+    _gatt_index_valid = true;
+    return gatt_index_lookup(_gatt_index, service_uuid, characteristic_uuid);
+}
+
+void Device::on_descendant_changed(const std::string& path) {
+    std::scoped_lock lock(_gatt_index_mutex);
+    _gatt_index_valid = false;
+    _gatt_index_generation++;
+}
+
+const Device::CharacteristicEntry* Device::gatt_index_find(const GattIndex& index, const UUID128& service_uuid,
+                                                           const UUID128& characteristic_uuid) {
+    auto service_it = index.find(service_uuid);
+    if (service_it == index.end()) return nullptr;
+
+    auto characteristic_it = service_it->second.find(characteristic_uuid);
+    if (characteristic_it == service_it->second.end()) return nullptr;
+
+    return &characteristic_it->second;
+}
+
+Device::CharacteristicEntry Device::gatt_index_lookup(const GattIndex& index, const UUID128& service_uuid,
+                                                      const UUID128& characteristic_uuid) {
+    const CharacteristicEntry* entry = gatt_index_find(index, service_uuid, characteristic_uuid);
+    if (!entry) {
+        if (index.count(service_uuid) == 0) {
+            throw Exception::ServiceNotFoundException(service_uuid.str());
+        }
+        throw Exception::CharacteristicNotFoundException(characteristic_uuid.str());
+    }
+    return *entry;
+}
+
+Device::GattIndex Device::gatt_index_build() {
+    GattIndex index;
+
+    for (auto& service : services()) {
+        if (!service->valid()) continue;
+        auto service_uuid = UUID128::parse(service->uuid());
+        if (!service_uuid) continue;
+
+        // Same as get_service(), the first service and characteristic with a given UUID wins.
+        auto& characteristics = index[*service_uuid];
+        for (auto& characteristic : service->characteristics()) {
+            if (!characteristic->valid()) continue;
+            auto characteristic_uuid = UUID128::parse(characteristic->uuid());
+            if (!characteristic_uuid) continue;
+
+            characteristics.emplace(*characteristic_uuid,
+                                    CharacteristicEntry{characteristic, characteristic->capabilities()});
+        }
+    }
+    return index;
 }
 
 void Device::pair() { device1()->Pair(); }
@@ -68,6 +161,9 @@ int16_t Device::rssi() { return device1()->RSSI; }
 
 int16_t Device::tx_power() { return device1()->TxPower; }
 
+// BlueZ only exposes TxPower once the device advertised it, otherwise the property is left unset.
+bool Device::has_tx_power() { return device1()->TxPower.valid(); }
+
 std::vector<std::string> Device::uuids() { return device1()->UUIDs.refresh(); }
 
 std::map<uint16_t, ByteArray> Device::manufacturer_data() { return device1()->ManufacturerData.refresh(); }
@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+
+#include <simpledbus/base/Exceptions.h>
+#include <simplebluez/standard/Adapter.h>
+
+#include <dbus/dbus.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace SimpleBluez;
+using namespace std::chrono_literals;
+using SimpleDBus::Holder;
+
+static const std::string ADAPTER_PATH = "/org/bluez/hci0";
+static const std::string DEVICE_PATH = "/org/bluez/hci0/dev_00_11_22_33_44_55";
+
+// Stands in for BlueZ on the session bus, answering RemoveDevice for a single known device. Replies are held back
+// until the test lets them through, so a caller waiting for one would be caught stalling the event loop.
+class AdapterTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        // Connections made through SimpleDBus share a single bus connection, so BlueZ gets a private one.
+        DBusError err;
+        dbus_error_init(&err);
+        bluez = dbus_connection_open_private(getenv("DBUS_SESSION_BUS_ADDRESS"), &err);
+        ASSERT_NE(bluez, nullptr) << err.message;
+        dbus_bus_register(bluez, nullptr);
+        dbus_connection_add_filter(bluez, &AdapterTest::bluez_filter, this, nullptr);
+
+        conn = std::make_shared<SimpleDBus::Connection>(DBUS_BUS_SESSION);
+        conn->init();
+
+        active = true;
+        loop_bluez = std::thread([this]() {
+            while (active) dbus_connection_read_write_dispatch(bluez, 100);
+        });
+        loop_conn = std::thread([this]() {
+            while (active) conn->event_loop_iterate(100ms);
+        });
+
+        adapter = SimpleDBus::Proxy::create<Adapter>(conn, dbus_bus_get_unique_name(bluez), ADAPTER_PATH);
+        Holder interfaces = Holder::create<std::map<std::string, Holder>>();
+        interfaces.dict_append(Holder::STRING, "org.bluez.Adapter1", Holder::create<std::map<std::string, Holder>>());
+        adapter->interfaces_load(interfaces);
+    }
+
+    void TearDown() override {
+        release();
+        adapter.reset();
+
+        active = false;
+        loop_bluez.join();
+        conn->event_loop_wakeup();
+        loop_conn.join();
+
+        dbus_connection_close(bluez);
+        dbus_connection_unref(bluez);
+        conn->uninit();
+    }
+
+    static DBusHandlerResult bluez_filter(DBusConnection* connection, DBusMessage* message, void* user_data) {
+        SimpleDBus::Message msg = SimpleDBus::Message::from_retained(message);
+        return static_cast<AdapterTest*>(user_data)->bluez_handle(msg) ? DBUS_HANDLER_RESULT_HANDLED
+                                                                       : DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
+    }
+
+    bool bluez_handle(SimpleDBus::Message& msg) {
+        if (!msg.is_method_call("org.bluez.Adapter1", "RemoveDevice") || msg.get_path() != ADAPTER_PATH) return false;
+
+        std::string path = msg.extract().get<SimpleDBus::ObjectPath>();
+        record("remove " + path);
+        {
+            std::unique_lock lock(events_mutex);
+            events_cv.wait_for(lock, 2s, [&]() { return released; });
+        }
+
+        SimpleDBus::Message reply = path == DEVICE_PATH
+                                        ? SimpleDBus::Message::create_method_return(msg)
+                                        : SimpleDBus::Message::create_error(msg, "org.bluez.Error.DoesNotExist",
+                                                                            "Does Not Exist");
+        dbus_connection_send(bluez, reply, nullptr);
+        return true;
+    }
+
+    void release() {
+        std::scoped_lock lock(events_mutex);
+        released = true;
+        events_cv.notify_all();
+    }
+
+    void record(const std::string& event) {
+        std::scoped_lock lock(events_mutex);
+        events.push_back(event);
+        events_cv.notify_all();
+    }
+
+    std::vector<std::string> events_wait(size_t count) {
+        std::unique_lock lock(events_mutex);
+        events_cv.wait_for(lock, 2s, [&]() { return events.size() >= count; });
+        std::vector<std::string> result;
+        result.swap(events);
+        return result;
+    }
+
+    DBusConnection* bluez = nullptr;
+    std::shared_ptr<SimpleDBus::Connection> conn;
+    std::shared_ptr<Adapter> adapter;
+
+    std::atomic_bool active;
+    std::thread loop_bluez;
+    std::thread loop_conn;
+
+    std::mutex events_mutex;
+    std::condition_variable events_cv;
+    std::vector<std::string> events;
+    bool released = false;
+};
+
+TEST_F(AdapterTest, RemoveDeviceDoesNotStallDispatch) {
+    // Runs the removal from the thread dispatching the connection, the way scan results are handled.
+    int fds[2];
+    ASSERT_EQ(pipe(fds), 0);
+    conn->event_loop_add_fd(fds[0], [&]() {
+        char byte;
+        (void)!read(fds[0], &byte, 1);
+        adapter->device_remove_async(DEVICE_PATH, [&](std::exception_ptr error) {
+            record(error ? "failed" : "removed");
+        });
+        record("returned");
+    });
+    (void)!write(fds[1], "x", 1);
+
+    // BlueZ holds its reply until the handler is back, which only happens if nothing waits for it.
+    auto events_seen = events_wait(2);
+    std::sort(events_seen.begin(), events_seen.end());
+    EXPECT_EQ(events_seen, (std::vector<std::string>{"remove " + DEVICE_PATH, "returned"}));
+
+    release();
+    EXPECT_EQ(events_wait(1), (std::vector<std::string>{"removed"}));
+
+    conn->event_loop_remove_fd(fds[0]);
+    close(fds[0]);
+    close(fds[1]);
+}
+
+TEST_F(AdapterTest, RemoveDeviceReportsErrors) {
+    release();
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::exception_ptr error;
+    bool done = false;
+    adapter->device_remove_async(DEVICE_PATH + "_missing", [&](std::exception_ptr result) {
+        std::scoped_lock lock(mutex);
+        error = result;
+        done = true;
+        cv.notify_all();
+    });
+
+    std::unique_lock lock(mutex);
+    ASSERT_TRUE(cv.wait_for(lock, 2s, [&]() { return done; }));
+    ASSERT_TRUE(error);
+    try {
+        std::rethrow_exception(error);
+    } catch (const SimpleDBus::Exception::SendFailed& e) {
+        EXPECT_EQ(e.error_name(), "org.bluez.Error.DoesNotExist");
+    }
+}
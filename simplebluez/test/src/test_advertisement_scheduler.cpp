@@ -0,0 +1,225 @@
+#include <gtest/gtest.h>
+
+#include <simplebluez/standard/AdvertisementScheduler.h>
+
+#include <dbus/dbus.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace SimpleBluez;
+using namespace std::chrono_literals;
+using SimpleDBus::Holder;
+
+static const std::string ADAPTER_PATH = "/org/bluez/hci0";
+
+// Stands in for BlueZ on the session bus, answering for the adapter and recording every call and every
+// PropertiesChanged it receives from the advertisements.
+class AdvertisementSchedulerTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        // Connections made through SimpleDBus share a single bus connection, so BlueZ gets a private one.
+        DBusError err;
+        dbus_error_init(&err);
+        bluez = dbus_connection_open_private(getenv("DBUS_SESSION_BUS_ADDRESS"), &err);
+        ASSERT_NE(bluez, nullptr) << err.message;
+        dbus_bus_register(bluez, nullptr);
+        dbus_bus_add_match(bluez, "type='signal',interface='org.freedesktop.DBus.Properties'", nullptr);
+        dbus_connection_add_filter(bluez, &AdvertisementSchedulerTest::bluez_filter, this, nullptr);
+
+        conn = std::make_shared<SimpleDBus::Connection>(DBUS_BUS_SESSION);
+        conn->init();
+
+        active = true;
+        loop_bluez = std::thread([this]() {
+            while (active) dbus_connection_read_write_dispatch(bluez, 100);
+        });
+        loop_conn = std::thread([this]() {
+            while (active) conn->event_loop_iterate(100ms);
+        });
+
+        adapter = SimpleDBus::Proxy::create<Adapter>(conn, dbus_bus_get_unique_name(bluez), ADAPTER_PATH);
+        Holder interfaces = Holder::create<std::map<std::string, Holder>>();
+        interfaces.dict_append(Holder::STRING, "org.bluez.LEAdvertisingManager1",
+                               Holder::create<std::map<std::string, Holder>>());
+        adapter->interfaces_load(interfaces);
+
+        root = SimpleDBus::Proxy::create<CustomRoot>(conn, "org.simplebluez", "/");
+    }
+
+    void TearDown() override {
+        adapter.reset();
+        root.reset();
+
+        active = false;
+        loop_bluez.join();
+        conn->event_loop_wakeup();
+        loop_conn.join();
+
+        dbus_connection_close(bluez);
+        dbus_connection_unref(bluez);
+        conn->uninit();
+    }
+
+    static DBusHandlerResult bluez_filter(DBusConnection* connection, DBusMessage* message, void* user_data) {
+        SimpleDBus::Message msg = SimpleDBus::Message::from_retained(message);
+        return static_cast<AdvertisementSchedulerTest*>(user_data)->bluez_handle(msg)
+                   ? DBUS_HANDLER_RESULT_HANDLED
+                   : DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
+    }
+
+    bool bluez_handle(SimpleDBus::Message& msg) {
+        if (msg.is_signal("org.freedesktop.DBus.Properties", "PropertiesChanged")) {
+            auto [interface, changed, invalidated] =
+                msg.extract<std::string, std::map<std::string, Holder>, std::vector<std::string>>();
+            std::string event = "changed " + msg.get_path();
+            for (auto& [name, value] : changed) {
+                event += " " + name;
+            }
+            record(event);
+            return true;
+        }
+        if (msg.get_type() != SimpleDBus::Message::Type::METHOD_CALL || msg.get_path() != ADAPTER_PATH) return false;
+
+        SimpleDBus::Message reply = SimpleDBus::Message::create_method_return(msg);
+        if (msg.is_method_call("org.freedesktop.DBus.Properties", "Get")) {
+            auto [interface, name] = msg.extract<std::string, std::string>();
+            uint8_t value = name == "SupportedInstances" ? supported_instances.load() : 0;
+            reply.append(SimpleDBus::Variant<uint8_t>{value});
+        } else if (msg.is_method_call("org.bluez.LEAdvertisingManager1", "RegisterAdvertisement")) {
+            std::string path = msg.extract().get<SimpleDBus::ObjectPath>();
+            if (!application_exports(dbus_message_get_sender(msg), path)) {
+                reply = SimpleDBus::Message::create_error(msg, "org.bluez.Error.InvalidArguments",
+                                                          "Advertisement not exported");
+            }
+            record("register " + path);
+        } else if (msg.is_method_call("org.bluez.LEAdvertisingManager1", "UnregisterAdvertisement")) {
+            record("unregister " + std::string(msg.extract().get<SimpleDBus::ObjectPath>()));
+        }
+        dbus_connection_send(bluez, reply, nullptr);
+        return true;
+    }
+
+    // Like BlueZ, reads the objects of the application before answering the registration, which only works while
+    // the application keeps dispatching its connection.
+    bool application_exports(const std::string& application, const std::string& path) {
+        auto query = SimpleDBus::Message::create_method_call(application, "/", "org.freedesktop.DBus.ObjectManager",
+                                                             "GetManagedObjects");
+        DBusError err;
+        dbus_error_init(&err);
+        DBusMessage* reply = dbus_connection_send_with_reply_and_block(bluez, query, 2000, &err);
+        if (reply == nullptr) {
+            dbus_error_free(&err);
+            return false;
+        }
+
+        auto objects = SimpleDBus::Message::from_acquired(reply).extract<std::map<SimpleDBus::ObjectPath, Holder>>();
+        return objects.count(SimpleDBus::ObjectPath(path)) != 0;
+    }
+
+    void record(const std::string& event) {
+        std::scoped_lock lock(events_mutex);
+        events.push_back(event);
+        events_cv.notify_all();
+    }
+
+    // Signals arrive asynchronously, while method calls are recorded before they return.
+    std::vector<std::string> events_wait(size_t count) {
+        std::unique_lock lock(events_mutex);
+        events_cv.wait_for(lock, 2s, [&]() { return events.size() >= count; });
+        std::vector<std::string> result;
+        result.swap(events);
+        return result;
+    }
+
+    std::shared_ptr<Advertisement> payload(const std::string& name, uint8_t value) {
+        auto advertisement = root->advertisement_add(name);
+        advertisement->manufacturer_data({{0x0059, ByteArray(std::vector<uint8_t>{value})}});
+        return advertisement;
+    }
+
+    DBusConnection* bluez = nullptr;
+    std::shared_ptr<SimpleDBus::Connection> conn;
+    std::shared_ptr<Adapter> adapter;
+    std::shared_ptr<CustomRoot> root;
+    std::atomic<uint8_t> supported_instances{2};
+
+    std::atomic_bool active;
+    std::thread loop_bluez;
+    std::thread loop_conn;
+
+    std::mutex events_mutex;
+    std::condition_variable events_cv;
+    std::vector<std::string> events;
+};
+
+TEST_F(AdvertisementSchedulerTest, RotatesThroughPropertiesChanged) {
+    auto a = payload("a", 1);
+    auto b = payload("b", 2);
+    auto c = payload("c", 3);
+
+    AdvertisementScheduler scheduler(adapter, root);
+    scheduler.add(a, 100ms);
+    scheduler.add(b, 100ms);
+    scheduler.add(c, 100ms);
+
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(scheduler.rotate(start), start + 100ms);
+    EXPECT_EQ(scheduler.on_air(), (std::vector<std::shared_ptr<Advertisement>>{a, b}));
+    EXPECT_EQ(events_wait(2), (std::vector<std::string>{"register /advertisement_rotation0",
+                                                        "register /advertisement_rotation1"}));
+
+    // Only the payload differs, so the instances stay registered.
+    scheduler.rotate(start + 100ms);
+    EXPECT_EQ(scheduler.on_air(), (std::vector<std::shared_ptr<Advertisement>>{c, a}));
+    EXPECT_EQ(events_wait(2), (std::vector<std::string>{"changed /advertisement_rotation0 ManufacturerData",
+                                                        "changed /advertisement_rotation1 ManufacturerData"}));
+
+    scheduler.stop();
+    EXPECT_EQ(events_wait(2), (std::vector<std::string>{"unregister /advertisement_rotation0",
+                                                        "unregister /advertisement_rotation1"}));
+}
+
+TEST_F(AdvertisementSchedulerTest, SharesAirTimeByWeight) {
+    supported_instances = 1;
+    auto a = payload("a", 1);
+    auto b = payload("b", 2);
+
+    AdvertisementScheduler scheduler(adapter, root);
+    scheduler.add(a, 100ms, 2);
+    scheduler.add(b, 100ms, 1);
+
+    std::map<std::shared_ptr<Advertisement>, int> turns;
+    auto now = std::chrono::steady_clock::now();
+    for (int i = 0; i < 30; i++) {
+        now = scheduler.rotate(now);
+        turns[scheduler.on_air().front()]++;
+    }
+    EXPECT_EQ(turns[a], 20);
+    EXPECT_EQ(turns[b], 10);
+}
+
+TEST_F(AdvertisementSchedulerTest, ParametersRequireRegistration) {
+    supported_instances = 1;
+    auto a = payload("a", 1);
+    auto b = payload("b", 1);
+    b->min_interval(200);
+
+    AdvertisementScheduler scheduler(adapter, root);
+    scheduler.add(a, 100ms);
+    scheduler.add(b, 100ms);
+
+    auto start = std::chrono::steady_clock::now();
+    scheduler.rotate(start);
+    scheduler.rotate(start + 100ms);
+    EXPECT_EQ(events_wait(3), (std::vector<std::string>{"register /advertisement_rotation0",
+                                                        "unregister /advertisement_rotation0",
+                                                        "register /advertisement_rotation0"}));
+}
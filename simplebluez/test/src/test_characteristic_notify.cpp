@@ -0,0 +1,246 @@
+#include <gtest/gtest.h>
+
+#include <simplebluez/standard/CustomRoot.h>
+
+#include <dbus/dbus.h>
+
+#include <sys/socket.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace SimpleBluez;
+using namespace std::chrono_literals;
+using SimpleDBus::Holder;
+
+// Stands in for BlueZ on the session bus, subscribing to a local characteristic and recording the values it
+// receives through PropertiesChanged.
+class CharacteristicNotifyTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        // Connections made through SimpleDBus share a single bus connection, so BlueZ gets a private one.
+        DBusError err;
+        dbus_error_init(&err);
+        bluez = dbus_connection_open_private(getenv("DBUS_SESSION_BUS_ADDRESS"), &err);
+        ASSERT_NE(bluez, nullptr) << err.message;
+        dbus_bus_register(bluez, nullptr);
+        dbus_bus_add_match(bluez, "type='signal',interface='org.freedesktop.DBus.Properties'", nullptr);
+        dbus_connection_add_filter(bluez, &CharacteristicNotifyTest::bluez_filter, this, nullptr);
+
+        conn = std::make_shared<SimpleDBus::Connection>(DBUS_BUS_SESSION);
+        conn->init();
+
+        active = true;
+        loop_bluez = std::thread([this]() {
+            while (active) dbus_connection_read_write_dispatch(bluez, 100);
+        });
+        loop_conn = std::thread([this]() {
+            while (active) conn->event_loop_iterate(100ms);
+        });
+
+        root = SimpleDBus::Proxy::create<CustomRoot>(conn, "org.simplebluez", "/");
+        characteristic = root->service_mgr_add("app")->service_add("s")->characteristic_add("c");
+    }
+
+    void TearDown() override {
+        characteristic.reset();
+        root.reset();
+
+        active = false;
+        loop_bluez.join();
+        conn->event_loop_wakeup();
+        loop_conn.join();
+
+        dbus_connection_close(bluez);
+        dbus_connection_unref(bluez);
+        conn->uninit();
+    }
+
+    static DBusHandlerResult bluez_filter(DBusConnection* connection, DBusMessage* message, void* user_data) {
+        SimpleDBus::Message msg = SimpleDBus::Message::from_retained(message);
+        auto test = static_cast<CharacteristicNotifyTest*>(user_data);
+        if (!msg.is_signal("org.freedesktop.DBus.Properties", "PropertiesChanged") ||
+            msg.get_path() != test->characteristic_path) {
+            return DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
+        }
+
+        auto [interface, changed, invalidated] =
+            msg.extract<std::string, std::map<std::string, Holder>, std::vector<std::string>>();
+        if (changed.count("Value") != 0) test->record(changed["Value"].get<ByteArray>());
+        return DBUS_HANDLER_RESULT_HANDLED;
+    }
+
+    void record(const ByteArray& value) {
+        std::scoped_lock lock(signals_mutex);
+        signals.push_back(value);
+        signals_cv.notify_all();
+    }
+
+    std::vector<ByteArray> signals_wait(size_t count) {
+        std::unique_lock lock(signals_mutex);
+        signals_cv.wait_for(lock, 2s, [&]() { return signals.size() >= count; });
+        std::vector<ByteArray> result;
+        result.swap(signals);
+        return result;
+    }
+
+    // Calls AcquireNotify the way BlueZ does once a client subscribes, returning the socket handed out.
+    SimpleDBus::UnixFd acquire_notify() {
+        auto msg = SimpleDBus::Message::create_method_call(conn->unique_name(), characteristic_path,
+                                                           "org.bluez.GattCharacteristic1", "AcquireNotify");
+        Holder options = Holder::create<std::map<std::string, Holder>>();
+        options.dict_append(Holder::STRING, "mtu", Holder::create<uint16_t>(23));
+        msg.append_argument(options, "a{sv}");
+
+        DBusError err;
+        dbus_error_init(&err);
+        DBusMessage* reply = dbus_connection_send_with_reply_and_block(bluez, msg, 2000, &err);
+        EXPECT_NE(reply, nullptr) << err.message;
+        if (reply == nullptr) return SimpleDBus::UnixFd();
+
+        SimpleDBus::Message reply_msg = SimpleDBus::Message::from_acquired(reply);
+        auto [fd, mtu] = reply_msg.extract<SimpleDBus::UnixFd, uint16_t>();
+        return std::move(fd);
+    }
+
+    // Drains the socket without blocking.
+    static std::vector<ByteArray> socket_read(int fd) {
+        std::vector<ByteArray> values;
+        uint8_t buffer[512];
+        ssize_t length;
+        while ((length = recv(fd, buffer, sizeof(buffer), MSG_DONTWAIT)) > 0) {
+            values.emplace_back(buffer, static_cast<size_t>(length));
+        }
+        return values;
+    }
+
+    static ByteArray numbered(uint32_t value) {
+        return ByteArray(reinterpret_cast<const uint8_t*>(&value), sizeof(value));
+    }
+
+    static uint32_t number(const ByteArray& value) {
+        uint32_t result = 0;
+        std::memcpy(&result, value.data(), std::min(value.size(), sizeof(result)));
+        return result;
+    }
+
+    DBusConnection* bluez = nullptr;
+    std::shared_ptr<SimpleDBus::Connection> conn;
+    std::shared_ptr<CustomRoot> root;
+    std::shared_ptr<Characteristic> characteristic;
+    const std::string characteristic_path = "/application_app/service_s/characteristic_c";
+
+    std::atomic_bool active;
+    std::thread loop_bluez;
+    std::thread loop_conn;
+
+    std::mutex signals_mutex;
+    std::condition_variable signals_cv;
+    std::vector<ByteArray> signals;
+};
+
+TEST_F(CharacteristicNotifyTest, SignalsKeepOrder) {
+    characteristic->notify(std::vector<ByteArray>{numbered(0), numbered(1), numbered(2)});
+
+    auto received = signals_wait(3);
+    ASSERT_EQ(received.size(), 3);
+    for (uint32_t i = 0; i < 3; i++) {
+        EXPECT_EQ(number(received[i]), i);
+    }
+    EXPECT_EQ(number(characteristic->value()), 2);
+}
+
+TEST_F(CharacteristicNotifyTest, AcquiredSocketIsUsedUntilFull) {
+    characteristic->allow_acquire_notify(true);
+    SimpleDBus::UnixFd remote = acquire_notify();
+    ASSERT_TRUE(remote.is_valid());
+
+    characteristic->notify(std::vector<ByteArray>{numbered(0), numbered(1)});
+    std::this_thread::sleep_for(100ms);
+    auto sent = socket_read(remote.get());
+    ASSERT_EQ(sent.size(), 2);
+    EXPECT_EQ(number(sent[0]), 0);
+    EXPECT_EQ(number(sent[1]), 1);
+
+    // Far more than the socket buffers, so that it fills up part of the way through.
+    constexpr uint32_t COUNT = 2000;
+    std::vector<ByteArray> values;
+    for (uint32_t i = 0; i < COUNT; i++) {
+        values.push_back(numbered(i));
+    }
+    characteristic->notify(values);
+
+    std::this_thread::sleep_for(100ms);
+    sent = socket_read(remote.get());
+    ASSERT_FALSE(sent.empty());
+    ASSERT_LT(sent.size(), COUNT);
+
+    // The rest waits for the socket to drain rather than overtaking it as signals.
+    auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (sent.size() < COUNT && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(10ms);
+        auto more = socket_read(remote.get());
+        sent.insert(sent.end(), more.begin(), more.end());
+    }
+    ASSERT_EQ(sent.size(), COUNT);
+    for (uint32_t i = 0; i < COUNT; i++) {
+        EXPECT_EQ(number(sent[i]), i);
+    }
+    EXPECT_TRUE(signals_wait(0).empty());
+    EXPECT_EQ(number(characteristic->value()), COUNT - 1);
+}
+
+TEST_F(CharacteristicNotifyTest, ReleasedSocketFallsBackToSignals) {
+    characteristic->allow_acquire_notify(true);
+    SimpleDBus::UnixFd remote = acquire_notify();
+    ASSERT_TRUE(remote.is_valid());
+
+    constexpr uint32_t COUNT = 2000;
+    std::vector<ByteArray> values;
+    for (uint32_t i = 0; i < COUNT; i++) {
+        values.push_back(numbered(i));
+    }
+    characteristic->notify(values);
+    std::this_thread::sleep_for(100ms);
+
+    // Whatever was still waiting for the socket when BlueZ closed it goes out as signals, up to the last value.
+    remote = SimpleDBus::UnixFd();
+    auto received = signals_wait(1);
+    auto deadline = std::chrono::steady_clock::now() + 5s;
+    while ((received.empty() || number(received.back()) != COUNT - 1) && std::chrono::steady_clock::now() < deadline) {
+        auto more = signals_wait(1);
+        received.insert(received.end(), more.begin(), more.end());
+    }
+    ASSERT_FALSE(received.empty());
+    uint32_t first = number(received.front());
+    EXPECT_GT(first, 0);
+    ASSERT_EQ(received.size(), COUNT - first);
+    for (uint32_t i = 0; i < received.size(); i++) {
+        EXPECT_EQ(number(received[i]), first + i);
+    }
+}
+
+TEST_F(CharacteristicNotifyTest, ValuesBeyondTheMtuAreRejected) {
+    characteristic->allow_acquire_notify(true);
+    SimpleDBus::UnixFd remote = acquire_notify();
+    ASSERT_TRUE(remote.is_valid());
+
+    // The ATT header takes 3 of the 23 bytes.
+    EXPECT_THROW(characteristic->notify(ByteArray(std::string(21, 'x'))), std::invalid_argument);
+    characteristic->notify(ByteArray(std::string(20, 'x')));
+
+    std::this_thread::sleep_for(100ms);
+    auto sent = socket_read(remote.get());
+    ASSERT_EQ(sent.size(), 1);
+    EXPECT_EQ(sent[0].size(), 20);
+}
@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+
+#include <simplebluez/Exceptions.h>
+#include <simplebluez/standard/Device.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace SimpleBluez;
+using SimpleDBus::Holder;
+
+static const std::string DEVICE_PATH = "/org/bluez/hci0/dev_00_11_22_33_44_55";
+static const std::string SERVICE_UUID = "0000180f-0000-1000-8000-00805f9b34fb";
+static const std::string CHARACTERISTIC_UUID = "00002a19-0000-1000-8000-00805f9b34fb";
+
+static Holder interface(const std::string& name, std::map<std::string, Holder> properties) {
+    Holder holder_properties = Holder::create<std::map<std::string, Holder>>();
+    for (auto& [key, value] : properties) {
+        holder_properties.dict_append(Holder::STRING, key, value);
+    }
+
+    Holder interfaces = Holder::create<std::map<std::string, Holder>>();
+    interfaces.dict_append(Holder::STRING, name, holder_properties);
+    return interfaces;
+}
+
+static Holder flags(const std::vector<std::string>& values) {
+    Holder result = Holder::create<std::vector<Holder>>();
+    for (auto& value : values) {
+        result.array_append(Holder::create<std::string>(value));
+    }
+    return result;
+}
+
+static Holder removed(const std::string& name) {
+    Holder result = Holder::create<std::vector<Holder>>();
+    result.array_append(Holder::create<std::string>(name));
+    return result;
+}
+
+class DeviceGattIndex : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        device = SimpleDBus::Proxy::create<Device>(nullptr, "org.bluez", DEVICE_PATH);
+        device->interfaces_load(interface("org.bluez.Device1", {{"Connected", Holder::create<bool>(true)},
+                                                                {"ServicesResolved", Holder::create<bool>(true)}}));
+
+        for (int i = 0; i < 4; i++) {
+            std::string service_path = DEVICE_PATH + "/service000" + std::to_string(i);
+            std::string service_uuid = i == 3 ? SERVICE_UUID : "0000180" + std::to_string(i) + "-0000-1000-8000-00805f9b34fb";
+            device->path_add(service_path,
+                             interface("org.bluez.GattService1", {{"UUID", Holder::create<std::string>(service_uuid)}}));
+        }
+        characteristic_add("char0001", CHARACTERISTIC_UUID, {"read", "notify"});
+    }
+
+    void characteristic_add(const std::string& name, const std::string& uuid, const std::vector<std::string>& values) {
+        device->path_add(DEVICE_PATH + "/service0003/" + name,
+                         interface("org.bluez.GattCharacteristic1",
+                                   {{"UUID", Holder::create<std::string>(uuid)}, {"Flags", flags(values)}}));
+    }
+
+    std::shared_ptr<Device> device;
+};
+
+TEST_F(DeviceGattIndex, LookupReportsCapabilities) {
+    auto entry = device->characteristic_entry(SERVICE_UUID, CHARACTERISTIC_UUID);
+
+    ASSERT_NE(entry.characteristic, nullptr);
+    EXPECT_EQ(entry.characteristic->uuid(), CHARACTERISTIC_UUID);
+    EXPECT_EQ(entry.capabilities, Characteristic::CAN_READ | Characteristic::CAN_NOTIFY);
+    EXPECT_EQ(device->get_characteristic(SERVICE_UUID, CHARACTERISTIC_UUID), entry.characteristic);
+}
+
+TEST_F(DeviceGattIndex, MissingAttributesThrow) {
+    EXPECT_THROW(device->characteristic_entry("00001810-0000-1000-8000-00805f9b34fb", CHARACTERISTIC_UUID),
+                 Exception::ServiceNotFoundException);
+    EXPECT_THROW(device->characteristic_entry(SERVICE_UUID, "00002a00-0000-1000-8000-00805f9b34fb"),
+                 Exception::CharacteristicNotFoundException);
+}
+
+TEST_F(DeviceGattIndex, FollowsAddedAndRemovedAttributes) {
+    auto first = device->characteristic_entry(SERVICE_UUID, CHARACTERISTIC_UUID).characteristic;
+
+    const std::string added_uuid = "00002a1a-0000-1000-8000-00805f9b34fb";
+    characteristic_add("char0002", added_uuid, {"write-without-response"});
+    EXPECT_EQ(device->characteristic_entry(SERVICE_UUID, added_uuid).capabilities, Characteristic::CAN_WRITE_COMMAND);
+
+    // A characteristic removed and announced again under the same UUID must not resolve to the stale proxy.
+    device->path_remove(DEVICE_PATH + "/service0003/char0001", removed("org.bluez.GattCharacteristic1"));
+    characteristic_add("char0003", CHARACTERISTIC_UUID, {"indicate"});
+
+    auto entry = device->characteristic_entry(SERVICE_UUID, CHARACTERISTIC_UUID);
+    EXPECT_TRUE(entry.characteristic->valid());
+    EXPECT_EQ(entry.capabilities, Characteristic::CAN_INDICATE);
+}
+
+TEST_F(DeviceGattIndex, NotifyAcquiredIsReportedAsCapability) {
+    const std::string acquirable_uuid = "00002a1b-0000-1000-8000-00805f9b34fb";
+    device->path_add(DEVICE_PATH + "/service0003/char0002",
+                     interface("org.bluez.GattCharacteristic1", {{"UUID", Holder::create<std::string>(acquirable_uuid)},
+                                                                 {"Flags", flags({"notify"})},
+                                                                 {"NotifyAcquired", Holder::create<bool>(false)}}));
+
+    EXPECT_EQ(device->characteristic_entry(SERVICE_UUID, acquirable_uuid).capabilities,
+              Characteristic::CAN_NOTIFY | Characteristic::CAN_NOTIFY_ACQUIRE);
+    EXPECT_FALSE(device->characteristic_entry(SERVICE_UUID, CHARACTERISTIC_UUID).capabilities &
+                 Characteristic::CAN_NOTIFY_ACQUIRE);
+}
+
+TEST_F(DeviceGattIndex, UnresolvedServicesBypassIndex) {
+    device->characteristic_entry(SERVICE_UUID, CHARACTERISTIC_UUID);
+
+    device->interfaces_load(interface("org.bluez.Device1", {{"ServicesResolved", Holder::create<bool>(false)}}));
+    auto entry = device->characteristic_entry(SERVICE_UUID, CHARACTERISTIC_UUID);
+    EXPECT_EQ(entry.capabilities, Characteristic::CAN_READ | Characteristic::CAN_NOTIFY);
+}
+
+TEST_F(DeviceGattIndex, BinaryUuidsMatchText) {
+    auto service = UUID128::parse(SERVICE_UUID);
+    auto characteristic = UUID128::parse("00002A19-0000-1000-8000-00805F9B34FB");
+    ASSERT_TRUE(service && characteristic);
+    EXPECT_EQ(characteristic->str(), CHARACTERISTIC_UUID);
+    EXPECT_EQ(*service, (UUID128{0x0000180f00001000, 0x800000805f9b34fb}));
+    EXPECT_FALSE(UUID128::parse("180f"));
+
+    auto entry = device->characteristic_entry(*service, *characteristic);
+    EXPECT_EQ(entry.characteristic, device->characteristic_entry(SERVICE_UUID, CHARACTERISTIC_UUID).characteristic);
+}
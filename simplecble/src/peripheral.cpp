@@ -229,7 +229,7 @@ simpleble_err_t simpleble_peripheral_services_get(simpleble_peripheral_t handle,
 
         SimpleBLE::Service service = peripheral_services[index];
 
-        memcpy(services->uuid.value, service.uuid().c_str(), SIMPLEBLE_UUID_STR_LEN);
+        memcpy(services->uuid.value, service.uuid().str().c_str(), SIMPLEBLE_UUID_STR_LEN);
 
         services->data_length = service.data().size();
         memcpy(services->data, service.data().data(), service.data().size());
@@ -248,7 +248,7 @@ simpleble_err_t simpleble_peripheral_services_get(simpleble_peripheral_t handle,
             services->characteristics[i].can_notify = characteristic.can_notify();
             services->characteristics[i].can_indicate = characteristic.can_indicate();
 
-            memcpy(services->characteristics[i].uuid.value, characteristic.uuid().c_str(), SIMPLEBLE_UUID_STR_LEN);
+            memcpy(services->characteristics[i].uuid.value, characteristic.uuid().str().c_str(), SIMPLEBLE_UUID_STR_LEN);
             services->characteristics[i].descriptor_count = characteristic.descriptors().size();
 
             if (services->characteristics[i].descriptor_count > SIMPLEBLE_DESCRIPTOR_MAX_COUNT) {
@@ -258,7 +258,7 @@ simpleble_err_t simpleble_peripheral_services_get(simpleble_peripheral_t handle,
             for (size_t j = 0; j < services->characteristics[i].descriptor_count; j++) {
                 SimpleBLE::Descriptor descriptor = characteristic.descriptors()[j];
 
-                memcpy(services->characteristics[i].descriptors[j].uuid.value, descriptor.uuid().c_str(),
+                memcpy(services->characteristics[i].descriptors[j].uuid.value, descriptor.uuid().str().c_str(),
                        SIMPLEBLE_UUID_STR_LEN);
             }
         }
@@ -1,5 +1,6 @@
 #pragma once
 #include <chrono>
+#include <cstddef>
 
 namespace SimpleDBus {
 namespace Config {
@@ -7,7 +8,14 @@ namespace Config {
 namespace Connection {
 extern std::chrono::steady_clock::duration send_with_reply_timeout;
 
-static void reset() { send_with_reply_timeout = std::chrono::seconds(30); }
+// Number of threads running message handlers. With 0, handlers run on the thread dispatching the connection.
+// Read when the connection is initialized.
+extern size_t dispatch_workers;
+
+static void reset() {
+    send_with_reply_timeout = std::chrono::seconds(30);
+    dispatch_workers = 0;
+}
 }  // namespace Connection
 
 namespace Base {
@@ -3,6 +3,7 @@
 #include <simpledbus/base/Connection.h>
 
 #include <atomic>
+#include <chrono>
 #include <functional>
 #include <map>
 #include <memory>
@@ -36,11 +37,60 @@ class Interface {
         PropertyBase(PropertyBase&&) noexcept = delete;
         PropertyBase& operator=(PropertyBase&&) noexcept = delete;
 
+        /**
+         * Fetch the latest value from the bus. When caching is enabled for this property the round trip is
+         * skipped as long as the cached value is valid and younger than the configured maximum age.
+         */
         PropertyBase& refresh() {
-            _interface.property_refresh(_name);
+            if (stale()) {
+                _interface.property_refresh(_name);
+            }
             return *this;
         }
 
+        /**
+         * Trust values delivered through PropertiesChanged/InterfacesAdded instead of fetching them on refresh().
+         * A max_age bounds how long a value may go without an update before refresh() fetches it again.
+         */
+        PropertyBase& cache(std::chrono::steady_clock::duration max_age = std::chrono::steady_clock::duration::max()) {
+            std::scoped_lock lock(_mutex);
+            _cached = true;
+            _max_age = max_age;
+            return *this;
+        }
+
+        PropertyBase& uncache() {
+            std::scoped_lock lock(_mutex);
+            _cached = false;
+            return *this;
+        }
+
+        bool cached() const {
+            std::scoped_lock lock(_mutex);
+            return _cached;
+        }
+
+        /**
+         * Leave the property out of Get/GetAll replies of a local object until it is given a value. Some
+         * properties only describe remote objects, or announce a feature by merely being present.
+         */
+        PropertyBase& optional() {
+            std::scoped_lock lock(_mutex);
+            _optional = true;
+            return *this;
+        }
+
+        bool exported() const {
+            std::scoped_lock lock(_mutex);
+            return _valid || !_optional;
+        }
+
+        bool stale() const {
+            std::scoped_lock lock(_mutex);
+            if (!_cached || !_valid) return true;
+            return std::chrono::steady_clock::now() - _updated > _max_age;
+        }
+
         void emit() { _interface.property_emit(_name, get()); }
 
         Holder get() const {
@@ -51,7 +101,7 @@ class Interface {
         PropertyBase& set(Holder value) {
             std::scoped_lock lock(_mutex);
             _value = value;
-            _valid = true;
+            validate();
             notify_changed();
             return *this;
         }
@@ -66,6 +116,13 @@ class Interface {
             _valid = false;
         }
 
+        // Mark the current value as confirmed by the bus.
+        void validate() {
+            std::scoped_lock lock(_mutex);
+            _valid = true;
+            _updated = std::chrono::steady_clock::now();
+        }
+
         bool operator==(const Holder& other) const {
             std::scoped_lock lock(_mutex);
             return _value == other;
@@ -81,6 +138,11 @@ class Interface {
         mutable std::recursive_mutex _mutex;
         Holder _value;
         bool _valid;
+
+        bool _cached = false;
+        bool _optional = false;
+        std::chrono::steady_clock::duration _max_age = std::chrono::steady_clock::duration::max();
+        std::chrono::steady_clock::time_point _updated;
     };
 
     template <typename T>
@@ -116,7 +178,17 @@ class Interface {
         Property& set(T value) {
             std::scoped_lock lock(_mutex);
             _value = Holder::create<T>(value);
-            _valid = true;
+            validate();
+            return *this;
+        }
+
+        Property& cache(std::chrono::steady_clock::duration max_age = std::chrono::steady_clock::duration::max()) {
+            PropertyBase::cache(max_age);
+            return *this;
+        }
+
+        Property& optional() {
+            PropertyBase::optional();
             return *this;
         }
 
@@ -139,9 +211,36 @@ class Interface {
 
     // ----- PROPERTIES -----
     bool property_exists(const std::string& property_name);
+    bool property_exported(const std::string& property_name);
     void property_refresh(const std::string& property_name);
     void property_emit(const std::string& property_name, Holder value);
 
+    /**
+     * Fetch every property of this interface with a single GetAll call. Only properties whose value
+     * differs from the cached one fire their change callback.
+     */
+    void refresh_all();
+
+    /**
+     * Split form of refresh_all(), so that several interfaces can have their GetAll in flight at once.
+     * Returns nullptr if the interface is not loaded.
+     */
+    std::shared_ptr<PendingCall> refresh_all_request();
+    void refresh_all_apply(PendingCall& call);
+
+    /**
+     * Whether a refresh_all() would fetch anything that refresh() on the individual properties would.
+     * Properties that were never received are only considered if they are not cached, as the remote
+     * object might simply not provide them.
+     */
+    bool refresh_needed();
+
+    /**
+     * Enable the signal-driven cache on every property of this interface, see PropertyBase::cache().
+     */
+    void property_cache_enable(std::chrono::steady_clock::duration max_age = std::chrono::steady_clock::duration::max());
+    void property_cache_disable();
+
     // ----- MESSAGES -----
     virtual void message_handle(Message& msg) {}
 
@@ -156,6 +255,8 @@ class Interface {
         std::unique_ptr<PropertyBase> property_ptr = std::make_unique<Property<T>>(*this, name);
         Property<T>& property = dynamic_cast<Property<T>&>(*property_ptr);
         property.set(T());
+        // The placeholder value has not been received from the bus yet.
+        property.invalidate();
         _properties.emplace(name, std::move(property_ptr));
         return property;
     }
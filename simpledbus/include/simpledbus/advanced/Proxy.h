@@ -6,9 +6,12 @@
 #include <simpledbus/base/Path.h>
 #include <kvn/kvn_safe_callback.hpp>
 
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace SimpleDBus {
 
@@ -51,8 +54,26 @@ class Proxy : public std::enable_shared_from_this<Proxy> {
     void interfaces_reload(Holder managed_interfaces);
     void interfaces_unload(Holder removed_interfaces);
 
+    /**
+     * Bring the cached properties of the given interfaces (all loaded ones if empty) up to date, with
+     * one GetAll per interface that needs it. All calls are sent before any reply is awaited.
+     */
+    void refresh_interfaces(const std::vector<std::string>& interface_names = {});
+
+    /**
+     * Same as refresh_interfaces(), for all direct children at once.
+     */
+    void refresh_children_interfaces(const std::vector<std::string>& interface_names = {});
+
     // ----- CHILD HANDLING -----
     void path_add(const std::string& path, Holder managed_interfaces);
+
+    /**
+     * Same as path_add(), except that proxies and interfaces are only created once the path is accessed,
+     * through path_get(), children() and the like, or when a message arrives for it. Until then the
+     * closest existing proxy keeps the undecoded interfaces.
+     */
+    void path_add_deferred(const std::string& path, RawValue managed_interfaces);
     bool path_remove(const std::string& path, Holder removed_interfaces);
     bool path_prune();
     Holder path_collect();
@@ -74,6 +95,7 @@ class Proxy : public std::enable_shared_from_this<Proxy> {
     std::vector<std::shared_ptr<T>> children_casted() {
         std::vector<std::shared_ptr<T>> result;
         std::scoped_lock lock(_child_access_mutex);
+        children_materialize();
         for (auto& [path, child] : _children) {
             result.push_back(std::dynamic_pointer_cast<T>(child));
         }
@@ -85,6 +107,7 @@ class Proxy : public std::enable_shared_from_this<Proxy> {
     std::vector<std::shared_ptr<T>> children_casted_with_prefix(const std::string& prefix) {
         std::vector<std::shared_ptr<T>> result;
         std::scoped_lock lock(_child_access_mutex);
+        children_materialize();
         for (auto& [path, child] : _children) {
             const std::string next_child = SimpleDBus::PathUtils::next_child_strip(_path, path);
             if (next_child.find(prefix) == 0) {
@@ -105,6 +128,12 @@ class Proxy : public std::enable_shared_from_this<Proxy> {
     // ----- INTERNAL CALLBACKS -----
     virtual void on_registration();
 
+    /**
+     * Called on every proxy a path is routed through on its way to being added or removed below it, once the
+     * change is made.
+     */
+    virtual void on_descendant_changed(const std::string& path);
+
   protected:
     bool _valid;
     std::string _path;
@@ -118,7 +147,26 @@ class Proxy : public std::enable_shared_from_this<Proxy> {
     std::recursive_mutex _interface_access_mutex;
     std::recursive_mutex _child_access_mutex;
 
+    /**
+     * Create the proxies of all direct children still pending from path_add_deferred(). Must be called
+     * before walking _children directly.
+     */
+    void children_materialize();
+
   private:
+    // Descendants from path_add_deferred() without a proxy yet. Segments only use characters sorting after
+    // '/', so the entries of a subtree are always contiguous.
+    std::map<std::string, RawValue> _deferred;
+
+    std::shared_ptr<Proxy> deferred_materialize(const std::string& child_path);
+
+    using RefreshRequest = std::pair<std::shared_ptr<Interface>, std::shared_ptr<PendingCall>>;
+    void refresh_interfaces_request(const std::vector<std::string>& interface_names,
+                                    std::vector<RefreshRequest>& requests);
+
+    // Answers a method call that no object or interface here is able to handle.
+    void message_reject(Message& msg, const std::string& error_name, const std::string& error_message);
+
     // ----- PATH HANDLING -----
     bool _registered;
     void register_object_path();
@@ -1,11 +1,19 @@
 #pragma once
 
 #include <dbus/dbus.h>
+#include <chrono>
 #include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
 #include <mutex>
+#include <string_view>
 #include <unordered_map>
-#include <functional>
+#include <vector>
+#include "DispatchPool.h"
 #include "Message.h"
+#include "PathIndex.h"
+#include "PendingCall.h"
 
 namespace SimpleDBus {
 
@@ -31,9 +39,68 @@ class Connection {
     Message send_with_reply(Message& msg);
     Message send_with_reply_and_block(Message& msg);
 
+    /**
+     * Queue a method call and return immediately, so that several calls can be in flight at once.
+     * The reply is delivered by the thread dispatching this connection, after which the callback runs.
+     * Calls that outlive their timeout are expired by the dispatch loop as well.
+     */
+    std::shared_ptr<PendingCall> send_async(Message& msg, PendingCall::Callback callback = nullptr);
+    std::shared_ptr<PendingCall> send_async(Message& msg, PendingCall::Callback callback,
+                                            std::chrono::steady_clock::duration timeout);
+
+    /**
+     * Route messages for the given path to the handler. Handlers run on the dispatching thread, or on the
+     * worker pool when Config::Connection::dispatch_workers is set, see static_message_handler().
+     */
     bool register_object_path(const std::string& path, std::function<void(Message&)> handler);
+
+    /**
+     * Same as register_object_path(), but the handler also receives the messages for every path below this one
+     * that has no handler of its own. Unregistered with unregister_object_path().
+     */
+    bool register_fallback(const std::string& path, std::function<void(Message&)> handler);
+
+    /**
+     * Once this returns the handler is no longer running and won't be called again, even for messages that
+     * were already queued for it.
+     */
     bool unregister_object_path(const std::string& path);
 
+    // ----- EVENT LOOP -----
+
+    /**
+     * Block until the bus socket has activity, a libdbus timeout expires, event_loop_wakeup() is called
+     * or max_wait elapses, then handle the I/O and dispatch every queued message.
+     *
+     * The first call installs watch and timeout functions on the underlying connection, so from then on
+     * only one thread should drive the connection through this method.
+     */
+    void event_loop_iterate(std::chrono::milliseconds max_wait);
+
+    /**
+     * Interrupt a thread blocked in event_loop_iterate(). Safe to call from any thread.
+     */
+    void event_loop_wakeup();
+
+    /**
+     * Watch a file descriptor from the event loop, calling the handler whenever it is readable or was hung up.
+     * The descriptor is level triggered, so the handler must drain it. Handlers run on the thread driving
+     * event_loop_iterate(), without holding the connection lock. Returns false if the descriptor is already watched.
+     */
+    bool event_loop_add_fd(int fd, std::function<void()> handler);
+
+    /**
+     * Also call the handler of a watched descriptor while it is writable, for handlers waiting for a full
+     * descriptor to drain. As a writable descriptor keeps waking the loop, this is turned off again once done.
+     */
+    void event_loop_watch_writable(int fd, bool writable);
+
+    /**
+     * Stop watching a descriptor. As with unregister_object_path(), the handler is not running anymore once this
+     * returns, so the descriptor can be closed right after. Safe to call from within the handler itself.
+     */
+    void event_loop_remove_fd(int fd);
+
     // ----- PROPERTIES -----
     std::string unique_name();
 
@@ -44,17 +111,57 @@ class Connection {
     ::DBusConnection* _conn;
 
     std::recursive_mutex _mutex;
-    std::unordered_map<std::string, std::function<void(Message&)>> _message_handlers;
 
-    static DBusHandlerResult static_message_handler(DBusConnection* connection, DBusMessage* message, void* user_data);
-    static void static_reply_handler(DBusPendingCall* pending, void* user_data);
+    struct MessageHandler {
+        std::recursive_mutex mutex;
+        std::function<void(Message&)> callback;
+        bool active = true;
+        bool fallback = false;
+    };
+
+    std::mutex _message_handlers_mutex;
+    PathIndex<std::shared_ptr<MessageHandler>> _message_handlers;
+    std::unique_ptr<DispatchPool> _dispatch_pool;
+
+    bool message_handler_register(const std::string& path, std::function<void(Message&)> handler, bool fallback);
+    std::shared_ptr<MessageHandler> message_handler_find(const std::string& path);
+    static void message_handler_invoke(MessageHandler& handler, Message& msg);
 
-    struct AsyncContext {
-        DBusMessage* reply = nullptr;
-        bool completed = false;
-        std::mutex mtx;
-        std::condition_variable cv;
+    int _epoll_fd = -1;
+    int _wakeup_fd = -1;
+    std::mutex _event_mutex;
+    std::unordered_map<int, std::vector<DBusWatch*>> _watches;
+    std::map<DBusTimeout*, std::chrono::steady_clock::time_point> _timeouts;
+
+    struct FdHandler {
+        std::recursive_mutex mutex;
+        std::function<void()> callback;
+        bool active = true;
     };
+
+    std::unordered_map<int, std::shared_ptr<FdHandler>> _fd_handlers;
+
+    void event_loop_setup();
+    void event_loop_teardown();
+    void event_loop_update_fd(int fd);
+
+    static dbus_bool_t static_add_watch(DBusWatch* watch, void* user_data);
+    static void static_remove_watch(DBusWatch* watch, void* user_data);
+    static void static_toggle_watch(DBusWatch* watch, void* user_data);
+    static dbus_bool_t static_add_timeout(DBusTimeout* timeout, void* user_data);
+    static void static_remove_timeout(DBusTimeout* timeout, void* user_data);
+    static void static_toggle_timeout(DBusTimeout* timeout, void* user_data);
+    static void static_wakeup_main(void* user_data);
+    static void static_dispatch_status(DBusConnection* connection, DBusDispatchStatus new_status, void* user_data);
+
+    std::mutex _pending_calls_mutex;
+    std::vector<std::shared_ptr<PendingCall>> _pending_calls;
+
+    void pending_calls_expire();
+    std::chrono::steady_clock::time_point pending_calls_next_deadline();
+
+    static DBusHandlerResult static_message_handler(DBusConnection* connection, DBusMessage* message, void* user_data);
+    static std::string_view dispatch_key(DBusMessage* message, const char* path);
 };
 
 }  // namespace SimpleDBus
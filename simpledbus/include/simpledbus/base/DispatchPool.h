@@ -0,0 +1,53 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace SimpleDBus {
+
+/**
+ * Fixed set of worker threads, each draining its own queue.
+ *
+ * Tasks posted with the same key always land on the same worker, so they run one at a time and in the
+ * order they were posted, while tasks with different keys can run concurrently.
+ */
+class DispatchPool {
+  public:
+    using Task = std::function<void()>;
+
+    explicit DispatchPool(size_t num_workers);
+    ~DispatchPool();
+
+    DispatchPool(const DispatchPool&) = delete;
+    DispatchPool& operator=(const DispatchPool&) = delete;
+
+    size_t size() const;
+    void post(std::string_view key, Task task);
+
+    /**
+     * Run whatever is still queued, then join the workers. Tasks posted afterwards are dropped.
+     */
+    void stop();
+
+  private:
+    struct Worker {
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::deque<Task> queue;
+        bool stopping = false;
+        std::thread thread;
+    };
+
+    // Shared with the worker thread, which may outlive the pool when it has to be detached.
+    std::vector<std::shared_ptr<Worker>> _workers;
+
+    static void run(std::shared_ptr<Worker> self);
+};
+
+}  // namespace SimpleDBus
@@ -28,8 +28,10 @@ class SendFailed : public BaseException {
   public:
     SendFailed(const std::string& err_name, const std::string& err_message, const std::string& msg_str);
     const char* what() const noexcept override;
+    const std::string& error_name() const;
 
   private:
+    std::string _error_name;
     std::string _message;
 };
 
@@ -51,6 +53,15 @@ class PathNotFoundException : public BaseException {
     std::string _message;
 };
 
+class SignatureMismatch : public BaseException {
+  public:
+    SignatureMismatch(const std::string& expected, const std::string& received);
+    const char* what() const noexcept override;
+
+  private:
+    std::string _message;
+};
+
 }  // namespace Exception
 
 }  // namespace SimpleDBus
@@ -3,12 +3,18 @@
 #include <any>
 #include <cstdint>
 #include <map>
+#include <memory>
 #include <optional>
 #include <string>
-#include <tuple>
 #include <type_traits>
+#include <utility>
+#include <variant>
 #include <vector>
 
+#include <unistd.h>
+
+#include "kvn/kvn_bytearray.h"
+
 namespace SimpleDBus {
 
 namespace detail {
@@ -33,6 +39,15 @@ struct is_vector<T, std::void_t<typename T::value_type, decltype(std::declval<T>
 
 template <typename T>
 inline constexpr bool is_vector_v = is_vector<T>::value && !std::is_same_v<T, std::string>;
+
+template <typename T, typename = void>
+struct is_byte_vector : std::false_type {};
+
+template <typename T>
+struct is_byte_vector<T, std::enable_if_t<is_vector_v<T>>> : std::is_same<typename T::value_type, uint8_t> {};
+
+template <typename T>
+inline constexpr bool is_byte_vector_v = is_byte_vector<T>::value;
 }  // namespace detail
 
 class ObjectPath {
@@ -65,6 +80,57 @@ class Signature {
     std::string signature;
 };
 
+/**
+ * Owned file descriptor, as passed through a D-Bus "h" argument. Only available through the typed
+ * Message::append() and Message::extract(), the descriptor is closed when the object goes away.
+ */
+class UnixFd {
+  public:
+    UnixFd() = default;
+    explicit UnixFd(int fd) : fd(fd) {}
+    UnixFd(const UnixFd&) = delete;
+    UnixFd& operator=(const UnixFd&) = delete;
+    UnixFd(UnixFd&& other) noexcept : fd(other.release()) {}
+    UnixFd& operator=(UnixFd&& other) noexcept {
+        if (this != &other) reset(other.release());
+        return *this;
+    }
+    ~UnixFd() { reset(); }
+
+    int get() const { return fd; }
+    bool is_valid() const { return fd >= 0; }
+
+    int release() { return std::exchange(fd, -1); }
+
+    void reset(int new_fd = -1) {
+        if (fd >= 0) close(fd);
+        fd = new_fd;
+    }
+
+  private:
+    int fd = -1;
+};
+
+/**
+ * Variant with a fixed content type, so that Message::append() can write it without building a Holder.
+ */
+template <typename T>
+struct Variant {
+    using value_type = T;
+    T value;
+};
+
+namespace detail {
+template <typename T>
+struct is_typed_variant : std::false_type {};
+
+template <typename T>
+struct is_typed_variant<Variant<T>> : std::true_type {};
+
+template <typename T>
+inline constexpr bool is_typed_variant_v = is_typed_variant<T>::value;
+}  // namespace detail
+
 class Holder;
 
 class Holder {
@@ -90,7 +156,8 @@ class Holder {
         OBJ_PATH,
         SIGNATURE,
         ARRAY,
-        DICT
+        DICT,
+        BYTE_ARRAY
     } Type;
 
     Type type() const;
@@ -101,17 +168,40 @@ class Holder {
     std::any get_contents() const;
 
     void dict_append(Type key_type, std::any key, Holder value);
+    void dict_append(Holder key, Holder value);
     void array_append(Holder holder);
 
+    /**
+     * Bytes of a BYTE_ARRAY holder, read in place rather than copied out as get<kvn::bytearray>() does.
+     * Null for holders of any other type. Valid until the holder is modified or destroyed.
+     */
+    const kvn::bytearray* byte_array() const;
+
+    template <typename K, typename = std::enable_if_t<!std::is_same_v<std::decay_t<K>, std::any> &&
+                                                      !std::is_same_v<std::decay_t<K>, Holder>>>
+    void dict_append(Type key_type, const K& key, Holder value) {
+        dict_append(_create_key(key_type, key), std::move(value));
+    }
+
+    /**
+     * Create a BYTE_ARRAY holder by copying size bytes from data into a single buffer.
+     */
+    static Holder create_byte_array(const uint8_t* data, size_t size);
+
     // Template implementations.
     template <typename T>
     static Holder create() {
         Holder h;
         using U = std::decay_t<T>;
-        if constexpr (detail::is_vector_v<U>) {
+        if constexpr (detail::is_byte_vector_v<U>) {
+            h._type = BYTE_ARRAY;
+            h._data = std::make_shared<kvn::bytearray>();
+        } else if constexpr (detail::is_vector_v<U>) {
             h._type = ARRAY;
+            h._data = Array();
         } else if constexpr (detail::is_map_v<U>) {
             h._type = DICT;
+            h._data = Dict();
         }
         return h;
     }
@@ -122,13 +212,13 @@ class Holder {
         using U = std::decay_t<T>;
         if constexpr (std::is_same_v<U, bool>) {
             h._type = BOOLEAN;
-            h.holder_boolean = value;
+            h._data = static_cast<bool>(value);
         } else if constexpr (std::is_integral_v<U>) {
             h._type = _type_to_enum<U>();
-            h.holder_integer = static_cast<uint64_t>(value);
+            h._data = static_cast<uint64_t>(value);
         } else if constexpr (std::is_floating_point_v<U>) {
             h._type = DOUBLE;
-            h.holder_double = static_cast<double>(value);
+            h._data = static_cast<double>(value);
         } else if constexpr (std::is_convertible_v<U, std::string> && !detail::is_vector_v<U>) {
             if constexpr (std::is_same_v<U, ObjectPath>) {
                 h._type = OBJ_PATH;
@@ -137,17 +227,26 @@ class Holder {
             } else {
                 h._type = STRING;
             }
-            h.holder_string = static_cast<std::string>(value);
+            h._data = static_cast<std::string>(value);
+        } else if constexpr (detail::is_byte_vector_v<U>) {
+            h._type = BYTE_ARRAY;
+            h._data = std::make_shared<kvn::bytearray>(value.begin(), value.end());
         } else if constexpr (detail::is_vector_v<U>) {
             h._type = ARRAY;
+            Array array;
+            array.reserve(value.size());
             for (const auto& item : value) {
-                h.array_append(Holder::create(item));
+                array.push_back(Holder::create(item));
             }
+            h._data = std::move(array);
         } else if constexpr (detail::is_map_v<U>) {
             h._type = DICT;
+            Dict dict;
+            dict.reserve(value.size());
             for (const auto& [key, val] : value) {
-                h.dict_append(_type_to_enum<typename U::key_type>(), key, Holder::create(val));
+                dict.emplace_back(_create_key(_type_to_enum<typename U::key_type>(), key), Holder::create(val));
             }
+            h._data = std::move(dict);
         }
         return h;
     }
@@ -156,24 +255,36 @@ class Holder {
     T get() const {
         using U = std::decay_t<T>;
         if constexpr (std::is_same_v<U, bool>) {
-            return holder_boolean;
+            return _get_boolean();
         } else if constexpr (std::is_integral_v<U>) {
-            return static_cast<U>(holder_integer);
+            return static_cast<U>(_get_integer());
         } else if constexpr (std::is_floating_point_v<U>) {
-            return static_cast<U>(holder_double);
+            return static_cast<U>(_get_double());
         } else if constexpr (std::is_same_v<U, std::string>) {
-            return holder_string;
+            return _get_string();
         } else if constexpr (std::is_same_v<U, ObjectPath>) {
-            return ObjectPath(holder_string);
+            return ObjectPath(_get_string());
         } else if constexpr (std::is_same_v<U, Signature>) {
-            return Signature(holder_string);
+            return Signature(_get_string());
+        } else if constexpr (detail::is_byte_vector_v<U>) {
+            if (auto bytes = std::get_if<ByteArrayPtr>(&_data)) {
+                return U((*bytes)->begin(), (*bytes)->end());
+            }
+            U result;
+            for (const auto& h : _get_array()) {
+                result.push_back(h.template get<uint8_t>());
+            }
+            return result;
         } else if constexpr (detail::is_vector_v<U>) {
             using V = typename U::value_type;
             if constexpr (std::is_same_v<V, Holder>) {
-                return holder_array;
+                if (_type == BYTE_ARRAY) {
+                    return _expand_byte_array();
+                }
+                return _get_array();
             } else {
                 U result;
-                for (const auto& h : holder_array) {
+                for (const auto& h : _get_array()) {
                     result.push_back(h.template get<V>());
                 }
                 return result;
@@ -181,60 +292,73 @@ class Holder {
         } else if constexpr (detail::is_map_v<U>) {
             using K = typename U::key_type;
             using V = typename U::mapped_type;
-            if constexpr (std::is_same_v<V, Holder>) {
-                return _get_dict<K>(_type_to_enum<K>());
-            } else {
-                std::map<K, V> result;
-                for (auto& [key_type_internal, key, value] : holder_dict) {
-                    if (key_type_internal == _type_to_enum<K>()) {
-                        if constexpr (std::is_same_v<std::decay_t<K>, ObjectPath> || std::is_same_v<std::decay_t<K>, Signature>) {
-                            result[K(std::any_cast<std::string>(key))] = value.template get<V>();
-                        } else {
-                            result[std::any_cast<K>(key)] = value.template get<V>();
-                        }
+            std::map<K, V> result;
+            for (const auto& [key, value] : _get_dict()) {
+                if (key._type == _type_to_enum<K>()) {
+                    if constexpr (std::is_same_v<V, Holder>) {
+                        result[key.template get<K>()] = value;
+                    } else {
+                        result[key.template get<K>()] = value.template get<V>();
                     }
                 }
-                return result;
             }
+            return result;
         } else {
             static_assert(detail::always_false_v<U>, "Unsupported type for Holder::get");
         }
     }
 
   private:
-    Type _type = NONE;
-    std::optional<std::string> _signature;
+    using Array = std::vector<Holder>;
+    // Dictionaries are stored as a flat list of <key, value> pairs, the type of the key holder being the key type.
+    using Dict = std::vector<std::pair<Holder, Holder>>;
+    // Byte arrays are kept in one contiguous buffer, shared between copies of the holder. A buffer is only written
+    // while a single holder owns it, so that copies never see it change, which is why it is always allocated
+    // non-const.
+    using ByteArrayPtr = std::shared_ptr<const kvn::bytearray>;
 
-    bool holder_boolean = false;
-    uint64_t holder_integer = 0;
-    double holder_double = 0;
-    std::string holder_string;
-    std::vector<Holder> holder_array;
+    Type _type = NONE;
+    std::variant<std::monostate, bool, uint64_t, double, std::string, Array, Dict, ByteArrayPtr> _data;
+    std::shared_ptr<const std::string> _signature;
 
-    // Dictionaries are stored within a vector as a tuple of <key_type, key, holder>
-    std::vector<std::tuple<Type, std::any, Holder>> holder_dict;
+    bool _get_boolean() const;
+    uint64_t _get_integer() const;
+    double _get_double() const;
+    const std::string& _get_string() const;
+    const Array& _get_array() const;
+    const Dict& _get_dict() const;
 
     std::vector<std::string> _represent_container() const;
     std::string _represent_simple() const;
     std::string _signature_simple() const;
+    std::vector<Holder> _expand_byte_array() const;
+    kvn::bytearray& _mutable_byte_array();
+    static std::vector<std::string> _represent_bytes(const kvn::bytearray& bytes);
 
-    template <typename T>
-    std::map<T, Holder> _get_dict(Type key_type) const {
-        std::map<T, Holder> output;
-        for (auto& [key_type_internal, key, value] : holder_dict) {
-            if (key_type_internal == key_type) {
-                if constexpr (std::is_same_v<std::decay_t<T>, ObjectPath> || std::is_same_v<std::decay_t<T>, Signature>) {
-                    output[T(std::any_cast<std::string>(key))] = value;
-                } else {
-                    output[std::any_cast<T>(key)] = value;
-                }
-            }
+    template <typename K>
+    static Holder _create_key(Type key_type, const K& key) {
+        Holder h;
+        using U = std::decay_t<K>;
+        if constexpr (std::is_convertible_v<U, std::string>) {
+            // String keys handed in with a non-string key type are still stored as strings.
+            h._type = (key_type == OBJ_PATH || key_type == SIGNATURE) ? key_type : STRING;
+            h._data = static_cast<std::string>(key);
+        } else if constexpr (std::is_same_v<U, bool>) {
+            h._type = BOOLEAN;
+            h._data = key;
+        } else if constexpr (std::is_integral_v<U>) {
+            h._type = key_type;
+            h._data = static_cast<uint64_t>(key);
+        } else if constexpr (std::is_floating_point_v<U>) {
+            h._type = DOUBLE;
+            h._data = static_cast<double>(key);
+        } else {
+            static_assert(detail::always_false_v<U>, "Unsupported type for a dictionary key");
         }
-        return output;
+        return h;
     }
 
     static std::string _signature_type(Type type) noexcept;
-    static std::string _represent_type(Type type, std::any value) noexcept;
 
     template <typename T>
     static constexpr Type _type_to_enum() {
@@ -251,8 +375,6 @@ class Holder {
         if constexpr (std::is_same_v<U, Signature>) return SIGNATURE;
         return NONE;
     }
-
-    static bool _compare_any(Type type, const std::any& a, const std::any& b);
 };
 
 }  // namespace SimpleDBus
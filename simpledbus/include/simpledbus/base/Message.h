@@ -3,11 +3,40 @@
 #include <dbus/dbus.h>
 #include <atomic>
 #include <string>
+#include <tuple>
+#include <type_traits>
 #include <vector>
+#include "Exceptions.h"
 #include "Holder.h"
+#include "TypeSignature.h"
 
 namespace SimpleDBus {
 
+/**
+ * Value of a received message left undecoded, to be turned into a Holder later on.
+ *
+ * Extracting `std::map<ObjectPath, RawValue>` splits a reply per object without decoding the objects themselves.
+ * Every RawValue holds a reference to the message, not a copy, so they all share the buffer of the reply.
+ */
+class RawValue {
+  public:
+    RawValue() = default;
+    RawValue(const RawValue& other);
+    RawValue(RawValue&& other) noexcept;
+    RawValue& operator=(RawValue other) noexcept;
+    ~RawValue();
+
+    bool is_valid() const;
+    Holder decode() const;
+
+  private:
+    friend class Message;
+    RawValue(DBusMessage* msg, const DBusMessageIter& iter);
+
+    DBusMessage* _msg = nullptr;
+    DBusMessageIter _iter;
+};
+
 class Message {
   public:
     enum class Type {
@@ -37,6 +66,24 @@ class Message {
     void extract_next();
     std::string to_string(bool append_arguments = false) const;
 
+    /**
+     * Append arguments with a signature derived from their C++ types, e.g. a `std::vector<uint8_t>` followed by
+     * a `std::map<std::string, Holder>` is appended as "ay" and "a{sv}". Values are written straight into the
+     * message, a Holder is only involved for variants. Typed arguments are not listed by to_string().
+     */
+    template <typename... Args>
+    void append(const Args&... args);
+
+    /**
+     * Decode the arguments as the given types, returning a single value or a std::tuple for several types.
+     * Variants are unwrapped when a concrete type is requested. Throws Exception::SignatureMismatch if the
+     * message does not match.
+     *
+     * Decoding always starts at the first argument and leaves the extract() cursor untouched.
+     */
+    template <typename T, typename... Rest>
+    auto extract();
+
     uint32_t get_ref_count() const;
     int32_t get_unique_id() const;
     uint32_t get_serial() const;
@@ -57,7 +104,15 @@ class Message {
     static Message create_error(const Message& msg, const std::string& error_name, const std::string& error_message);
     static Message create_signal(const std::string& path, const std::string& interface, const std::string& signal);
 
+    /**
+     * Deep copy of the message, which can be modified and sent independently. Copying a prepared message
+     * without arguments skips building and validating its header again, e.g. for a signal emitted repeatedly.
+     */
+    Message copy() const;
+
   private:
+    friend class RawValue;
+
     static std::atomic_int32_t _creation_counter;
 
     int _indent = 0;
@@ -82,8 +137,172 @@ class Message {
      */
     void _append_argument(DBusMessageIter* iter, const Holder& argument, const std::string& signature);
 
+    template <typename T>
+    void _append_typed(DBusMessageIter* iter, const T& value);
+
+    template <typename T>
+    T _extract_typed(DBusMessageIter* iter);
+
+    template <typename T>
+    T _extract_typed_next(DBusMessageIter* iter);
+
+    static void _expect_type(DBusMessageIter* iter, const char* signature);
+
     void _invalidate();
     void _safe_delete();
 };
 
-}  // namespace SimpleDBus
\ No newline at end of file
+template <typename... Args>
+void Message::append(const Args&... args) {
+    dbus_message_iter_init_append(_msg, &_iter);
+    (_append_typed(&_iter, args), ...);
+}
+
+template <typename T, typename... Rest>
+auto Message::extract() {
+    if (!is_valid()) {
+        throw Exception::SignatureMismatch(signature_v<T, Rest...>, "");
+    }
+
+    DBusMessageIter iter;
+    dbus_message_iter_init(_msg, &iter);
+    if constexpr (sizeof...(Rest) == 0) {
+        return _extract_typed<T>(&iter);
+    } else {
+        // Braced initializers are evaluated in order, so each element consumes the next argument.
+        return std::tuple<T, Rest...>{_extract_typed_next<T>(&iter), _extract_typed_next<Rest>(&iter)...};
+    }
+}
+
+template <typename T>
+void Message::_append_typed(DBusMessageIter* iter, const T& value) {
+    constexpr const char* signature = signature_v<T>;
+
+    if constexpr (std::is_same_v<T, bool>) {
+        dbus_bool_t contents = value;
+        dbus_message_iter_append_basic(iter, DBUS_TYPE_BOOLEAN, &contents);
+    } else if constexpr (std::is_arithmetic_v<T>) {
+        dbus_message_iter_append_basic(iter, signature[0], &value);
+    } else if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, ObjectPath> ||
+                         std::is_same_v<T, Signature>) {
+        const char* contents = value.c_str();
+        dbus_message_iter_append_basic(iter, signature[0], &contents);
+    } else if constexpr (std::is_same_v<T, UnixFd>) {
+        // libdbus duplicates the descriptor, the caller keeps ownership of its own.
+        int contents = value.get();
+        dbus_message_iter_append_basic(iter, DBUS_TYPE_UNIX_FD, &contents);
+    } else if constexpr (std::is_same_v<T, Holder>) {
+        _append_argument(iter, value, "v");
+    } else if constexpr (detail::is_typed_variant_v<T>) {
+        DBusMessageIter sub_iter;
+        dbus_message_iter_open_container(iter, DBUS_TYPE_VARIANT, signature_v<typename T::value_type>, &sub_iter);
+        _append_typed(&sub_iter, value.value);
+        dbus_message_iter_close_container(iter, &sub_iter);
+    } else if constexpr (detail::is_map_v<T>) {
+        DBusMessageIter sub_iter;
+        dbus_message_iter_open_container(iter, DBUS_TYPE_ARRAY, signature + 1, &sub_iter);
+        for (const auto& [key, item] : value) {
+            DBusMessageIter entry_iter;
+            dbus_message_iter_open_container(&sub_iter, DBUS_TYPE_DICT_ENTRY, nullptr, &entry_iter);
+            _append_typed(&entry_iter, key);
+            _append_typed(&entry_iter, item);
+            dbus_message_iter_close_container(&sub_iter, &entry_iter);
+        }
+        dbus_message_iter_close_container(iter, &sub_iter);
+    } else if constexpr (detail::is_byte_vector_v<T>) {
+        DBusMessageIter sub_iter;
+        dbus_message_iter_open_container(iter, DBUS_TYPE_ARRAY, signature + 1, &sub_iter);
+        const uint8_t* bytes = value.data();
+        if (value.size() > 0) {
+            dbus_message_iter_append_fixed_array(&sub_iter, DBUS_TYPE_BYTE, &bytes, static_cast<int>(value.size()));
+        }
+        dbus_message_iter_close_container(iter, &sub_iter);
+    } else {
+        DBusMessageIter sub_iter;
+        dbus_message_iter_open_container(iter, DBUS_TYPE_ARRAY, signature + 1, &sub_iter);
+        for (const auto& item : value) {
+            _append_typed<typename T::value_type>(&sub_iter, item);
+        }
+        dbus_message_iter_close_container(iter, &sub_iter);
+    }
+}
+
+template <typename T>
+T Message::_extract_typed(DBusMessageIter* iter) {
+    constexpr const char* signature = signature_v<T>;
+
+    if constexpr (std::is_same_v<T, Holder>) {
+        return _extract_generic(iter);
+    } else if constexpr (std::is_same_v<T, RawValue>) {
+        return RawValue(_msg, *iter);
+    } else if constexpr (detail::is_typed_variant_v<T>) {
+        // Variants are unwrapped below, which also accepts the bare value.
+        return T{_extract_typed<typename T::value_type>(iter)};
+    } else {
+        if (dbus_message_iter_get_arg_type(iter) == DBUS_TYPE_VARIANT) {
+            DBusMessageIter sub_iter;
+            dbus_message_iter_recurse(iter, &sub_iter);
+            return _extract_typed<T>(&sub_iter);
+        }
+
+        _expect_type(iter, signature);
+
+        if constexpr (std::is_same_v<T, bool>) {
+            dbus_bool_t contents;
+            dbus_message_iter_get_basic(iter, &contents);
+            return contents != 0;
+        } else if constexpr (std::is_arithmetic_v<T>) {
+            T contents;
+            dbus_message_iter_get_basic(iter, &contents);
+            return contents;
+        } else if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, ObjectPath> ||
+                             std::is_same_v<T, Signature>) {
+            const char* contents;
+            dbus_message_iter_get_basic(iter, &contents);
+            return T(contents);
+        } else if constexpr (std::is_same_v<T, UnixFd>) {
+            // Every extraction hands out a new duplicate of the descriptor.
+            int contents = -1;
+            dbus_message_iter_get_basic(iter, &contents);
+            return UnixFd(contents);
+        } else if constexpr (detail::is_map_v<T>) {
+            T result;
+            DBusMessageIter sub_iter;
+            dbus_message_iter_recurse(iter, &sub_iter);
+            while (dbus_message_iter_get_arg_type(&sub_iter) == DBUS_TYPE_DICT_ENTRY) {
+                DBusMessageIter entry_iter;
+                dbus_message_iter_recurse(&sub_iter, &entry_iter);
+                auto key = _extract_typed_next<typename T::key_type>(&entry_iter);
+                result.emplace(std::move(key), _extract_typed<typename T::mapped_type>(&entry_iter));
+                dbus_message_iter_next(&sub_iter);
+            }
+            return result;
+        } else if constexpr (detail::is_byte_vector_v<T>) {
+            DBusMessageIter sub_iter;
+            dbus_message_iter_recurse(iter, &sub_iter);
+            const uint8_t* bytes = nullptr;
+            int len = 0;
+            if (dbus_message_iter_get_arg_type(&sub_iter) == DBUS_TYPE_BYTE) {
+                dbus_message_iter_get_fixed_array(&sub_iter, &bytes, &len);
+            }
+            return T(bytes, bytes + len);
+        } else {
+            T result;
+            DBusMessageIter sub_iter;
+            dbus_message_iter_recurse(iter, &sub_iter);
+            while (dbus_message_iter_get_arg_type(&sub_iter) != DBUS_TYPE_INVALID) {
+                result.push_back(_extract_typed_next<typename T::value_type>(&sub_iter));
+            }
+            return result;
+        }
+    }
+}
+
+template <typename T>
+T Message::_extract_typed_next(DBusMessageIter* iter) {
+    T value = _extract_typed<T>(iter);
+    dbus_message_iter_next(iter);
+    return value;
+}
+
+}  // namespace SimpleDBus
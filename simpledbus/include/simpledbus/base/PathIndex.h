@@ -0,0 +1,136 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace SimpleDBus {
+
+/**
+ * Object path trie keyed by path segment.
+ *
+ * Lookups walk one hash probe per segment and never allocate, so the cost depends on the depth
+ * of the path rather than on the number of objects stored. Paths are expected to be valid
+ * object paths; "/" maps to the root node.
+ */
+template <typename T>
+class PathIndex {
+  public:
+    PathIndex() : _root(std::make_unique<Node>()) {}
+
+    PathIndex(const PathIndex&) = delete;
+    PathIndex& operator=(const PathIndex&) = delete;
+    PathIndex(PathIndex&&) = default;
+    PathIndex& operator=(PathIndex&&) = default;
+
+    /**
+     * Store a value for the given path. Returns false, leaving the existing value untouched, if the
+     * path was already present.
+     */
+    bool insert(std::string_view path, T value) {
+        Node* node = _root.get();
+        for_each_segment(path, [&node](std::string_view segment) {
+            auto it = node->children.find(segment);
+            if (it == node->children.end()) {
+                auto child = std::make_unique<Node>();
+                child->parent = node;
+                child->segment = std::string(segment);
+                // The key views the segment owned by the child, which never moves once allocated.
+                std::string_view key = child->segment;
+                it = node->children.emplace(key, std::move(child)).first;
+            }
+            node = it->second.get();
+            return true;
+        });
+
+        if (node->value) return false;
+        node->value.emplace(std::move(value));
+        _size++;
+        return true;
+    }
+
+    T* find(std::string_view path) {
+        Node* node = locate(path);
+        return node && node->value ? &*node->value : nullptr;
+    }
+
+    const T* find(std::string_view path) const { return const_cast<PathIndex*>(this)->find(path); }
+
+    bool contains(std::string_view path) const { return find(path) != nullptr; }
+
+    /**
+     * Remove the value stored for the given path, pruning any branch left empty.
+     */
+    bool erase(std::string_view path) {
+        Node* node = locate(path);
+        if (!node || !node->value) return false;
+
+        node->value.reset();
+        _size--;
+        prune(node);
+        return true;
+    }
+
+    size_t size() const { return _size; }
+    bool empty() const { return _size == 0; }
+
+    void clear() {
+        _root = std::make_unique<Node>();
+        _size = 0;
+    }
+
+    /**
+     * Invoke the callback with every non-empty segment of the path, stopping early if it returns false.
+     */
+    template <typename F>
+    static bool for_each_segment(std::string_view path, F&& callback) {
+        size_t pos = 0;
+        while (pos < path.size()) {
+            if (path[pos] == '/') {
+                pos++;
+                continue;
+            }
+            size_t end = path.find('/', pos);
+            if (end == std::string_view::npos) end = path.size();
+            if (!callback(path.substr(pos, end - pos))) return false;
+            pos = end;
+        }
+        return true;
+    }
+
+  private:
+    struct Node {
+        Node* parent = nullptr;
+        std::string segment;
+        std::optional<T> value;
+        std::unordered_map<std::string_view, std::unique_ptr<Node>> children;
+    };
+
+    std::unique_ptr<Node> _root;
+    size_t _size = 0;
+
+    Node* locate(std::string_view path) {
+        Node* node = _root.get();
+        bool found = for_each_segment(path, [&node](std::string_view segment) {
+            auto it = node->children.find(segment);
+            if (it == node->children.end()) return false;
+            node = it->second.get();
+            return true;
+        });
+        return found ? node : nullptr;
+    }
+
+    void prune(Node* node) {
+        while (node != _root.get() && !node->value && node->children.empty()) {
+            Node* parent = node->parent;
+            parent->children.erase(parent->children.find(node->segment));
+            node = parent;
+        }
+    }
+};
+
+}  // namespace SimpleDBus
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <dbus/dbus.h>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include "Message.h"
+
+namespace SimpleDBus {
+
+class Connection;
+
+/**
+ * A method call issued through Connection::send_async().
+ *
+ * The reply is delivered from whichever thread dispatches the connection. Completion, timeout and
+ * cancellation are mutually exclusive: whichever happens first wins and the callback runs exactly once.
+ */
+class PendingCall : public std::enable_shared_from_this<PendingCall> {
+  public:
+    using Callback = std::function<void(PendingCall& call)>;
+
+    PendingCall(const Message& msg, Callback callback, std::chrono::steady_clock::duration timeout);
+    ~PendingCall();
+
+    // Delete copy and move operations
+    PendingCall(const PendingCall&) = delete;
+    PendingCall& operator=(const PendingCall&) = delete;
+    PendingCall(PendingCall&&) = delete;
+    PendingCall& operator=(PendingCall&&) = delete;
+
+    bool is_pending();
+    std::chrono::steady_clock::time_point deadline() const;
+
+    /**
+     * Block until the call is resolved and its callback has run, or until the given time elapses.
+     * Returns false if the call is still pending.
+     */
+    bool wait_for(std::chrono::steady_clock::duration timeout);
+
+    /**
+     * Block until the call is resolved and return the reply. An error reply is thrown as
+     * Exception::SendFailed, a timeout or cancellation as std::runtime_error.
+     *
+     * The reply is moved out, so this should only be called once.
+     */
+    Message get();
+
+    /**
+     * Abandon the call. Any reply that arrives afterwards is dropped.
+     */
+    void cancel();
+
+  private:
+    friend class Connection;
+
+    enum class State { PENDING, COMPLETED, TIMED_OUT, CANCELLED };
+
+    State _state = State::PENDING;
+    bool _finished = false;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+
+    DBusPendingCall* _pending = nullptr;
+    std::chrono::steady_clock::time_point _deadline;
+    std::string _description;
+    Callback _callback;
+    Message _reply;
+
+    void attach(DBusPendingCall* pending);
+    void complete();
+    void resolve(State state);
+    void finish();
+
+    static void static_notify(DBusPendingCall* pending, void* user_data);
+    static void static_free(void* user_data);
+};
+
+}  // namespace SimpleDBus
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <type_traits>
+
+#include "Holder.h"
+
+namespace SimpleDBus {
+
+class RawValue;
+
+namespace detail {
+
+template <char... C>
+struct signature_chars {
+    static constexpr char value[] = {C..., '\0'};
+};
+
+template <typename... S>
+struct signature_concat;
+
+template <>
+struct signature_concat<> {
+    using type = signature_chars<>;
+};
+
+template <char... A>
+struct signature_concat<signature_chars<A...>> {
+    using type = signature_chars<A...>;
+};
+
+template <char... A, char... B, typename... Rest>
+struct signature_concat<signature_chars<A...>, signature_chars<B...>, Rest...> {
+    using type = typename signature_concat<signature_chars<A..., B...>, Rest...>::type;
+};
+
+// Types without a specialization have no D-Bus representation and fail to compile.
+template <typename T, typename = void>
+struct type_signature;
+
+// clang-format off
+template <> struct type_signature<bool> { using type = signature_chars<'b'>; };
+template <> struct type_signature<uint8_t> { using type = signature_chars<'y'>; };
+template <> struct type_signature<int16_t> { using type = signature_chars<'n'>; };
+template <> struct type_signature<uint16_t> { using type = signature_chars<'q'>; };
+template <> struct type_signature<int32_t> { using type = signature_chars<'i'>; };
+template <> struct type_signature<uint32_t> { using type = signature_chars<'u'>; };
+template <> struct type_signature<int64_t> { using type = signature_chars<'x'>; };
+template <> struct type_signature<uint64_t> { using type = signature_chars<'t'>; };
+template <> struct type_signature<double> { using type = signature_chars<'d'>; };
+template <> struct type_signature<std::string> { using type = signature_chars<'s'>; };
+template <> struct type_signature<ObjectPath> { using type = signature_chars<'o'>; };
+template <> struct type_signature<Signature> { using type = signature_chars<'g'>; };
+template <> struct type_signature<UnixFd> { using type = signature_chars<'h'>; };
+template <> struct type_signature<Holder> { using type = signature_chars<'v'>; };
+// Stands for any single complete type, which is only ever decoded.
+template <> struct type_signature<RawValue> { using type = signature_chars<'v'>; };
+// clang-format on
+
+template <typename T>
+struct type_signature<Variant<T>> {
+    using type = signature_chars<'v'>;
+};
+
+template <typename T>
+struct type_signature<T, std::enable_if_t<is_vector_v<T> && !is_map_v<T>>> {
+    using type = typename signature_concat<signature_chars<'a'>, typename type_signature<typename T::value_type>::type>::type;
+};
+
+template <typename K, typename V>
+struct type_signature<std::map<K, V>> {
+    using type = typename signature_concat<signature_chars<'a', '{'>, typename type_signature<K>::type,
+                                           typename type_signature<V>::type, signature_chars<'}'>>::type;
+};
+
+}  // namespace detail
+
+/**
+ * D-Bus signature of the given C++ types, computed at compile time.
+ *
+ * `signature_v<std::vector<uint8_t>, std::map<std::string, Holder>>` is "aya{sv}". Holder stands for a variant.
+ */
+template <typename... T>
+inline constexpr const char* signature_v =
+    detail::signature_concat<typename detail::type_signature<T>::type...>::type::value;
+
+}  // namespace SimpleDBus
@@ -5,6 +5,8 @@
 
 #include <kvn/kvn_safe_callback.hpp>
 
+#include <map>
+
 namespace SimpleDBus::Interfaces {
 
 class ObjectManager : public Interface {
@@ -14,6 +16,11 @@ class ObjectManager : public Interface {
 
     Holder GetManagedObjects();
 
+    /**
+     * Same as GetManagedObjects(), leaving the interfaces of every object undecoded, see Proxy::path_add_deferred().
+     */
+    std::map<ObjectPath, RawValue> GetManagedObjectsDeferred();
+
     // ----- SIGNALS -----
     kvn::safe_callback<void(std::string path, Holder options)> InterfacesAdded;
     kvn::safe_callback<void(std::string path, Holder options)> InterfacesRemoved;
@@ -5,6 +5,7 @@ namespace Config {
 
 namespace Connection {
 std::chrono::steady_clock::duration send_with_reply_timeout = std::chrono::seconds(30);
+size_t dispatch_workers = 0;
 }  // namespace Connection
 
 }  // namespace Config
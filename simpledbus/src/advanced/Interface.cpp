@@ -1,6 +1,7 @@
 #include <simpledbus/advanced/Interface.h>
 #include <simpledbus/advanced/Proxy.h>
 #include <simpledbus/base/Exceptions.h>
+#include <simpledbus/base/Logging.h>
 #include <simpledbus/interfaces/Properties.h>
 
 using namespace SimpleDBus;
@@ -59,12 +60,59 @@ void Interface::property_refresh(const std::string& property_name) {
 
         if (*_properties[property_name] != property_latest) {
             _properties[property_name]->set(property_latest);
+        } else {
+            _properties[property_name]->validate();
         }
     } catch (const Exception::SendFailed& e) {
         // TODO: Log error
     }
 }
 
+void Interface::refresh_all() {
+    auto call = refresh_all_request();
+    if (call) refresh_all_apply(*call);
+}
+
+std::shared_ptr<PendingCall> Interface::refresh_all_request() {
+    if (!_loaded) return nullptr;
+
+    Message query_msg = Message::create_method_call(_bus_name, _path, "org.freedesktop.DBus.Properties", "GetAll");
+    query_msg.append(_interface_name);
+    return _conn->send_async(query_msg);
+}
+
+void Interface::refresh_all_apply(PendingCall& call) {
+    try {
+        // NOTE: Same as property_refresh, the object might be gone by the time the reply arrives.
+        Message reply_msg = call.get();
+        auto properties_latest = reply_msg.extract<std::map<std::string, Holder>>();
+
+        for (auto& [name, value] : properties_latest) {
+            auto it = _properties.find(name);
+            if (it == _properties.end()) continue;
+
+            if (*it->second != value) {
+                it->second->set(value);
+            } else {
+                it->second->validate();
+            }
+        }
+    } catch (const Exception::SendFailed& e) {
+        LOG_WARN("GetAll of {} on {} failed: {}", _interface_name, _path, e.error_name());
+    } catch (const std::runtime_error& e) {
+        // Timed out or cancelled, the cached values are left untouched.
+    }
+}
+
+bool Interface::refresh_needed() {
+    if (!_loaded) return false;
+
+    for (auto& [name, property] : _properties) {
+        if (property->valid() ? property->stale() : !property->cached()) return true;
+    }
+    return false;
+}
+
 void Interface::property_emit(const std::string& property_name, Holder value) {
     if (!_loaded || _properties.count(property_name) == 0) {
         return;
@@ -78,8 +126,25 @@ void Interface::property_emit(const std::string& property_name, Holder value) {
     properties->PropertiesChanged(_interface_name, changed_properties, {});
 }
 
+void Interface::property_cache_enable(std::chrono::steady_clock::duration max_age) {
+    for (auto& [name, property] : _properties) {
+        property->cache(max_age);
+    }
+}
+
+void Interface::property_cache_disable() {
+    for (auto& [name, property] : _properties) {
+        property->uncache();
+    }
+}
+
 bool Interface::property_exists(const std::string& property_name) { return _properties.count(property_name) > 0; }
 
+bool Interface::property_exported(const std::string& property_name) {
+    auto it = _properties.find(property_name);
+    return it != _properties.end() && it->second->exported();
+}
+
 // ----- HANDLES -----
 
 void Interface::handle_properties_changed(Holder changed_properties, Holder invalidated_properties) {
@@ -113,6 +178,7 @@ Holder Interface::handle_property_get(std::string property_name) {
 Holder Interface::handle_property_get_all() {
     Holder properties = Holder::create<std::map<std::string, Holder>>();
     for (auto& [name, value] : _properties) {
+        if (!value->exported()) continue;
         properties.dict_append(Holder::STRING, name, value->get());
     }
     return properties;
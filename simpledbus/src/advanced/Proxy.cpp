@@ -11,6 +11,21 @@
 
 using namespace SimpleDBus;
 
+namespace {
+
+// Reports a change below a proxy once it has been made and the child mutex released, however the function returns.
+class DescendantChange {
+  public:
+    DescendantChange(Proxy& proxy, const std::string& path) : _proxy(proxy), _path(path) {}
+    ~DescendantChange() { _proxy.on_descendant_changed(_path); }
+
+  private:
+    Proxy& _proxy;
+    const std::string& _path;
+};
+
+}  // namespace
+
 Proxy::Proxy(std::shared_ptr<Connection> conn, const std::string& bus_name, const std::string& path)
     : _conn(conn), _bus_name(bus_name), _path(path), _valid(true), _registered(false) {}
 
@@ -22,6 +37,8 @@ Proxy::~Proxy() {
 
 void Proxy::on_registration() {}
 
+void Proxy::on_descendant_changed(const std::string& path) {}
+
 std::shared_ptr<Proxy> Proxy::path_create(const std::string& path) {
     return std::make_shared<Proxy>(_conn, _bus_name, path);
 }
@@ -37,15 +54,18 @@ std::string Proxy::path() const { return _path; }
 
 std::string Proxy::bus_name() const { return _bus_name; }
 
-const std::map<std::string, std::shared_ptr<Proxy>>& Proxy::children() { return _children; }
+const std::map<std::string, std::shared_ptr<Proxy>>& Proxy::children() {
+    children_materialize();
+    return _children;
+}
 
 const std::map<std::string, std::shared_ptr<Interface>>& Proxy::interfaces() { return _interfaces; }
 
 // ----- PATH HANDLING -----
 
 void Proxy::register_object_path() {
-    if (!_registered && _conn &&
-        _conn->register_object_path(_path, [this](Message& msg) { this->message_handle(msg); })) {
+    // As a fallback, messages for deferred descendants reach the closest proxy that exists, see message_handle().
+    if (!_registered && _conn && _conn->register_fallback(_path, [this](Message& msg) { this->message_handle(msg); })) {
         _registered = true;
     }
 }
@@ -138,11 +158,53 @@ bool Proxy::interfaces_loaded() {
     return false;
 }
 
+void Proxy::refresh_interfaces(const std::vector<std::string>& interface_names) {
+    std::vector<RefreshRequest> requests;
+    refresh_interfaces_request(interface_names, requests);
+
+    for (auto& [interface, call] : requests) {
+        interface->refresh_all_apply(*call);
+    }
+}
+
+void Proxy::refresh_children_interfaces(const std::vector<std::string>& interface_names) {
+    std::vector<RefreshRequest> requests;
+    {
+        std::scoped_lock lock(_child_access_mutex);
+        children_materialize();
+        for (auto& [path, child] : _children) {
+            child->refresh_interfaces_request(interface_names, requests);
+        }
+    }
+
+    // Replies are awaited without holding any lock, as they are delivered by the dispatching thread.
+    for (auto& [interface, call] : requests) {
+        interface->refresh_all_apply(*call);
+    }
+}
+
+void Proxy::refresh_interfaces_request(const std::vector<std::string>& interface_names,
+                                       std::vector<RefreshRequest>& requests) {
+    if (!_valid || !_conn) return;
+
+    std::scoped_lock lock(_interface_access_mutex);
+    for (auto& [iface_name, interface] : _interfaces) {
+        if (!interface_names.empty() &&
+            std::find(interface_names.begin(), interface_names.end(), iface_name) == interface_names.end()) {
+            continue;
+        }
+        if (!interface->refresh_needed()) continue;
+
+        auto call = interface->refresh_all_request();
+        if (call) requests.emplace_back(interface, call);
+    }
+}
+
 // ----- CHILD HANDLING -----
 
 bool Proxy::path_exists(const std::string& path) {
     std::scoped_lock lock(_child_access_mutex);
-    return _children.find(path) != _children.end();
+    return _children.find(path) != _children.end() || deferred_materialize(path) != nullptr;
 }
 
 std::shared_ptr<Proxy> Proxy::path_get(const std::string& path) {
@@ -159,42 +221,58 @@ void Proxy::path_add(const std::string& path, SimpleDBus::Holder managed_interfa
         // TODO: Should an exception be thrown here?
         return;
     }
-
-    // If the path is already in the map, perform a reload of all interfaces.
-    if (path_exists(path)) {
-        path_get(path)->interfaces_load(managed_interfaces);
-        return;
-    }
+    DescendantChange change(*this, path);
 
     // As children will be extensively accessed, we need to lock the child access mutex.
     std::scoped_lock lock(_child_access_mutex);
 
-    if (PathUtils::is_child(_path, path)) {
-        // If the path is a direct child of the proxy path, create a new proxy for it.
-        std::shared_ptr<Proxy> child = path_create(path);
-        child->interfaces_load(managed_interfaces);
-        _children.emplace(std::make_pair(path, child));
-        on_child_created(path);
-    } else {
-        // If the new path is for a descendant of the current proxy, check if there is a child proxy for it.
-        auto child_result = std::find_if(
-            _children.begin(), _children.end(),
-            [path](const std::pair<std::string, std::shared_ptr<Proxy>>& child_data) -> bool {
-                return PathUtils::is_descendant(child_data.first, path);
-            });
-
-        if (child_result != _children.end()) {
+    // Only the child owning the next path segment needs to be looked at, so adding a path costs one lookup
+    // per level regardless of how many siblings there are.
+    std::string child_path = PathUtils::next_child(_path, path);
+    deferred_materialize(child_path);
+    auto child_result = _children.find(child_path);
+
+    if (child_result != _children.end()) {
+        if (child_path == path) {
+            // If the path is already in the map, perform a reload of all interfaces.
+            child_result->second->interfaces_load(managed_interfaces);
+        } else {
             // If there is a child proxy for the new path, forward it to that child proxy.
             child_result->second->path_add(path, managed_interfaces);
-        } else {
-            // If there is no child proxy for the new path, create the child and forward the path to it.
-            // This path will be taken if an empty proxy object needs to be created for an intermediate path.
-            std::string child_path = PathUtils::next_child(_path, path);
-            std::shared_ptr<Proxy> child = path_create(child_path);
-            _children.emplace(std::make_pair(child_path, child));
-            child->path_add(path, managed_interfaces);
-            on_child_created(child_path);
         }
+        return;
+    }
+
+    std::shared_ptr<Proxy> child = path_create(child_path);
+    if (child_path == path) {
+        // If the path is a direct child of the proxy path, create a new proxy for it.
+        child->interfaces_load(managed_interfaces);
+        _children.emplace(std::make_pair(child_path, child));
+    } else {
+        // If there is no child proxy for the new path, create the child and forward the path to it.
+        // This path will be taken if an empty proxy object needs to be created for an intermediate path.
+        _children.emplace(std::make_pair(child_path, child));
+        child->path_add(path, managed_interfaces);
+    }
+    on_child_created(child_path);
+}
+
+void Proxy::path_add_deferred(const std::string& path, RawValue managed_interfaces) {
+    if (!PathUtils::is_descendant(_path, path)) {
+        return;
+    }
+    DescendantChange change(*this, path);
+
+    std::scoped_lock lock(_child_access_mutex);
+
+    std::string child_path = PathUtils::next_child(_path, path);
+    auto child_result = _children.find(child_path);
+    if (child_result == _children.end()) {
+        _deferred.insert_or_assign(path, std::move(managed_interfaces));
+    } else if (child_path == path) {
+        child_result->second->interfaces_load(managed_interfaces.decode());
+    } else {
+        child_result->second->path_add_deferred(path, std::move(managed_interfaces));
     }
 }
 
@@ -211,19 +289,22 @@ bool Proxy::path_remove(const std::string& path, SimpleDBus::Holder options) {
     if (!PathUtils::is_descendant(_path, path)) {
         return false;
     }
+    DescendantChange change(*this, path);
 
     // As children will be extensively accessed, we need to lock the child access mutex.
     std::scoped_lock lock(_child_access_mutex);
 
     // If the path is a direct child of the proxy path, forward the request to the child proxy.
     std::string child_path = PathUtils::next_child(_path, path);
-    if (path_exists(child_path)) {
-        bool must_erase = _children.at(child_path)->path_remove(path, options);
+    deferred_materialize(child_path);
+    auto child_result = _children.find(child_path);
+    if (child_result != _children.end()) {
+        bool must_erase = child_result->second->path_remove(path, options);
 
         // if the child proxy is no longer needed and there is only one active instance of the child proxy,
         // then remove it.
-        if (must_erase && _children.at(child_path).use_count() == 1) {
-            _children.erase(child_path);
+        if (must_erase && child_result->second.use_count() == 1) {
+            _children.erase(child_result);
         }
     }
 
@@ -246,9 +327,9 @@ bool Proxy::path_prune() {
     }
 
     // For self to be pruned, the following conditions must be met:
-    // 1. The proxy has no children
+    // 1. The proxy has no children, deferred ones included.
     // 2. The proxy has no interfaces or all interfaces are disabled.
-    if (_children.empty() && !interfaces_loaded()) {
+    if (_children.empty() && _deferred.empty() && !interfaces_loaded()) {
         return true;
     }
 
@@ -257,6 +338,7 @@ bool Proxy::path_prune() {
 
 Holder Proxy::path_collect() {
     // TODO: This function logic should be moved to the ObjectManager interface.
+    children_materialize();
     SimpleDBus::Holder result = SimpleDBus::Holder::create<std::map<std::string, Holder>>();
     SimpleDBus::Holder interfaces = SimpleDBus::Holder::create<std::map<std::string, Holder>>();
 
@@ -279,6 +361,48 @@ Holder Proxy::path_collect() {
     return std::move(result);
 }
 
+// ----- DEFERRED CHILD HANDLING -----
+
+void Proxy::children_materialize() {
+    std::scoped_lock lock(_child_access_mutex);
+    while (!_deferred.empty()) {
+        deferred_materialize(PathUtils::next_child(_path, _deferred.begin()->first));
+    }
+}
+
+std::shared_ptr<Proxy> Proxy::deferred_materialize(const std::string& child_path) {
+    std::scoped_lock lock(_child_access_mutex);
+
+    // The subtree spans from the child itself up to the first path continuing with a character after '/'.
+    auto first = _deferred.lower_bound(child_path);
+    auto last = _deferred.lower_bound(child_path + static_cast<char>('/' + 1));
+    if (first == last) {
+        return nullptr;
+    }
+
+    // The child takes over whatever is deferred below it, so only one level is created at a time.
+    std::shared_ptr<Proxy> child = path_create(child_path);
+    RawValue managed_interfaces;
+    {
+        std::scoped_lock child_lock(child->_child_access_mutex);
+        while (first != last) {
+            auto node = _deferred.extract(first++);
+            if (node.key() == child_path) {
+                managed_interfaces = std::move(node.mapped());
+            } else {
+                // Entries come in order, so every insertion lands at the end.
+                child->_deferred.insert(child->_deferred.end(), std::move(node));
+            }
+        }
+    }
+
+    if (managed_interfaces.is_valid()) {
+        child->interfaces_load(managed_interfaces.decode());
+    }
+    _children.emplace(std::make_pair(child_path, child));
+    return child;
+}
+
 // ----- MANUAL CHILD HANDLING -----
 
 void Proxy::path_append_child(const std::string& path, std::shared_ptr<Proxy> child) {
@@ -289,6 +413,7 @@ void Proxy::path_append_child(const std::string& path, std::shared_ptr<Proxy> ch
         // TODO: Should an exception be thrown here?
         return;
     }
+    DescendantChange change(*this, path);
 
     // As children will be extensively accessed, we need to lock the child access mutex.
     std::scoped_lock lock(_child_access_mutex);
@@ -303,6 +428,7 @@ void Proxy::path_remove_child(const std::string& path) {
         // TODO: Should an exception be thrown here?
         return;
     }
+    DescendantChange change(*this, path);
 
     std::scoped_lock lock(_child_access_mutex);
     _children.erase(path);
@@ -311,6 +437,28 @@ void Proxy::path_remove_child(const std::string& path) {
 // ----- MESSAGE HANDLING -----
 
 void Proxy::message_handle(Message& msg) {
+    const std::string path = msg.get_path();
+    if (path != _path) {
+        // Delivered through the fallback registration, so the target has no proxy of its own yet.
+        std::shared_ptr<Proxy> child;
+        if (PathUtils::is_descendant(_path, path)) {
+            std::string child_path = PathUtils::next_child(_path, path);
+            child = deferred_materialize(child_path);
+            if (!child) {
+                std::scoped_lock lock(_child_access_mutex);
+                auto child_result = _children.find(child_path);
+                if (child_result != _children.end()) child = child_result->second;
+            }
+        }
+
+        if (!child) {
+            message_reject(msg, "org.freedesktop.DBus.Error.UnknownObject", "No such object " + path);
+            return;
+        }
+        child->message_handle(msg);
+        return;
+    }
+
     bool handled = false;
 
     // ! This is the only block that should be used to forward messages to interfaces.
@@ -319,6 +467,8 @@ void Proxy::message_handle(Message& msg) {
         handled = true;
     } else {
         LOG_WARN("Unhandled message for interface {}: {}", msg.get_interface(), msg.to_string());
+        message_reject(msg, "org.freedesktop.DBus.Error.UnknownInterface",
+                       "No such interface " + msg.get_interface() + " at " + path);
     }
 
     if (msg.get_type() == Message::Type::SIGNAL) {
@@ -329,3 +479,11 @@ void Proxy::message_handle(Message& msg) {
         LOG_ERROR("Unhandled message: {}", msg.to_string());
     }
 }
+
+void Proxy::message_reject(Message& msg, const std::string& error_name, const std::string& error_message) {
+    // Without an answer, callers would only find out once their call times out.
+    if (msg.get_type() != Message::Type::METHOD_CALL || !_conn) return;
+
+    Message error = Message::create_error(msg, error_name, error_message);
+    _conn->send(error);
+}
@@ -2,6 +2,11 @@
 #include <simpledbus/base/Connection.h>
 #include <simpledbus/base/Exceptions.h>
 #include <simpledbus/base/Logging.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <cerrno>
+#include <algorithm>
 #include <chrono>
 #include <condition_variable>
 #include <mutex>
@@ -36,6 +41,10 @@ void Connection::init() {
         dbus_error_free(&err);
         throw Exception::DBusException(err_name, err_message);
     }
+
+    if (Config::Connection::dispatch_workers > 0) {
+        _dispatch_pool = std::make_unique<DispatchPool>(Config::Connection::dispatch_workers);
+    }
     _initialized = true;
 }
 
@@ -44,16 +53,28 @@ void Connection::uninit() {
         return;
     }
 
-    std::lock_guard<std::recursive_mutex> lock(_mutex);
+    {
+        std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+        event_loop_teardown();
+
+        // In order to prevent a crash on any third party environment
+        // we need to flush the connection queue.
+        SimpleDBus::Message message;
+        do {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            read_write_dispatch();
+        } while (message.is_valid());
+    }
 
-    // In order to prevent a crash on any third party environment
-    // we need to flush the connection queue.
-    SimpleDBus::Message message;
-    do {
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
-        read_write_dispatch();
-    } while (message.is_valid());
+    // Queued handlers may still use the connection, so they get to finish before it is released.
+    // This must happen without the connection lock, as they might be waiting for it.
+    if (_dispatch_pool) {
+        _dispatch_pool->stop();
+        _dispatch_pool.reset();
+    }
 
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
     dbus_connection_unref(_conn);
     _initialized = false;
 }
@@ -116,14 +137,341 @@ void Connection::read_write_dispatch() {
         throw Exception::NotInitialized();
     }
 
-    std::lock_guard<std::recursive_mutex> lock(_mutex);
+    {
+        std::lock_guard<std::recursive_mutex> lock(_mutex);
 
-    // Non-blocking read of the next available message
-    dbus_connection_read_write(_conn, 0);
+        // Non-blocking read of the next available message
+        dbus_connection_read_write(_conn, 0);
+    }
+
+    // Dispatch incoming messages. libdbus serializes dispatching on its own, so handlers don't need the
+    // connection lock and other threads can keep using the connection meanwhile.
+    while (dbus_connection_dispatch(_conn) == DBUS_DISPATCH_DATA_REMAINS) {
+    }
+
+    pending_calls_expire();
+}
+
+void Connection::event_loop_iterate(std::chrono::milliseconds max_wait) {
+    if (!_initialized) {
+        throw Exception::NotInitialized();
+    }
+
+    {
+        std::lock_guard<std::recursive_mutex> lock(_mutex);
+        if (_epoll_fd < 0) {
+            event_loop_setup();
+        }
+    }
+
+    // Never sleep past the next libdbus timeout, and don't sleep at all if messages are already queued.
+    auto now = std::chrono::steady_clock::now();
+    auto wait = max_wait;
+    {
+        std::lock_guard<std::mutex> lock(_event_mutex);
+        for (auto& [timeout, deadline] : _timeouts) {
+            auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now);
+            wait = std::max(std::chrono::milliseconds(0), std::min(wait, remaining));
+        }
+    }
+    auto next_deadline = pending_calls_next_deadline();
+    if (next_deadline != std::chrono::steady_clock::time_point::max()) {
+        auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(next_deadline - now);
+        wait = std::max(std::chrono::milliseconds(0), std::min(wait, remaining + std::chrono::milliseconds(1)));
+    }
+    if (dbus_connection_get_dispatch_status(_conn) == DBUS_DISPATCH_DATA_REMAINS) {
+        wait = std::chrono::milliseconds(0);
+    }
+
+    epoll_event events[16];
+    int num_events = epoll_wait(_epoll_fd, events, 16, static_cast<int>(wait.count()));
+    if (num_events < 0) {
+        if (errno != EINTR) {
+            throw std::runtime_error("epoll_wait failed on D-Bus connection");
+        }
+        num_events = 0;
+    }
+
+    std::unique_lock<std::recursive_mutex> lock(_mutex);
+
+    std::vector<std::shared_ptr<FdHandler>> ready_fd_handlers;
+    for (int i = 0; i < num_events; i++) {
+        int fd = events[i].data.fd;
+        if (fd == _wakeup_fd) {
+            eventfd_t value;
+            eventfd_read(_wakeup_fd, &value);
+            continue;
+        }
+
+        {
+            std::lock_guard<std::mutex> event_lock(_event_mutex);
+            auto it = _fd_handlers.find(fd);
+            if (it != _fd_handlers.end()) {
+                ready_fd_handlers.push_back(it->second);
+                continue;
+            }
+        }
+
+        unsigned int flags = 0;
+        if (events[i].events & EPOLLIN) flags |= DBUS_WATCH_READABLE;
+        if (events[i].events & EPOLLOUT) flags |= DBUS_WATCH_WRITABLE;
+        if (events[i].events & EPOLLERR) flags |= DBUS_WATCH_ERROR;
+        if (events[i].events & EPOLLHUP) flags |= DBUS_WATCH_HANGUP;
+
+        std::vector<DBusWatch*> ready;
+        {
+            std::lock_guard<std::mutex> event_lock(_event_mutex);
+            auto it = _watches.find(fd);
+            if (it != _watches.end()) {
+                for (DBusWatch* watch : it->second) {
+                    if (dbus_watch_get_enabled(watch)) ready.push_back(watch);
+                }
+            }
+        }
+
+        for (DBusWatch* watch : ready) {
+            unsigned int watch_flags = dbus_watch_get_flags(watch) | DBUS_WATCH_ERROR | DBUS_WATCH_HANGUP;
+            dbus_watch_handle(watch, flags & watch_flags);
+        }
+    }
+
+    // Fire every expired libdbus timeout (these drive pending call expiry).
+    now = std::chrono::steady_clock::now();
+    std::vector<DBusTimeout*> expired;
+    {
+        std::lock_guard<std::mutex> event_lock(_event_mutex);
+        for (auto& [timeout, deadline] : _timeouts) {
+            if (deadline <= now) {
+                expired.push_back(timeout);
+                deadline = now + std::chrono::milliseconds(dbus_timeout_get_interval(timeout));
+            }
+        }
+    }
+    for (DBusTimeout* timeout : expired) {
+        {
+            // The timeout might have been removed by a handler fired above.
+            std::lock_guard<std::mutex> event_lock(_event_mutex);
+            if (_timeouts.find(timeout) == _timeouts.end()) continue;
+        }
+        dbus_timeout_handle(timeout);
+    }
+
+    lock.unlock();
+
+    for (auto& handler : ready_fd_handlers) {
+        std::lock_guard<std::recursive_mutex> handler_lock(handler->mutex);
+        if (handler->active) handler->callback();
+    }
 
-    // Dispatch incoming messages
+    // Dispatch incoming messages, see read_write_dispatch().
     while (dbus_connection_dispatch(_conn) == DBUS_DISPATCH_DATA_REMAINS) {
     }
+
+    pending_calls_expire();
+}
+
+void Connection::event_loop_wakeup() {
+    if (_wakeup_fd >= 0) {
+        eventfd_write(_wakeup_fd, 1);
+    }
+}
+
+bool Connection::event_loop_add_fd(int fd, std::function<void()> handler) {
+    if (!_initialized) {
+        throw Exception::NotInitialized();
+    }
+
+    {
+        std::lock_guard<std::recursive_mutex> lock(_mutex);
+        if (_epoll_fd < 0) {
+            event_loop_setup();
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(_event_mutex);
+    if (_fd_handlers.count(fd) > 0) {
+        return false;
+    }
+
+    epoll_event event = {};
+    event.events = EPOLLIN;
+    event.data.fd = fd;
+    if (epoll_ctl(_epoll_fd, EPOLL_CTL_ADD, fd, &event) < 0) {
+        throw std::runtime_error("Failed to watch file descriptor from the event loop");
+    }
+
+    auto fd_handler = std::make_shared<FdHandler>();
+    fd_handler->callback = std::move(handler);
+    _fd_handlers.emplace(fd, std::move(fd_handler));
+    return true;
+}
+
+void Connection::event_loop_watch_writable(int fd, bool writable) {
+    std::lock_guard<std::mutex> lock(_event_mutex);
+    if (_fd_handlers.count(fd) == 0) return;
+
+    epoll_event event = {};
+    event.events = writable ? EPOLLIN | EPOLLOUT : EPOLLIN;
+    event.data.fd = fd;
+    epoll_ctl(_epoll_fd, EPOLL_CTL_MOD, fd, &event);
+}
+
+void Connection::event_loop_remove_fd(int fd) {
+    std::shared_ptr<FdHandler> handler;
+    {
+        std::lock_guard<std::mutex> lock(_event_mutex);
+        auto it = _fd_handlers.find(fd);
+        if (it == _fd_handlers.end()) return;
+
+        handler = std::move(it->second);
+        _fd_handlers.erase(it);
+        if (_epoll_fd >= 0) {
+            epoll_ctl(_epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+        }
+    }
+
+    // Wait for a running invocation to finish, see unregister_object_path().
+    std::lock_guard<std::recursive_mutex> handler_lock(handler->mutex);
+    handler->active = false;
+}
+
+void Connection::event_loop_setup() {
+    _epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    _wakeup_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (_epoll_fd < 0 || _wakeup_fd < 0) {
+        event_loop_teardown();
+        throw std::runtime_error("Failed to create event loop descriptors");
+    }
+
+    epoll_event event = {};
+    event.events = EPOLLIN;
+    event.data.fd = _wakeup_fd;
+    epoll_ctl(_epoll_fd, EPOLL_CTL_ADD, _wakeup_fd, &event);
+
+    // Registering the functions immediately replays every existing watch and timeout through the add callbacks.
+    dbus_connection_set_watch_functions(_conn, &Connection::static_add_watch, &Connection::static_remove_watch,
+                                        &Connection::static_toggle_watch, this, nullptr);
+    dbus_connection_set_timeout_functions(_conn, &Connection::static_add_timeout, &Connection::static_remove_timeout,
+                                          &Connection::static_toggle_timeout, this, nullptr);
+    dbus_connection_set_wakeup_main_function(_conn, &Connection::static_wakeup_main, this, nullptr);
+    dbus_connection_set_dispatch_status_function(_conn, &Connection::static_dispatch_status, this, nullptr);
+}
+
+void Connection::event_loop_teardown() {
+    if (_epoll_fd >= 0 || _wakeup_fd >= 0) {
+        dbus_connection_set_watch_functions(_conn, nullptr, nullptr, nullptr, nullptr, nullptr);
+        dbus_connection_set_timeout_functions(_conn, nullptr, nullptr, nullptr, nullptr, nullptr);
+        dbus_connection_set_wakeup_main_function(_conn, nullptr, nullptr, nullptr);
+        dbus_connection_set_dispatch_status_function(_conn, nullptr, nullptr, nullptr);
+    }
+
+    std::lock_guard<std::mutex> lock(_event_mutex);
+    _watches.clear();
+    _timeouts.clear();
+    _fd_handlers.clear();
+
+    if (_epoll_fd >= 0) {
+        close(_epoll_fd);
+        _epoll_fd = -1;
+    }
+    if (_wakeup_fd >= 0) {
+        close(_wakeup_fd);
+        _wakeup_fd = -1;
+    }
+}
+
+void Connection::event_loop_update_fd(int fd) {
+    // NOTE: Must be called with _event_mutex held.
+    uint32_t mask = 0;
+    auto it = _watches.find(fd);
+    if (it != _watches.end()) {
+        for (DBusWatch* watch : it->second) {
+            if (!dbus_watch_get_enabled(watch)) continue;
+            unsigned int flags = dbus_watch_get_flags(watch);
+            if (flags & DBUS_WATCH_READABLE) mask |= EPOLLIN;
+            if (flags & DBUS_WATCH_WRITABLE) mask |= EPOLLOUT;
+        }
+        if (it->second.empty()) _watches.erase(it);
+    }
+
+    if (mask == 0) {
+        epoll_ctl(_epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+        return;
+    }
+
+    epoll_event event = {};
+    event.events = mask;
+    event.data.fd = fd;
+    if (epoll_ctl(_epoll_fd, EPOLL_CTL_MOD, fd, &event) < 0 && errno == ENOENT) {
+        epoll_ctl(_epoll_fd, EPOLL_CTL_ADD, fd, &event);
+    }
+}
+
+dbus_bool_t Connection::static_add_watch(DBusWatch* watch, void* user_data) {
+    Connection* conn = static_cast<Connection*>(user_data);
+    int fd = dbus_watch_get_unix_fd(watch);
+
+    std::lock_guard<std::mutex> lock(conn->_event_mutex);
+    conn->_watches[fd].push_back(watch);
+    conn->event_loop_update_fd(fd);
+    return TRUE;
+}
+
+void Connection::static_remove_watch(DBusWatch* watch, void* user_data) {
+    Connection* conn = static_cast<Connection*>(user_data);
+    int fd = dbus_watch_get_unix_fd(watch);
+
+    std::lock_guard<std::mutex> lock(conn->_event_mutex);
+    auto it = conn->_watches.find(fd);
+    if (it != conn->_watches.end()) {
+        auto& watches = it->second;
+        watches.erase(std::remove(watches.begin(), watches.end(), watch), watches.end());
+    }
+    conn->event_loop_update_fd(fd);
+}
+
+void Connection::static_toggle_watch(DBusWatch* watch, void* user_data) {
+    Connection* conn = static_cast<Connection*>(user_data);
+
+    std::lock_guard<std::mutex> lock(conn->_event_mutex);
+    conn->event_loop_update_fd(dbus_watch_get_unix_fd(watch));
+}
+
+dbus_bool_t Connection::static_add_timeout(DBusTimeout* timeout, void* user_data) {
+    static_toggle_timeout(timeout, user_data);
+    return TRUE;
+}
+
+void Connection::static_remove_timeout(DBusTimeout* timeout, void* user_data) {
+    Connection* conn = static_cast<Connection*>(user_data);
+
+    std::lock_guard<std::mutex> lock(conn->_event_mutex);
+    conn->_timeouts.erase(timeout);
+}
+
+void Connection::static_toggle_timeout(DBusTimeout* timeout, void* user_data) {
+    Connection* conn = static_cast<Connection*>(user_data);
+
+    {
+        std::lock_guard<std::mutex> lock(conn->_event_mutex);
+        if (dbus_timeout_get_enabled(timeout)) {
+            auto interval = std::chrono::milliseconds(dbus_timeout_get_interval(timeout));
+            conn->_timeouts[timeout] = std::chrono::steady_clock::now() + interval;
+        } else {
+            conn->_timeouts.erase(timeout);
+        }
+    }
+
+    // The loop may be sleeping past the new deadline.
+    conn->event_loop_wakeup();
+}
+
+void Connection::static_wakeup_main(void* user_data) { static_cast<Connection*>(user_data)->event_loop_wakeup(); }
+
+void Connection::static_dispatch_status(DBusConnection* connection, DBusDispatchStatus new_status, void* user_data) {
+    if (new_status == DBUS_DISPATCH_DATA_REMAINS) {
+        static_cast<Connection*>(user_data)->event_loop_wakeup();
+    }
 }
 
 Message Connection::pop_message() {
@@ -148,52 +496,69 @@ void Connection::send(Message& msg) {
     dbus_connection_send(_conn, msg, &msg_serial);
 }
 
-Message Connection::send_with_reply(Message& msg) {
-    DBusPendingCall* pending = nullptr;
-    dbus_connection_send_with_reply(_conn, msg, &pending, -1);
+Message Connection::send_with_reply(Message& msg) { return send_async(msg)->get(); }
 
-    if (!pending) {
-        throw std::runtime_error("Failed to queue D-Bus message (Out of memory?)");
+std::shared_ptr<PendingCall> Connection::send_async(Message& msg, PendingCall::Callback callback) {
+    return send_async(msg, std::move(callback), Config::Connection::send_with_reply_timeout);
+}
+
+std::shared_ptr<PendingCall> Connection::send_async(Message& msg, PendingCall::Callback callback,
+                                                    std::chrono::steady_clock::duration timeout) {
+    if (!_initialized) {
+        throw Exception::NotInitialized();
     }
 
-    AsyncContext ctx;
-    dbus_pending_call_set_notify(pending, static_reply_handler, &ctx, nullptr);
+    auto call = std::make_shared<PendingCall>(msg, std::move(callback), timeout);
 
-    bool timed_out = false;
-    {
-        std::unique_lock<std::mutex> lock(ctx.mtx);
-        if (!ctx.cv.wait_for(lock, Config::Connection::send_with_reply_timeout, [&ctx] { return ctx.completed; })) {
-            timed_out = true;
-        }
+    // Expiry is handled by PendingCall itself, so libdbus doesn't need to track a timeout.
+    DBusPendingCall* pending = nullptr;
+    dbus_connection_send_with_reply(_conn, msg, &pending, DBUS_TIMEOUT_INFINITE);
+    if (!pending) {
+        throw std::runtime_error("Failed to queue D-Bus message (Out of memory?)");
     }
 
-    if (timed_out) {
-        // Essential: cancel the pending call so the callback doesn't fire
-        // later and access the 'ctx' which is about to be destroyed.
-        dbus_pending_call_cancel(pending);
-        dbus_pending_call_unref(pending);
-        throw std::runtime_error("D-Bus call timed out");
+    {
+        std::lock_guard<std::mutex> lock(_pending_calls_mutex);
+        _pending_calls.push_back(call);
     }
+    call->attach(pending);
 
-    // We have a result; the pending call handle is no longer needed.
-    dbus_pending_call_unref(pending);
+    // Let a sleeping event loop account for the new deadline.
+    event_loop_wakeup();
+    return call;
+}
 
-    DBusMessage* reply = ctx.reply;
-    if (!reply) {
-        throw std::runtime_error("Received null reply from D-Bus");
+void Connection::pending_calls_expire() {
+    auto now = std::chrono::steady_clock::now();
+    std::vector<std::shared_ptr<PendingCall>> expired;
+    {
+        std::lock_guard<std::mutex> lock(_pending_calls_mutex);
+        auto it = _pending_calls.begin();
+        while (it != _pending_calls.end()) {
+            auto& call = *it;
+            if (call->is_pending() && call->deadline() > now) {
+                ++it;
+                continue;
+            }
+            if (call->is_pending()) {
+                expired.push_back(call);
+            }
+            it = _pending_calls.erase(it);
+        }
     }
 
-    if (dbus_message_get_type(reply) == DBUS_MESSAGE_TYPE_ERROR) {
-        const char* err_name = dbus_message_get_error_name(reply);
-        const char* err_text = "No error detail provided";
-
-        // Try to extract the error string argument if it exists
-        dbus_message_get_args(reply, nullptr, DBUS_TYPE_STRING, &err_text, DBUS_TYPE_INVALID);
-        dbus_message_unref(reply);
-        throw Exception::SendFailed(err_name, err_text, msg.to_string());
+    for (auto& call : expired) {
+        call->resolve(PendingCall::State::TIMED_OUT);
     }
+}
 
-    return Message::from_acquired(reply);
+std::chrono::steady_clock::time_point Connection::pending_calls_next_deadline() {
+    auto next = std::chrono::steady_clock::time_point::max();
+    std::lock_guard<std::mutex> lock(_pending_calls_mutex);
+    for (auto& call : _pending_calls) {
+        next = std::min(next, call->deadline());
+    }
+    return next;
 }
 
 Message Connection::send_with_reply_and_block(Message& msg) {
@@ -224,56 +589,126 @@ std::string Connection::unique_name() {
 }
 
 bool Connection::register_object_path(const std::string& path, std::function<void(Message&)> handler) {
+    return message_handler_register(path, std::move(handler), false);
+}
+
+bool Connection::register_fallback(const std::string& path, std::function<void(Message&)> handler) {
+    return message_handler_register(path, std::move(handler), true);
+}
+
+bool Connection::message_handler_register(const std::string& path, std::function<void(Message&)> handler,
+                                          bool fallback) {
     if (!_initialized) {
         return false;
     }
 
-    std::lock_guard<std::recursive_mutex> lock(_mutex);
-    if (_message_handlers.find(path) == _message_handlers.end()) {
+    std::lock_guard<std::mutex> lock(_message_handlers_mutex);
+    if (!_message_handlers.contains(path)) {
         DBusObjectPathVTable vtable = {0};
         vtable.message_function = &Connection::static_message_handler;
-        dbus_connection_register_object_path(_conn, path.c_str(), &vtable, this);
-        _message_handlers[path] = std::move(handler);
+        if (fallback) {
+            dbus_connection_register_fallback(_conn, path.c_str(), &vtable, this);
+        } else {
+            dbus_connection_register_object_path(_conn, path.c_str(), &vtable, this);
+        }
+
+        auto entry = std::make_shared<MessageHandler>();
+        entry->callback = std::move(handler);
+        entry->fallback = fallback;
+        _message_handlers.insert(path, std::move(entry));
     }
 
     return true;
 }
 
+std::shared_ptr<Connection::MessageHandler> Connection::message_handler_find(const std::string& path) {
+    std::lock_guard<std::mutex> lock(_message_handlers_mutex);
+    auto* entry = _message_handlers.find(path);
+    if (entry != nullptr) {
+        return *entry;
+    }
+
+    // Same as libdbus, the closest fallback above the path gets the message.
+    std::string_view ancestor = path;
+    while (ancestor.size() > 1) {
+        size_t pos = ancestor.rfind('/');
+        ancestor = ancestor.substr(0, pos == 0 ? 1 : pos);
+        entry = _message_handlers.find(ancestor);
+        if (entry != nullptr && (*entry)->fallback) {
+            return *entry;
+        }
+    }
+    return nullptr;
+}
+
 bool Connection::unregister_object_path(const std::string& path) {
-    std::lock_guard<std::recursive_mutex> lock(_mutex);
-    auto it = _message_handlers.find(path);
-    if (it != _message_handlers.end()) {
+    std::shared_ptr<MessageHandler> handler;
+    {
+        std::lock_guard<std::mutex> lock(_message_handlers_mutex);
+        auto* entry = _message_handlers.find(path);
+        if (entry == nullptr) {
+            return true;
+        }
+
+        handler = *entry;
+        _message_handlers.erase(path);
         dbus_connection_unregister_object_path(_conn, path.c_str());
-        _message_handlers.erase(it);
     }
 
+    // Waits for a running invocation on another thread. The handler may also be unregistering itself,
+    // which is fine as the lock is recursive and the callback stays alive until it returns.
+    std::lock_guard<std::recursive_mutex> lock(handler->mutex);
+    handler->active = false;
     return true;
 }
 
-DBusHandlerResult Connection::static_message_handler(DBusConnection* connection, DBusMessage* message,
-                                                     void* user_data) {
-    Connection* conn = static_cast<Connection*>(user_data);
-    Message msg = Message::from_retained(message);
-    std::string path = msg.get_path();
+void Connection::message_handler_invoke(MessageHandler& handler, Message& msg) {
+    std::lock_guard<std::recursive_mutex> lock(handler.mutex);
+    if (handler.active) {
+        handler.callback(msg);
+    }
+}
 
-    std::lock_guard<std::recursive_mutex> lock(conn->_mutex);
-    auto it = conn->_message_handlers.find(path);
-    if (it != conn->_message_handlers.end()) {
-        it->second(msg);
+std::string_view Connection::dispatch_key(DBusMessage* message, const char* path) {
+    // The object manager announces objects on its own path, so these go with the object they describe instead,
+    // ahead of anything that object sends afterwards.
+    if (!dbus_message_is_signal(message, "org.freedesktop.DBus.ObjectManager", "InterfacesAdded") &&
+        !dbus_message_is_signal(message, "org.freedesktop.DBus.ObjectManager", "InterfacesRemoved")) {
+        return path;
     }
 
-    return DBUS_HANDLER_RESULT_HANDLED;
+    DBusMessageIter iter;
+    const char* object_path = nullptr;
+    if (!dbus_message_iter_init(message, &iter) || dbus_message_iter_get_arg_type(&iter) != DBUS_TYPE_OBJECT_PATH) {
+        return path;
+    }
+    dbus_message_iter_get_basic(&iter, &object_path);
+    return object_path;
 }
 
-void Connection::static_reply_handler(DBusPendingCall* pending, void* user_data) {
-    auto* ctx = static_cast<AsyncContext*>(user_data);
+DBusHandlerResult Connection::static_message_handler(DBusConnection* connection, DBusMessage* message,
+                                                     void* user_data) {
+    Connection* conn = static_cast<Connection*>(user_data);
+    const char* path = dbus_message_get_path(message);
+    if (path == nullptr) {
+        return DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
+    }
 
-    std::lock_guard<std::mutex> lock(ctx->mtx);
+    // Unregistered while the message was queued. Left to libdbus, which answers method calls with an error.
+    std::shared_ptr<MessageHandler> handler = conn->message_handler_find(path);
+    if (!handler) {
+        return DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
+    }
 
-    // Steal the reply from the pending call object
-    ctx->reply = dbus_pending_call_steal_reply(pending);
-    ctx->completed = true;
+    Message msg = Message::from_retained(message);
+    if (conn->_dispatch_pool) {
+        // Sharding by path keeps the messages of each object in order while other objects proceed in parallel.
+        conn->_dispatch_pool->post(dispatch_key(message, path), [handler, msg = std::move(msg)]() mutable {
+            message_handler_invoke(*handler, msg);
+        });
+    } else {
+        message_handler_invoke(*handler, msg);
+    }
 
-    // Wake the send_with_reply thread
-    ctx->cv.notify_one();
-}
\ No newline at end of file
+    return DBUS_HANDLER_RESULT_HANDLED;
+}
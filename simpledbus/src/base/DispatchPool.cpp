@@ -0,0 +1,71 @@
+#include <simpledbus/base/DispatchPool.h>
+#include <simpledbus/base/Logging.h>
+
+#include <exception>
+
+using namespace SimpleDBus;
+
+DispatchPool::DispatchPool(size_t num_workers) {
+    for (size_t i = 0; i < num_workers; i++) {
+        auto worker = std::make_shared<Worker>();
+        worker->thread = std::thread(&DispatchPool::run, worker);
+        _workers.push_back(std::move(worker));
+    }
+}
+
+DispatchPool::~DispatchPool() { stop(); }
+
+size_t DispatchPool::size() const { return _workers.size(); }
+
+void DispatchPool::post(std::string_view key, Task task) {
+    if (_workers.empty()) return;
+
+    Worker& worker = *_workers[std::hash<std::string_view>{}(key) % _workers.size()];
+    {
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        if (worker.stopping) return;
+        worker.queue.push_back(std::move(task));
+    }
+    worker.cv.notify_one();
+}
+
+void DispatchPool::stop() {
+    for (auto& worker : _workers) {
+        {
+            std::lock_guard<std::mutex> lock(worker->mutex);
+            worker->stopping = true;
+        }
+        worker->cv.notify_one();
+    }
+
+    for (auto& worker : _workers) {
+        if (!worker->thread.joinable()) continue;
+
+        // A task may end up tearing down its own pool, in which case the worker can't wait for itself.
+        if (worker->thread.get_id() == std::this_thread::get_id()) {
+            worker->thread.detach();
+        } else {
+            worker->thread.join();
+        }
+    }
+}
+
+void DispatchPool::run(std::shared_ptr<Worker> self) {
+    Worker& worker = *self;
+    std::unique_lock<std::mutex> lock(worker.mutex);
+    while (true) {
+        worker.cv.wait(lock, [&worker] { return worker.stopping || !worker.queue.empty(); });
+        if (worker.queue.empty()) return;
+
+        Task task = std::move(worker.queue.front());
+        worker.queue.pop_front();
+
+        lock.unlock();
+        try {
+            task();
+        } catch (const std::exception& e) {
+            LOG_ERROR("Unhandled exception in dispatched handler: {}", e.what());
+        }
+        lock.lock();
+    }
+}
@@ -16,12 +16,15 @@ DBusException::DBusException(const std::string& err_name, const std::string& err
 
 const char* DBusException::what() const noexcept { return _message.c_str(); }
 
-SendFailed::SendFailed(const std::string& err_name, const std::string& err_message, const std::string& msg_str) {
+SendFailed::SendFailed(const std::string& err_name, const std::string& err_message, const std::string& msg_str)
+    : _error_name(err_name) {
     _message = fmt::format("{}: {}\n{}", err_name, err_message, msg_str);
 }
 
 const char* SendFailed::what() const noexcept { return _message.c_str(); }
 
+const std::string& SendFailed::error_name() const { return _error_name; }
+
 InterfaceNotFoundException::InterfaceNotFoundException(const std::string& path, const std::string& interface) {
     _message = fmt::format("Path {} does not contain interface {}", path, interface);
 }
@@ -34,6 +37,12 @@ PathNotFoundException::PathNotFoundException(const std::string& path, const std:
 
 const char* PathNotFoundException::what() const noexcept { return _message.c_str(); }
 
+SignatureMismatch::SignatureMismatch(const std::string& expected, const std::string& received) {
+    _message = fmt::format("Expected signature {} but received {}", expected, received);
+}
+
+const char* SignatureMismatch::what() const noexcept { return _message.c_str(); }
+
 }  // namespace Exception
 
 }  // namespace SimpleDBus
@@ -1,4 +1,5 @@
 #include <simpledbus/base/Holder.h>
+#include <algorithm>
 #include <iomanip>
 #include <sstream>
 
@@ -14,6 +15,10 @@ bool Holder::operator!=(const Holder& other) const { return !(*this == other); }
 
 bool Holder::operator==(const Holder& other) const {
     if (_type != other._type) {
+        // A byte array might have been built element by element.
+        if ((_type == BYTE_ARRAY && other._type == ARRAY) || (_type == ARRAY && other._type == BYTE_ARRAY)) {
+            return get<std::vector<Holder>>() == other.get<std::vector<Holder>>();
+        }
         return false;
     }
 
@@ -27,32 +32,30 @@ bool Holder::operator==(const Holder& other) const {
         case UINT32:
         case INT64:
         case UINT64:
-            return holder_integer == other.holder_integer;
+            return _get_integer() == other._get_integer();
         case BOOLEAN:
-            return holder_boolean == other.holder_boolean;
+            return _get_boolean() == other._get_boolean();
         case DOUBLE:
-            return holder_double == other.holder_double;
+            return _get_double() == other._get_double();
         case STRING:
         case OBJ_PATH:
         case SIGNATURE:
-            return holder_string == other.holder_string;
+            return _get_string() == other._get_string();
         case ARRAY:
-            return holder_array == other.holder_array;
+            return _get_array() == other._get_array();
+        case BYTE_ARRAY: {
+            auto& bytes = *std::get<ByteArrayPtr>(_data);
+            auto& other_bytes = *std::get<ByteArrayPtr>(other._data);
+            return std::equal(bytes.begin(), bytes.end(), other_bytes.begin(), other_bytes.end());
+        }
         case DICT: {
-            if (holder_dict.size() != other.holder_dict.size()) {
+            const Dict& dict = _get_dict();
+            const Dict& other_dict = other._get_dict();
+            if (dict.size() != other_dict.size()) {
                 return false;
             }
-            for (const auto& [type_a, key_a, val_a] : holder_dict) {
-                bool found = false;
-                for (const auto& [type_b, key_b, val_b] : other.holder_dict) {
-                    if (type_a == type_b && val_a == val_b) {
-                        if (_compare_any(type_a, key_a, key_b)) {
-                            found = true;
-                            break;
-                        }
-                    }
-                }
-                if (!found) return false;
+            for (const auto& entry : dict) {
+                if (std::find(other_dict.begin(), other_dict.end(), entry) == other_dict.end()) return false;
             }
             return true;
         }
@@ -61,6 +64,39 @@ bool Holder::operator==(const Holder& other) const {
     }
 }
 
+bool Holder::_get_boolean() const {
+    auto value = std::get_if<bool>(&_data);
+    return value ? *value : false;
+}
+
+uint64_t Holder::_get_integer() const {
+    auto value = std::get_if<uint64_t>(&_data);
+    return value ? *value : 0;
+}
+
+double Holder::_get_double() const {
+    auto value = std::get_if<double>(&_data);
+    return value ? *value : 0;
+}
+
+const std::string& Holder::_get_string() const {
+    static const std::string empty;
+    auto value = std::get_if<std::string>(&_data);
+    return value ? *value : empty;
+}
+
+const Holder::Array& Holder::_get_array() const {
+    static const Array empty;
+    auto value = std::get_if<Array>(&_data);
+    return value ? *value : empty;
+}
+
+const Holder::Dict& Holder::_get_dict() const {
+    static const Dict empty;
+    auto value = std::get_if<Dict>(&_data);
+    return value ? *value : empty;
+}
+
 Holder::Type Holder::type() const { return _type; }
 
 std::string Holder::_represent_simple() const {
@@ -126,23 +162,13 @@ std::vector<std::string> Holder::_represent_container() const {
         case ARRAY: {
             output_lines.push_back("Array:");
             std::vector<std::string> additional_lines;
-            if (holder_array.size() > 0 && holder_array[0]._type == BYTE) {
+            const Array& array = _get_array();
+            if (array.size() > 0 && array[0]._type == BYTE) {
                 // Dealing with an array of bytes, use custom print functionality.
-                std::string temp_line = "";
-                for (size_t i = 0; i < holder_array.size(); i++) {
-                    // Represent each byte as a hex string
-                    std::stringstream stream;
-                    stream << std::setfill('0') << std::setw(2) << std::hex << ((int)holder_array[i].get<uint8_t>());
-                    temp_line += (stream.str() + " ");
-                    if ((i + 1) % 32 == 0) {
-                        additional_lines.push_back(temp_line);
-                        temp_line = "";
-                    }
-                }
-                additional_lines.push_back(temp_line);
+                additional_lines = _represent_bytes(get<kvn::bytearray>());
             } else {
-                for (size_t i = 0; i < holder_array.size(); i++) {
-                    for (auto& line : holder_array[i]._represent_container()) {
+                for (const auto& element : array) {
+                    for (auto& line : element._represent_container()) {
                         additional_lines.push_back(line);
                     }
                 }
@@ -152,10 +178,16 @@ std::vector<std::string> Holder::_represent_container() const {
             }
             break;
         }
+        case BYTE_ARRAY:
+            output_lines.push_back("Array:");
+            for (auto& line : _represent_bytes(*std::get<ByteArrayPtr>(_data))) {
+                output_lines.push_back("  " + line);
+            }
+            break;
         case DICT:
             output_lines.push_back("Dictionary:");
-            for (auto& [key_type_internal, key, value] : holder_dict) {
-                output_lines.push_back(_represent_type(key_type_internal, key) + ":");
+            for (const auto& [key, value] : _get_dict()) {
+                output_lines.push_back(key._represent_simple() + ":");
                 auto additional_lines = value._represent_container();
                 for (auto& line : additional_lines) {
                     output_lines.push_back("  " + line);
@@ -168,6 +200,23 @@ std::vector<std::string> Holder::_represent_container() const {
     return output_lines;
 }
 
+std::vector<std::string> Holder::_represent_bytes(const kvn::bytearray& bytes) {
+    std::vector<std::string> output_lines;
+    std::string temp_line = "";
+    for (size_t i = 0; i < bytes.size(); i++) {
+        // Represent each byte as a hex string
+        std::stringstream stream;
+        stream << std::setfill('0') << std::setw(2) << std::hex << ((int)bytes[i]);
+        temp_line += (stream.str() + " ");
+        if ((i + 1) % 32 == 0) {
+            output_lines.push_back(temp_line);
+            temp_line = "";
+        }
+    }
+    output_lines.push_back(temp_line);
+    return output_lines;
+}
+
 std::string Holder::represent() const {
     std::ostringstream output;
     auto output_lines = _represent_container();
@@ -203,6 +252,8 @@ std::string Holder::_signature_simple() const {
             return DBUS_TYPE_OBJECT_PATH_AS_STRING;
         case SIGNATURE:
             return DBUS_TYPE_SIGNATURE_AS_STRING;
+        case BYTE_ARRAY:
+            return DBUS_TYPE_ARRAY_AS_STRING DBUS_TYPE_BYTE_AS_STRING;
         default:
             return "";
     }
@@ -239,52 +290,9 @@ std::string Holder::_signature_type(Type type) noexcept {
     }
 }
 
-std::string Holder::_represent_type(Type type, std::any value) noexcept {
-    std::ostringstream output;
-    output << std::boolalpha;
-
-    switch (type) {
-        case BOOLEAN:
-            output << std::any_cast<bool>(value);
-            break;
-        case BYTE:
-            output << std::any_cast<uint8_t>(value);
-            break;
-        case INT16:
-            output << std::any_cast<int16_t>(value);
-            break;
-        case UINT16:
-            output << std::any_cast<uint16_t>(value);
-            break;
-        case INT32:
-            output << std::any_cast<int32_t>(value);
-            break;
-        case UINT32:
-            output << std::any_cast<uint32_t>(value);
-            break;
-        case INT64:
-            output << std::any_cast<int64_t>(value);
-            break;
-        case UINT64:
-            output << std::any_cast<uint64_t>(value);
-            break;
-        case DOUBLE:
-            output << std::any_cast<double>(value);
-            break;
-        case STRING:
-        case OBJ_PATH:
-        case SIGNATURE:
-            output << std::any_cast<std::string>(value);
-            break;
-        default:
-            break;
-    }
-    return output.str();
-}
-
 void Holder::signature_override(const std::string& signature) {
     // TODO: Check that the signature is valid for the Holder type and contents.
-    _signature = signature;
+    _signature = std::make_shared<const std::string>(signature);
 }
 
 std::string Holder::signature() const {
@@ -306,17 +314,19 @@ std::string Holder::signature() const {
         case STRING:
         case OBJ_PATH:
         case SIGNATURE:
+        case BYTE_ARRAY:
             output = _signature_simple();
             break;
-        case ARRAY:
+        case ARRAY: {
+            const Array& array = _get_array();
             output = DBUS_TYPE_ARRAY_AS_STRING;
-            if (holder_array.size() == 0) {
+            if (array.size() == 0) {
                 output += DBUS_TYPE_VARIANT_AS_STRING;
             } else {
-                // Check if all elements of holder_array are the same type
-                auto first_type = holder_array[0]._type;
+                // Check if all elements of the array are the same type
+                auto first_type = array[0]._type;
                 bool all_same_type = true;
-                for (auto& element : holder_array) {
+                for (auto& element : array) {
                     if (element._type != first_type) {
                         all_same_type = false;
                         break;
@@ -324,25 +334,27 @@ std::string Holder::signature() const {
                 }
 
                 if (all_same_type) {
-                    output += holder_array[0]._signature_simple();
+                    output += array[0]._signature_simple();
                 } else {
                     output += DBUS_TYPE_VARIANT_AS_STRING;
                 }
             }
             break;
-        case DICT:
+        }
+        case DICT: {
+            const Dict& dict = _get_dict();
             output = DBUS_TYPE_ARRAY_AS_STRING;
             output += DBUS_DICT_ENTRY_BEGIN_CHAR_AS_STRING;
 
-            if (holder_dict.size() == 0) {
+            if (dict.size() == 0) {
                 output += DBUS_TYPE_STRING_AS_STRING;
                 output += DBUS_TYPE_VARIANT_AS_STRING;
             } else {
-                // Check if all keys of holder_dict are the same type
-                auto first_key_type = std::get<0>(holder_dict[0]);
+                // Check if all keys of the dictionary are the same type
+                auto first_key_type = dict[0].first._type;
                 bool all_same_key_type = true;
-                for (auto& [key_type_internal, key, value] : holder_dict) {
-                    if (key_type_internal != first_key_type) {
+                for (auto& [key, value] : dict) {
+                    if (key._type != first_key_type) {
                         all_same_key_type = false;
                         break;
                     }
@@ -353,18 +365,19 @@ std::string Holder::signature() const {
                     output += DBUS_TYPE_VARIANT_AS_STRING;
                 }
 
-                // Check if all values of holder_dict are the same type
-                auto first_value_type = std::get<2>(holder_dict[0])._type;
+                // Check if all values of the dictionary are the same type
+                auto first_value_type = dict[0].second._type;
                 bool all_same_value_type = true;
-                for (auto& [key_type_internal, key, value] : holder_dict) {
+                for (auto& [key, value] : dict) {
                     if (value._type != first_value_type) {
                         all_same_value_type = false;
                         break;
                     }
                 }
 
-                if (all_same_value_type && first_value_type != ARRAY && first_value_type != DICT) {
-                    output += std::get<2>(holder_dict[0])._signature_simple();
+                if (all_same_value_type && first_value_type != ARRAY && first_value_type != DICT &&
+                    first_value_type != BYTE_ARRAY) {
+                    output += dict[0].second._signature_simple();
                 } else {
                     output += DBUS_TYPE_VARIANT_AS_STRING;
                 }
@@ -372,6 +385,7 @@ std::string Holder::signature() const {
 
             output += DBUS_DICT_ENTRY_END_CHAR_AS_STRING;
             break;
+        }
         default:
             break;
     }
@@ -410,44 +424,88 @@ std::any Holder::get_contents() const {
     }
 }
 
-void Holder::array_append(Holder holder) { holder_array.push_back(holder); }
+void Holder::array_append(Holder holder) {
+    if (_type == BYTE_ARRAY) {
+        if (holder._type == BYTE) {
+            _mutable_byte_array().push_back(holder.get<uint8_t>());
+            return;
+        }
+        _data = _expand_byte_array();
+        _type = ARRAY;
+    }
 
-void Holder::dict_append(Type key_type, std::any key, Holder value) {
-    if (key.type() == typeid(const char*)) {
-        key = std::string(std::any_cast<const char*>(key));
+    if (!std::holds_alternative<Array>(_data)) {
+        _data = Array();
     }
+    std::get<Array>(_data).push_back(std::move(holder));
+}
 
-    // TODO : VALIDATE THAT THE SPECIFIED KEY TYPE IS CORRECT
+Holder Holder::create_byte_array(const uint8_t* data, size_t size) {
+    Holder h;
+    h._type = BYTE_ARRAY;
+    h._data = std::make_shared<kvn::bytearray>(data, size);
+    return h;
+}
 
-    holder_dict.push_back(std::make_tuple(key_type, key, value));
+const kvn::bytearray* Holder::byte_array() const {
+    auto bytes = std::get_if<ByteArrayPtr>(&_data);
+    return bytes ? bytes->get() : nullptr;
 }
 
-bool Holder::_compare_any(Type type, const std::any& a, const std::any& b) {
-    if (a.type() != b.type()) return false;
-    switch (type) {
-        case BOOLEAN:
-            return std::any_cast<bool>(a) == std::any_cast<bool>(b);
-        case BYTE:
-            return std::any_cast<uint8_t>(a) == std::any_cast<uint8_t>(b);
-        case INT16:
-            return std::any_cast<int16_t>(a) == std::any_cast<int16_t>(b);
-        case UINT16:
-            return std::any_cast<uint16_t>(a) == std::any_cast<uint16_t>(b);
-        case INT32:
-            return std::any_cast<int32_t>(a) == std::any_cast<int32_t>(b);
-        case UINT32:
-            return std::any_cast<uint32_t>(a) == std::any_cast<uint32_t>(b);
-        case INT64:
-            return std::any_cast<int64_t>(a) == std::any_cast<int64_t>(b);
-        case UINT64:
-            return std::any_cast<uint64_t>(a) == std::any_cast<uint64_t>(b);
-        case DOUBLE:
-            return std::any_cast<double>(a) == std::any_cast<double>(b);
-        case STRING:
-        case OBJ_PATH:
-        case SIGNATURE:
-            return std::any_cast<std::string>(a) == std::any_cast<std::string>(b);
-        default:
-            return false;
+kvn::bytearray& Holder::_mutable_byte_array() {
+    // Copied once when shared with another holder, after which appends go to the private copy.
+    auto& bytes = std::get<ByteArrayPtr>(_data);
+    if (bytes.use_count() != 1) {
+        bytes = std::make_shared<kvn::bytearray>(*bytes);
+    }
+    return const_cast<kvn::bytearray&>(*bytes);
+}
+
+std::vector<Holder> Holder::_expand_byte_array() const {
+    std::vector<Holder> output;
+    if (auto bytes = std::get_if<ByteArrayPtr>(&_data)) {
+        output.reserve((*bytes)->size());
+        for (uint8_t byte : **bytes) {
+            output.push_back(Holder::create<uint8_t>(byte));
+        }
+    }
+    return output;
+}
+
+void Holder::dict_append(Holder key, Holder value) {
+    if (!std::holds_alternative<Dict>(_data)) {
+        _data = Dict();
+    }
+    std::get<Dict>(_data).emplace_back(std::move(key), std::move(value));
+}
+
+void Holder::dict_append(Type key_type, std::any key, Holder value) {
+    // Legacy entry point, the templated overload avoids the std::any round trip.
+    if (key.type() == typeid(const char*)) {
+        dict_append(key_type, std::string(std::any_cast<const char*>(key)), std::move(value));
+    } else if (key.type() == typeid(std::string)) {
+        dict_append(key_type, std::any_cast<std::string>(key), std::move(value));
+    } else if (key.type() == typeid(ObjectPath)) {
+        dict_append(OBJ_PATH, std::string(std::any_cast<ObjectPath>(key)), std::move(value));
+    } else if (key.type() == typeid(Signature)) {
+        dict_append(SIGNATURE, std::string(std::any_cast<Signature>(key)), std::move(value));
+    } else if (key.type() == typeid(bool)) {
+        dict_append(key_type, std::any_cast<bool>(key), std::move(value));
+    } else if (key.type() == typeid(uint8_t)) {
+        dict_append(key_type, std::any_cast<uint8_t>(key), std::move(value));
+    } else if (key.type() == typeid(int16_t)) {
+        dict_append(key_type, std::any_cast<int16_t>(key), std::move(value));
+    } else if (key.type() == typeid(uint16_t)) {
+        dict_append(key_type, std::any_cast<uint16_t>(key), std::move(value));
+    } else if (key.type() == typeid(int32_t)) {
+        dict_append(key_type, std::any_cast<int32_t>(key), std::move(value));
+    } else if (key.type() == typeid(uint32_t)) {
+        dict_append(key_type, std::any_cast<uint32_t>(key), std::move(value));
+    } else if (key.type() == typeid(int64_t)) {
+        dict_append(key_type, std::any_cast<int64_t>(key), std::move(value));
+    } else if (key.type() == typeid(uint64_t)) {
+        dict_append(key_type, std::any_cast<uint64_t>(key), std::move(value));
+    } else if (key.type() == typeid(double)) {
+        dict_append(key_type, std::any_cast<double>(key), std::move(value));
     }
 }
@@ -1,6 +1,7 @@
 #include <simpledbus/base/Message.h>
 
 #include <sstream>
+#include <utility>
 
 using namespace SimpleDBus;
 
@@ -25,6 +26,35 @@ using namespace SimpleDBus;
 
 std::atomic_int32_t Message::_creation_counter = 0;
 
+RawValue::RawValue(DBusMessage* msg, const DBusMessageIter& iter) : _msg(msg), _iter(iter) { dbus_message_ref(_msg); }
+
+RawValue::RawValue(const RawValue& other) : _msg(other._msg), _iter(other._iter) {
+    if (_msg) dbus_message_ref(_msg);
+}
+
+RawValue::RawValue(RawValue&& other) noexcept : _msg(std::exchange(other._msg, nullptr)), _iter(other._iter) {}
+
+RawValue& RawValue::operator=(RawValue other) noexcept {
+    std::swap(_msg, other._msg);
+    std::swap(_iter, other._iter);
+    return *this;
+}
+
+RawValue::~RawValue() {
+    if (_msg) dbus_message_unref(_msg);
+}
+
+bool RawValue::is_valid() const { return _msg != nullptr; }
+
+Holder RawValue::decode() const {
+    if (!_msg) return Holder();
+
+    // Reading only advances the copy of the iterator, so a value can be decoded any number of times.
+    DBusMessageIter iter = _iter;
+    Message msg = Message::from_retained(_msg);
+    return msg._extract_generic(&iter);
+}
+
 Message::Message() {}
 
 Message::~Message() {
@@ -199,7 +229,14 @@ void Message::_append_argument(DBusMessageIter* iter, const Holder& argument, co
             auto sig_next = signature.substr(1);
             DBusMessageIter sub_iter;
             dbus_message_iter_open_container(iter, DBUS_TYPE_ARRAY, sig_next.c_str(), &sub_iter);
-            if (sig_next[0] != DBUS_DICT_ENTRY_BEGIN_CHAR) {
+            if (sig_next[0] == DBUS_TYPE_BYTE && argument.type() == Holder::BYTE_ARRAY) {
+                // Appended straight from the buffer of the holder, libdbus makes its own copy.
+                const kvn::bytearray* bytes = argument.byte_array();
+                const uint8_t* p_bytes = bytes->data();
+                if (!bytes->empty()) {
+                    dbus_message_iter_append_fixed_array(&sub_iter, DBUS_TYPE_BYTE, &p_bytes, bytes->size());
+                }
+            } else if (sig_next[0] != DBUS_DICT_ENTRY_BEGIN_CHAR) {
                 auto array_contents = argument.get<std::vector<Holder>>();
                 for (auto elem : array_contents) {
                     _append_argument(&sub_iter, elem, sig_next);
@@ -267,6 +304,28 @@ void Message::_append_argument(DBusMessageIter* iter, const Holder& argument, co
     }
 }
 
+void Message::_expect_type(DBusMessageIter* iter, const char* signature) {
+    int arg_type = dbus_message_iter_get_arg_type(iter);
+    bool matches = arg_type == signature[0];
+
+    // Arrays carry their element type, which is enough to tell "ay", "as" and "a{sv}" apart up front.
+    // Anything nested deeper is checked as it gets decoded.
+    if (matches && arg_type == DBUS_TYPE_ARRAY) {
+        int element_type = signature[1] == DBUS_DICT_ENTRY_BEGIN_CHAR ? DBUS_TYPE_DICT_ENTRY : signature[1];
+        matches = dbus_message_iter_get_element_type(iter) == element_type;
+    }
+
+    if (!matches) {
+        std::string received;
+        if (arg_type != DBUS_TYPE_INVALID) {
+            char* received_signature = dbus_message_iter_get_signature(iter);
+            received = received_signature;
+            dbus_free(received_signature);
+        }
+        throw Exception::SignatureMismatch(signature, received);
+    }
+}
+
 void Message::append_argument(const Holder& argument, const std::string& signature) {
     dbus_message_iter_init_append(_msg, &_iter);
     _append_argument(&_iter, argument, signature);
@@ -412,30 +471,24 @@ void Message::extract_next() {
 }
 
 Holder Message::_extract_bytearray(DBusMessageIter* iter) {
-    const unsigned char* bytes;
-    int len;
-    dbus_message_iter_get_fixed_array(iter, &bytes, &len);
-    Holder holder_array = Holder::create<std::vector<Holder>>();
-    for (int i = 0; i < len; i++) {
-        holder_array.array_append(Holder::create<uint8_t>(bytes[i]));
+    const unsigned char* bytes = nullptr;
+    int len = 0;
+    if (dbus_message_iter_get_arg_type(iter) == DBUS_TYPE_BYTE) {
+        dbus_message_iter_get_fixed_array(iter, &bytes, &len);
     }
-    return holder_array;
+    return Holder::create_byte_array(bytes, len);
 }
 
 Holder Message::_extract_array(DBusMessageIter* iter) {
     Holder holder_array = Holder::create<std::vector<Holder>>();
     _indent += 1;
-    int current_type = dbus_message_iter_get_arg_type(iter);
-    if (current_type == DBUS_TYPE_BYTE) {
-        holder_array = _extract_bytearray(iter);
-    } else {
-        while ((current_type = dbus_message_iter_get_arg_type(iter)) != DBUS_TYPE_INVALID) {
-            Holder h = _extract_generic(iter);
-            if (h.type() != Holder::NONE) {
-                holder_array.array_append(h);
-            }
-            dbus_message_iter_next(iter);
+    int current_type;
+    while ((current_type = dbus_message_iter_get_arg_type(iter)) != DBUS_TYPE_INVALID) {
+        Holder h = _extract_generic(iter);
+        if (h.type() != Holder::NONE) {
+            holder_array.array_append(h);
         }
+        dbus_message_iter_next(iter);
     }
     _indent -= 1;
     return holder_array;
@@ -464,7 +517,7 @@ Holder Message::_extract_dict(DBusMessageIter* iter) {
             holder_initialized = true;
         }
 
-        holder_dict.dict_append(key.type(), key.get_contents(), value);
+        holder_dict.dict_append(std::move(key), std::move(value));
         dbus_message_iter_next(iter);
     }
     _indent -= 1;
@@ -541,6 +594,8 @@ Holder Message::_extract_generic(DBusMessageIter* iter) {
                 int sub_type = dbus_message_iter_get_arg_type(&sub);
                 if (sub_type == DBUS_TYPE_DICT_ENTRY) {
                     return _extract_dict(&sub);
+                } else if (dbus_message_iter_get_element_type(iter) == DBUS_TYPE_BYTE) {
+                    return _extract_bytearray(&sub);
                 } else {
                     return _extract_array(&sub);
                 }
@@ -598,6 +653,13 @@ Message Message::create_signal(const std::string& path, const std::string& inter
     return Message::from_acquired(msg_signal);
 }
 
+Message Message::copy() const {
+    if (!is_valid()) return Message();
+
+    // The copy is unlocked and has no serial, so it can be sent even if the original already was.
+    return Message::from_acquired(dbus_message_copy(_msg));
+}
+
 void Message::_invalidate() {
     _unique_id = INVALID_UNIQUE_ID;
     _msg = nullptr;
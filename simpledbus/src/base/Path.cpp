@@ -83,7 +83,8 @@ bool PathUtils::is_descendant(const std::string& base, const std::string& path)
         return true;
     }
 
-    return path.rfind(base) == 0;
+    // The match must end on a segment boundary, otherwise "/a/b" would own "/a/bc".
+    return path.size() > base.size() && path.compare(0, base.size(), base) == 0 && path[base.size()] == '/';
 }
 
 bool PathUtils::is_ascendant(const std::string& base, const std::string& path) {
@@ -131,7 +132,12 @@ bool PathUtils::is_parent(const std::string& base, const std::string& path) {
 }
 
 std::string PathUtils::next_child(const std::string& base, const std::string& path) {
-    return fetch_elements(path, count_elements(base) + 1);
+    // Only the segment right after the base is needed, so there is no point in splitting the whole path.
+    const size_t start = base == "/" ? 1 : base.length() + 1;
+    if (start > path.length()) {
+        return path;
+    }
+    return path.substr(0, path.find('/', start));
 }
 
 std::string PathUtils::next_child_strip(const std::string& base, const std::string& path) {
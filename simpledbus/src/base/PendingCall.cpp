@@ -0,0 +1,150 @@
+#include <simpledbus/base/Exceptions.h>
+#include <simpledbus/base/PendingCall.h>
+
+#include <stdexcept>
+
+using namespace SimpleDBus;
+
+PendingCall::PendingCall(const Message& msg, Callback callback, std::chrono::steady_clock::duration timeout)
+    : _deadline(std::chrono::steady_clock::now() + timeout),
+      _description(msg.to_string()),
+      _callback(std::move(callback)) {}
+
+PendingCall::~PendingCall() {
+    if (_pending) {
+        dbus_pending_call_cancel(_pending);
+        dbus_pending_call_unref(_pending);
+    }
+}
+
+bool PendingCall::is_pending() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _state == State::PENDING;
+}
+
+std::chrono::steady_clock::time_point PendingCall::deadline() const { return _deadline; }
+
+bool PendingCall::wait_for(std::chrono::steady_clock::duration timeout) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    return _cv.wait_for(lock, timeout, [this] { return _finished; });
+}
+
+Message PendingCall::get() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    if (!_cv.wait_until(lock, _deadline, [this] { return _state != State::PENDING; })) {
+        lock.unlock();
+        resolve(State::TIMED_OUT);
+        lock.lock();
+    }
+
+    switch (_state) {
+        case State::TIMED_OUT:
+            throw std::runtime_error("D-Bus call timed out");
+        case State::CANCELLED:
+            throw std::runtime_error("D-Bus call cancelled");
+        default:
+            break;
+    }
+
+    if (!_reply.is_valid()) {
+        throw std::runtime_error("Received null reply from D-Bus");
+    }
+
+    if (_reply.get_type() == Message::Type::ERROR) {
+        const char* err_name = dbus_message_get_error_name(_reply);
+        const char* err_text = "No error detail provided";
+
+        // Try to extract the error string argument if it exists
+        dbus_message_get_args(_reply, nullptr, DBUS_TYPE_STRING, &err_text, DBUS_TYPE_INVALID);
+        throw Exception::SendFailed(err_name, err_text, _description);
+    }
+
+    return std::move(_reply);
+}
+
+void PendingCall::cancel() { resolve(State::CANCELLED); }
+
+void PendingCall::attach(DBusPendingCall* pending) {
+    bool attached = false;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_state == State::PENDING) {
+            // Keep our own reference while the notifier is installed, as a concurrent cancel() releases _pending.
+            _pending = dbus_pending_call_ref(pending);
+            attached = true;
+        }
+    }
+
+    if (attached) {
+        // libdbus keeps this object alive until the pending call is released.
+        auto* self = new std::shared_ptr<PendingCall>(shared_from_this());
+        dbus_pending_call_set_notify(pending, &PendingCall::static_notify, self, &PendingCall::static_free);
+
+        // The reply might have been processed before the notifier was installed.
+        if (dbus_pending_call_get_completed(pending)) {
+            complete();
+        }
+    } else {
+        // Cancelled or expired before the call was even queued.
+        dbus_pending_call_cancel(pending);
+    }
+    dbus_pending_call_unref(pending);
+}
+
+void PendingCall::complete() {
+    auto self = shared_from_this();
+
+    DBusPendingCall* pending = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_state != State::PENDING || !_pending) return;
+
+        DBusMessage* reply = dbus_pending_call_steal_reply(_pending);
+        if (!reply) return;
+
+        _reply = Message::from_acquired(reply);
+        _state = State::COMPLETED;
+        std::swap(pending, _pending);
+    }
+    dbus_pending_call_unref(pending);
+
+    finish();
+}
+
+void PendingCall::resolve(State state) {
+    auto self = shared_from_this();
+
+    DBusPendingCall* pending = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_state != State::PENDING) return;
+
+        _state = state;
+        std::swap(pending, _pending);
+    }
+    if (pending) {
+        dbus_pending_call_cancel(pending);
+        dbus_pending_call_unref(pending);
+    }
+
+    finish();
+}
+
+void PendingCall::finish() {
+    // Wake get() callers first, the callback itself might be one of them.
+    _cv.notify_all();
+    if (_callback) _callback(*this);
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _finished = true;
+    }
+    _cv.notify_all();
+}
+
+void PendingCall::static_notify(DBusPendingCall* pending, void* user_data) {
+    auto self = *static_cast<std::shared_ptr<PendingCall>*>(user_data);
+    self->complete();
+}
+
+void PendingCall::static_free(void* user_data) { delete static_cast<std::shared_ptr<PendingCall>*>(user_data); }
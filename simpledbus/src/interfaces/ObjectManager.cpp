@@ -27,6 +27,12 @@ Holder ObjectManager::GetManagedObjects() {
     return reply_msg.extract();
 }
 
+std::map<ObjectPath, RawValue> ObjectManager::GetManagedObjectsDeferred() {
+    Message query_msg = Message::create_method_call(_bus_name, _path, _interface_name, "GetManagedObjects");
+    Message reply_msg = _conn->send_with_reply_and_block(query_msg);
+    return reply_msg.extract<std::map<ObjectPath, RawValue>>();
+}
+
 // NOTE to future Kevin:
 // There is a chance to further simplify the logic handed over to Proxy by moving the ownership of
 // interfaces into this class and have it also manage all the routing of signals and method calls.
@@ -23,23 +23,15 @@ Properties::~Properties() = default;
 
 Holder Properties::Get(const std::string& interface_name, const std::string& property_name) {
     Message query_msg = Message::create_method_call(_bus_name, _path, "org.freedesktop.DBus.Properties", "Get");
-
-    Holder h_interface = Holder::create<std::string>(interface_name);
-    query_msg.append_argument(h_interface, "s");
-
-    Holder h_name = Holder::create<std::string>(property_name);
-    query_msg.append_argument(h_name, "s");
+    query_msg.append(interface_name, property_name);
 
     Message reply_msg = _conn->send_with_reply_and_block(query_msg);
-    Holder result = reply_msg.extract();
-    return result;
+    return reply_msg.extract<Holder>();
 }
 
 Holder Properties::GetAll(const std::string& interface_name) {
     Message query_msg = Message::create_method_call(_bus_name, _path, "org.freedesktop.DBus.Properties", "GetAll");
-
-    Holder h_interface = Holder::create<std::string>(interface_name);
-    query_msg.append_argument(h_interface, "s");
+    query_msg.append(interface_name);
 
     Message reply_msg = _conn->send_with_reply_and_block(query_msg);
     Holder result = reply_msg.extract();
@@ -48,14 +40,7 @@ Holder Properties::GetAll(const std::string& interface_name) {
 
 void Properties::Set(const std::string& interface_name, const std::string& property_name, const Holder& value) {
     Message query_msg = Message::create_method_call(_bus_name, _path, "org.freedesktop.DBus.Properties", "Set");
-
-    Holder h_interface = Holder::create<std::string>(interface_name);
-    query_msg.append_argument(h_interface, "s");
-
-    Holder h_name = Holder::create<std::string>(property_name);
-    query_msg.append_argument(h_name, "s");
-
-    query_msg.append_argument(value, "v");
+    query_msg.append(interface_name, property_name, value);
 
     _conn->send_with_reply_and_block(query_msg);
 }
@@ -116,7 +101,7 @@ void Properties::message_handle(Message& msg) {
 
         std::shared_ptr<Interface> interface = proxy()->interface_get(iface_name);
 
-        bool property_exists = interface->property_exists(property_name);
+        bool property_exists = interface->property_exported(property_name);
 
         if (property_exists) {
             Holder property_value = interface->handle_property_get(property_name);
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace Bench {
+
+void event_loop();
+void fixture();
+void holder();
+void marshal();
+void path_index();
+void proxy_tree();
+
+/**
+ * Record a figure for the JSON report written by `--json <file>`. Benchmarks still print their own summary line.
+ */
+void report(const std::string& bench, const std::string& metric, double value);
+
+template <typename F>
+double time_ms(F&& f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Nearest-rank percentile, p in [0, 1]. Sorts the samples in place.
+inline double percentile(std::vector<double>& samples, double p) {
+    if (samples.empty()) return 0;
+    std::sort(samples.begin(), samples.end());
+    size_t rank = static_cast<size_t>(p * (samples.size() - 1) + 0.5);
+    return samples[std::min(rank, samples.size() - 1)];
+}
+
+}  // namespace Bench
@@ -0,0 +1,141 @@
+// Compares the event driven dispatch loop against the legacy read_write_dispatch() + sleep polling loop.
+// Run on a session bus, e.g. `dbus-run-session -- ./simpledbus_bench`.
+
+#include "Bench.h"
+
+#include <simpledbus/base/Connection.h>
+#include <simpledbus/base/Holder.h>
+#include <simpledbus/base/Message.h>
+
+#include <time.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr const char* BENCH_PATH = "/simpledbus/bench";
+constexpr const char* BENCH_INTERFACE = "simpledbus.bench";
+constexpr int NUM_SIGNALS = 2000;
+
+int64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+double thread_cpu_ms() {
+    timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+struct Result {
+    double idle_cpu_ms = 0;
+    double busy_cpu_ms = 0;
+    double latency_avg_us = 0;
+    double latency_p99_us = 0;
+    size_t received = 0;
+};
+
+Result run(bool event_driven) {
+    SimpleDBus::Connection conn(DBUS_BUS_SESSION);
+    conn.init();
+
+    std::mutex latencies_mutex;
+    std::vector<double> latencies;
+    conn.register_object_path(BENCH_PATH, [&](SimpleDBus::Message& msg) {
+        int64_t sent = msg.extract().get<int64_t>();
+        std::lock_guard<std::mutex> lock(latencies_mutex);
+        latencies.push_back((now_ns() - sent) / 1e3);
+    });
+    conn.add_match(std::string("type='signal',interface='") + BENCH_INTERFACE + "'");
+
+    std::atomic_bool active = true;
+    std::atomic_bool busy = false;
+    double idle_cpu = 0;
+    double busy_cpu = 0;
+
+    std::thread loop([&]() {
+        double start = thread_cpu_ms();
+        bool was_busy = false;
+        while (active) {
+            if (busy && !was_busy) {
+                idle_cpu = thread_cpu_ms() - start;
+                start = thread_cpu_ms();
+                was_busy = true;
+            }
+            if (event_driven) {
+                conn.event_loop_iterate(100ms);
+            } else {
+                conn.read_write_dispatch();
+                std::this_thread::sleep_for(100us);
+            }
+        }
+        busy_cpu = thread_cpu_ms() - start;
+    });
+
+    // Idle phase: nothing on the bus, this is the cost of simply waiting.
+    std::this_thread::sleep_for(1s);
+    busy = true;
+    std::this_thread::sleep_for(10ms);
+
+    // Busy phase: a separate private connection emits timestamped signals.
+    DBusConnection* sender = dbus_bus_get_private(DBUS_BUS_SESSION, nullptr);
+    for (int i = 0; i < NUM_SIGNALS; i++) {
+        DBusMessage* signal = dbus_message_new_signal(BENCH_PATH, BENCH_INTERFACE, "Tick");
+        dbus_int64_t timestamp = now_ns();
+        dbus_message_append_args(signal, DBUS_TYPE_INT64, &timestamp, DBUS_TYPE_INVALID);
+        dbus_connection_send(sender, signal, nullptr);
+        dbus_connection_flush(sender);
+        dbus_message_unref(signal);
+        std::this_thread::sleep_for(250us);
+    }
+    std::this_thread::sleep_for(200ms);
+
+    active = false;
+    conn.event_loop_wakeup();
+    loop.join();
+
+    dbus_connection_close(sender);
+    dbus_connection_unref(sender);
+    conn.unregister_object_path(BENCH_PATH);
+
+    Result result;
+    result.idle_cpu_ms = idle_cpu;
+    result.busy_cpu_ms = busy_cpu;
+    std::sort(latencies.begin(), latencies.end());
+    result.received = latencies.size();
+    if (!latencies.empty()) {
+        double sum = 0;
+        for (double l : latencies) sum += l;
+        result.latency_avg_us = sum / latencies.size();
+        result.latency_p99_us = latencies[std::min(latencies.size() - 1, latencies.size() * 99 / 100)];
+    }
+    return result;
+}
+
+void print(const std::string& name, const Result& result) {
+    Bench::report(name, "idle_cpu_ms", result.idle_cpu_ms);
+    Bench::report(name, "busy_cpu_ms", result.busy_cpu_ms);
+    Bench::report(name, "received", result.received);
+    Bench::report(name, "latency_avg_us", result.latency_avg_us);
+    Bench::report(name, "latency_p99_us", result.latency_p99_us);
+
+    std::cout << name << ": idle_cpu=" << result.idle_cpu_ms << "ms/s busy_cpu=" << result.busy_cpu_ms
+              << "ms received=" << result.received << "/" << NUM_SIGNALS << " latency_avg=" << result.latency_avg_us
+              << "us latency_p99=" << result.latency_p99_us << "us" << std::endl;
+}
+
+}  // namespace
+
+void Bench::event_loop() {
+    print("polling", run(false));
+    print("event_loop", run(true));
+}
@@ -0,0 +1,169 @@
+// Round trips against the Python dbus_next fixture used by the tests: call latency, pipelined throughput and
+// signal fan-in. Run on a session bus, e.g. `dbus-run-session -- ./simpledbus_bench fixture`.
+
+#include "Bench.h"
+#include "../src/helpers/PythonRunner.h"
+
+#include <simpledbus/base/Connection.h>
+#include <simpledbus/base/Message.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace SimpleDBus;
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr const char* FIXTURE_NAME = "simpledbus.tester.python";
+constexpr const char* FIXTURE_PATH = "/bench";
+constexpr const char* FIXTURE_INTERFACE = "simpledbus.tester.bench";
+
+constexpr int NUM_LATENCY_CALLS = 2000;
+constexpr int NUM_THROUGHPUT_CALLS = 20000;
+constexpr size_t MAX_IN_FLIGHT = 64;
+constexpr uint32_t NUM_TICKS = 20000;
+
+Message ping_call(uint32_t value) {
+    Message msg = Message::create_method_call(FIXTURE_NAME, FIXTURE_PATH, FIXTURE_INTERFACE, "Ping");
+    msg.append(value);
+    return msg;
+}
+
+bool fixture_available(Connection& conn) {
+    Message msg = Message::create_method_call("org.freedesktop.DBus", "/org/freedesktop/DBus", "org.freedesktop.DBus",
+                                              "NameHasOwner");
+    msg.append(std::string(FIXTURE_NAME));
+    try {
+        return conn.send_with_reply_and_block(msg).extract<bool>();
+    } catch (const std::exception& e) {
+        return false;
+    }
+}
+
+void latency(Connection& conn) {
+    std::vector<double> samples;
+    samples.reserve(NUM_LATENCY_CALLS);
+    for (int i = 0; i < NUM_LATENCY_CALLS; i++) {
+        Message msg = ping_call(i);
+        samples.push_back(1e3 * Bench::time_ms([&]() { conn.send_with_reply_and_block(msg); }));
+    }
+
+    double p50 = Bench::percentile(samples, 0.50);
+    double p99 = Bench::percentile(samples, 0.99);
+    Bench::report("fixture", "call_p50_us", p50);
+    Bench::report("fixture", "call_p99_us", p99);
+    std::cout << "fixture: calls=" << NUM_LATENCY_CALLS << " call_p50=" << p50 << "us call_p99=" << p99 << "us"
+              << std::endl;
+}
+
+void throughput(Connection& conn) {
+    size_t failed = 0;
+    double elapsed_ms = Bench::time_ms([&]() {
+        std::deque<std::shared_ptr<PendingCall>> in_flight;
+        for (int i = 0; i < NUM_THROUGHPUT_CALLS; i++) {
+            if (in_flight.size() == MAX_IN_FLIGHT) {
+                try {
+                    in_flight.front()->get();
+                } catch (const std::exception& e) {
+                    failed++;
+                }
+                in_flight.pop_front();
+            }
+            Message msg = ping_call(i);
+            in_flight.push_back(conn.send_async(msg));
+        }
+        for (auto& call : in_flight) {
+            try {
+                call->get();
+            } catch (const std::exception& e) {
+                failed++;
+            }
+        }
+    });
+
+    double rate = NUM_THROUGHPUT_CALLS / (elapsed_ms / 1e3);
+    Bench::report("fixture", "calls_per_sec", rate);
+    Bench::report("fixture", "calls_failed", failed);
+    std::cout << "fixture: calls=" << NUM_THROUGHPUT_CALLS << " in_flight=" << MAX_IN_FLIGHT << " rate=" << rate
+              << "/s failed=" << failed << std::endl;
+}
+
+void fan_in(Connection& conn) {
+    std::mutex mutex;
+    std::condition_variable cv;
+    uint32_t received = 0;
+    std::chrono::steady_clock::time_point first;
+    std::chrono::steady_clock::time_point last;
+
+    conn.register_object_path(FIXTURE_PATH, [&](Message& msg) {
+        if (!msg.is_signal(FIXTURE_INTERFACE, "Tick")) return;
+
+        std::scoped_lock lock(mutex);
+        last = std::chrono::steady_clock::now();
+        if (received++ == 0) first = last;
+        if (received == NUM_TICKS) cv.notify_all();
+    });
+    std::string rule = std::string("type='signal',sender='") + FIXTURE_NAME + "',interface='" + FIXTURE_INTERFACE + "'";
+    conn.add_match(rule);
+
+    Message msg = Message::create_method_call(FIXTURE_NAME, FIXTURE_PATH, FIXTURE_INTERFACE, "EmitTicks");
+    msg.append(NUM_TICKS);
+    conn.send_with_reply_and_block(msg);
+
+    double rate = 0;
+    {
+        std::unique_lock lock(mutex);
+        cv.wait_for(lock, 30s, [&]() { return received == NUM_TICKS; });
+        double elapsed = std::chrono::duration<double>(last - first).count();
+        if (received > 1 && elapsed > 0) rate = (received - 1) / elapsed;
+    }
+
+    conn.remove_match(rule);
+    conn.unregister_object_path(FIXTURE_PATH);
+
+    Bench::report("fixture", "signals_received", received);
+    Bench::report("fixture", "signals_per_sec", rate);
+    std::cout << "fixture: signals=" << received << "/" << NUM_TICKS << " rate=" << rate << "/s" << std::endl;
+}
+
+}  // namespace
+
+void Bench::fixture() {
+    PythonRunner runner("test_fixture.py");
+    runner.init();
+
+    Connection conn(DBUS_BUS_SESSION);
+    conn.init();
+
+    std::atomic_bool active = true;
+    std::thread loop([&]() {
+        while (active) {
+            conn.event_loop_iterate(100ms);
+        }
+    });
+
+    if (fixture_available(conn)) {
+        latency(conn);
+        throughput(conn);
+        fan_in(conn);
+    } else {
+        std::cout << "fixture: " << FIXTURE_NAME << " is not on the bus, skipping" << std::endl;
+    }
+
+    active = false;
+    conn.event_loop_wakeup();
+    loop.join();
+    conn.uninit();
+
+    runner.uninit();
+}
@@ -0,0 +1,105 @@
+// Measures Holder footprint and the cost of building, copying and decoding a GetManagedObjects-sized tree.
+
+#include "Bench.h"
+
+#include <simpledbus/base/Holder.h>
+#include <simpledbus/base/Message.h>
+
+#include <iostream>
+#include <map>
+#include <string>
+
+using namespace SimpleDBus;
+
+namespace {
+
+constexpr int NUM_DEVICES = 2000;
+constexpr int NUM_ITERATIONS = 5;
+
+// Roughly what BlueZ reports for a single org.bluez.Device1 object.
+Holder device_properties(int index) {
+    Holder props = Holder::create<std::map<std::string, Holder>>();
+    props.dict_append(Holder::STRING, "Address", Holder::create<std::string>("00:11:22:33:44:" + std::to_string(index % 100)));
+    props.dict_append(Holder::STRING, "AddressType", Holder::create<std::string>("random"));
+    props.dict_append(Holder::STRING, "Name", Holder::create<std::string>("Device " + std::to_string(index)));
+    props.dict_append(Holder::STRING, "Alias", Holder::create<std::string>("Device " + std::to_string(index)));
+    props.dict_append(Holder::STRING, "Paired", Holder::create<bool>(false));
+    props.dict_append(Holder::STRING, "Bonded", Holder::create<bool>(false));
+    props.dict_append(Holder::STRING, "Trusted", Holder::create<bool>(false));
+    props.dict_append(Holder::STRING, "Blocked", Holder::create<bool>(false));
+    props.dict_append(Holder::STRING, "Connected", Holder::create<bool>(false));
+    props.dict_append(Holder::STRING, "ServicesResolved", Holder::create<bool>(false));
+    props.dict_append(Holder::STRING, "RSSI", Holder::create<int16_t>(-60));
+    props.dict_append(Holder::STRING, "TxPower", Holder::create<int16_t>(4));
+    props.dict_append(Holder::STRING, "Adapter", Holder::create<ObjectPath>("/org/bluez/hci0"));
+
+    Holder uuids = Holder::create<std::vector<Holder>>();
+    uuids.array_append(Holder::create<std::string>("0000180f-0000-1000-8000-00805f9b34fb"));
+    uuids.array_append(Holder::create<std::string>("0000180a-0000-1000-8000-00805f9b34fb"));
+    props.dict_append(Holder::STRING, "UUIDs", uuids);
+
+    Holder manufacturer_data = Holder::create<std::map<uint16_t, Holder>>();
+    manufacturer_data.dict_append(Holder::UINT16, static_cast<uint16_t>(0x004C),
+                                  Holder::create<kvn::bytearray>(kvn::bytearray(24)));
+    props.dict_append(Holder::STRING, "ManufacturerData", manufacturer_data);
+    return props;
+}
+
+Holder managed_objects() {
+    Holder objects = Holder::create<std::map<ObjectPath, Holder>>();
+    for (int i = 0; i < NUM_DEVICES; i++) {
+        Holder interfaces = Holder::create<std::map<std::string, Holder>>();
+        interfaces.dict_append(Holder::STRING, "org.bluez.Device1", device_properties(i));
+        interfaces.dict_append(Holder::STRING, "org.freedesktop.DBus.Properties",
+                               Holder::create<std::map<std::string, Holder>>());
+        objects.dict_append(Holder::OBJ_PATH, "/org/bluez/hci0/dev_" + std::to_string(i), interfaces);
+    }
+    return objects;
+}
+
+}  // namespace
+
+void Bench::holder() {
+    std::cout << "holder: sizeof(Holder)=" << sizeof(Holder) << " bytes" << std::endl;
+
+    double build_ms = 0;
+    double copy_ms = 0;
+    double decode_ms = 0;
+    double lookup_ms = 0;
+    size_t found = 0;
+
+    for (int i = 0; i < NUM_ITERATIONS; i++) {
+        Holder objects;
+        build_ms += time_ms([&]() { objects = managed_objects(); });
+
+        copy_ms += time_ms([&]() {
+            Holder copy = objects;
+            found += copy == objects;
+        });
+
+        Message msg = Message::create_method_call("org.bluez", "/", "org.freedesktop.DBus.ObjectManager",
+                                                  "GetManagedObjects");
+        msg.append_argument(objects, "a{oa{sa{sv}}}");
+        decode_ms += time_ms([&]() {
+            Holder decoded = msg.extract();
+            found += decoded.get<std::map<ObjectPath, Holder>>().size();
+        });
+
+        lookup_ms += time_ms([&]() {
+            for (auto& [path, interfaces] : objects.get<std::map<ObjectPath, Holder>>()) {
+                auto props = interfaces.get<std::map<std::string, Holder>>()["org.bluez.Device1"];
+                found += props.get<std::map<std::string, Holder>>()["RSSI"].get<int16_t>() != 0;
+            }
+        });
+    }
+
+    report("holder", "sizeof_bytes", sizeof(Holder));
+    report("holder", "build_ms", build_ms / NUM_ITERATIONS);
+    report("holder", "copy_ms", copy_ms / NUM_ITERATIONS);
+    report("holder", "extract_ms", decode_ms / NUM_ITERATIONS);
+    report("holder", "lookup_ms", lookup_ms / NUM_ITERATIONS);
+
+    std::cout << "holder: devices=" << NUM_DEVICES << " build=" << build_ms / NUM_ITERATIONS
+              << "ms copy=" << copy_ms / NUM_ITERATIONS << "ms decode=" << decode_ms / NUM_ITERATIONS
+              << "ms lookup=" << lookup_ms / NUM_ITERATIONS << "ms (checksum " << found << ")" << std::endl;
+}
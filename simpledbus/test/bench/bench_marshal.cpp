@@ -0,0 +1,91 @@
+// Compares building and decoding a GattCharacteristic1.WriteValue call through Holder trees against the
+// typed append()/extract() path.
+
+#include "Bench.h"
+
+#include <simpledbus/base/Holder.h>
+#include <simpledbus/base/Message.h>
+
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace SimpleDBus;
+
+namespace {
+
+constexpr int NUM_MESSAGES = 20000;
+constexpr size_t PAYLOAD_SIZE = 244;
+
+Message write_value_call() {
+    return Message::create_method_call("org.bluez", "/org/bluez/hci0/dev_00_11_22_33_44_55/service0001/char0002",
+                                       "org.bluez.GattCharacteristic1", "WriteValue");
+}
+
+// Creating the message dominates otherwise, so it is kept out of the timed section.
+std::vector<Message> write_value_calls() {
+    std::vector<Message> messages;
+    messages.reserve(NUM_MESSAGES);
+    for (int i = 0; i < NUM_MESSAGES; i++) {
+        messages.push_back(write_value_call());
+    }
+    return messages;
+}
+
+}  // namespace
+
+void Bench::marshal() {
+    const kvn::bytearray payload(PAYLOAD_SIZE);
+    size_t checksum = 0;
+
+    std::vector<Message> holder_messages = write_value_calls();
+    double holder_append_ms = time_ms([&]() {
+        for (auto& msg : holder_messages) {
+            Holder options = Holder::create<std::map<std::string, Holder>>();
+            options.dict_append(Holder::STRING, "type", Holder::create<std::string>("command"));
+
+            msg.append_argument(Holder::create<kvn::bytearray>(payload), "ay");
+            msg.append_argument(options, "a{sv}");
+            checksum += msg.is_valid();
+        }
+    });
+
+    std::vector<Message> typed_messages = write_value_calls();
+    double typed_append_ms = time_ms([&]() {
+        for (auto& msg : typed_messages) {
+            std::map<std::string, Holder> options;
+            options["type"] = Holder::create<std::string>("command");
+
+            msg.append(payload, options);
+            checksum += msg.is_valid();
+        }
+    });
+
+    Message msg = write_value_call();
+    msg.append(payload, std::map<std::string, Holder>());
+
+    double holder_extract_ms = time_ms([&]() {
+        for (int i = 0; i < NUM_MESSAGES; i++) {
+            msg.extract_reset();
+            Holder value = msg.extract();
+            checksum += value.get<kvn::bytearray>().size();
+            msg.extract_next();
+        }
+    });
+
+    double typed_extract_ms = time_ms([&]() {
+        for (int i = 0; i < NUM_MESSAGES; i++) {
+            checksum += msg.extract<kvn::bytearray>().size();
+        }
+    });
+
+    report("marshal", "append_holder_ms", holder_append_ms);
+    report("marshal", "append_typed_ms", typed_append_ms);
+    report("marshal", "extract_holder_ms", holder_extract_ms);
+    report("marshal", "extract_typed_ms", typed_extract_ms);
+
+    std::cout << "marshal: messages=" << NUM_MESSAGES << " append(holder)=" << holder_append_ms
+              << "ms append(typed)=" << typed_append_ms << "ms extract(holder)=" << holder_extract_ms
+              << "ms extract(typed)=" << typed_extract_ms << "ms (checksum " << checksum << ")" << std::endl;
+}
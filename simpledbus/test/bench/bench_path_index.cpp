@@ -0,0 +1,95 @@
+// Measures object path handling for a BlueZ-sized object tree: proxy insertion, update and removal,
+// and the per-message handler lookup done by Connection. The hash map lookup is the previous routing
+// scheme and is kept as a reference.
+
+#include "Bench.h"
+
+#include <simpledbus/advanced/Proxy.h>
+#include <simpledbus/base/PathIndex.h>
+
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace SimpleDBus;
+
+namespace {
+
+constexpr int NUM_DEVICES = 400;
+constexpr int NUM_SERVICES = 3;
+constexpr int NUM_CHARACTERISTICS = 7;
+constexpr int NUM_LOOKUPS = 20;
+
+// One device object plus its services and characteristics, 25 objects per device.
+std::vector<std::string> object_paths() {
+    std::vector<std::string> paths;
+    char buffer[96];
+    for (int d = 0; d < NUM_DEVICES; d++) {
+        std::snprintf(buffer, sizeof(buffer), "/org/bluez/hci0/dev_00_11_22_33_%02X_%02X", d / 256, d % 256);
+        std::string device = buffer;
+        paths.push_back(device);
+        for (int s = 0; s < NUM_SERVICES; s++) {
+            std::snprintf(buffer, sizeof(buffer), "%s/service%04x", device.c_str(), s);
+            std::string service = buffer;
+            paths.push_back(service);
+            for (int c = 0; c < NUM_CHARACTERISTICS; c++) {
+                std::snprintf(buffer, sizeof(buffer), "%s/char%04x", service.c_str(), c);
+                paths.push_back(buffer);
+            }
+        }
+    }
+    return paths;
+}
+
+}  // namespace
+
+void Bench::path_index() {
+    const std::vector<std::string> paths = object_paths();
+
+    auto root = std::make_shared<Proxy>(nullptr, "", "/");
+    double insert_ms = time_ms([&]() {
+        for (const auto& path : paths) root->path_add(path, Holder());
+    });
+    double update_ms = time_ms([&]() {
+        for (const auto& path : paths) root->path_add(path, Holder());
+    });
+
+    PathIndex<int> index;
+    std::unordered_map<std::string, int> map;
+    for (size_t i = 0; i < paths.size(); i++) {
+        index.insert(paths[i], static_cast<int>(i));
+        map.emplace(paths[i], static_cast<int>(i));
+    }
+
+    // Messages only carry a C string, so the map lookup has to build a std::string first.
+    size_t found = 0;
+    double index_ms = time_ms([&]() {
+        for (int i = 0; i < NUM_LOOKUPS; i++) {
+            for (const auto& path : paths) found += index.find(path.c_str()) != nullptr;
+        }
+    });
+    double map_ms = time_ms([&]() {
+        for (int i = 0; i < NUM_LOOKUPS; i++) {
+            for (const auto& path : paths) found += map.find(std::string(path.c_str())) != map.end();
+        }
+    });
+
+    double remove_ms = time_ms([&]() {
+        for (auto it = paths.rbegin(); it != paths.rend(); ++it) {
+            root->path_remove(*it, Holder::create<std::vector<Holder>>());
+        }
+    });
+
+    const double lookups = static_cast<double>(NUM_LOOKUPS * paths.size());
+    report("path_index", "insert_ms", insert_ms);
+    report("path_index", "update_ms", update_ms);
+    report("path_index", "remove_ms", remove_ms);
+    report("path_index", "route_index_ns", index_ms * 1e6 / lookups);
+    report("path_index", "route_map_ns", map_ms * 1e6 / lookups);
+
+    std::cout << "path_index: objects=" << paths.size() << " insert=" << insert_ms << "ms update=" << update_ms
+              << "ms remove=" << remove_ms << "ms route(index)=" << index_ms * 1e6 / lookups
+              << "ns route(map)=" << map_ms * 1e6 / lookups << "ns (checksum " << found << ")" << std::endl;
+}
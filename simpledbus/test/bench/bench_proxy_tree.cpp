@@ -0,0 +1,218 @@
+// Startup cost of a large BlueZ cache: turning a GetManagedObjects reply for thousands of bonded devices,
+// GATT attributes included, into a proxy tree. Compares building every proxy up front against deferring
+// them until first access, in time and resident memory.
+
+#include "Bench.h"
+
+#include <simpledbus/advanced/Interface.h>
+#include <simpledbus/advanced/InterfaceRegistry.h>
+#include <simpledbus/advanced/Proxy.h>
+#include <simpledbus/base/Message.h>
+
+#include <malloc.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace SimpleDBus;
+
+namespace {
+
+constexpr int NUM_DEVICES = 5000;
+constexpr int NUM_SERVICES = 3;
+constexpr int NUM_CHARACTERISTICS = 5;
+
+// Same shape as the BlueZ interfaces, so that building them costs what it does in SimpleBluez.
+class BenchDevice1 : public Interface {
+  public:
+    BenchDevice1(std::shared_ptr<Connection> conn, std::shared_ptr<Proxy> proxy)
+        : Interface(conn, proxy, "bench.Device1") {}
+
+    Property<int16_t>& RSSI = property<int16_t>("RSSI");
+    Property<uint16_t>& Appearance = property<uint16_t>("Appearance");
+    Property<std::string>& Address = property<std::string>("Address");
+    Property<std::string>& AddressType = property<std::string>("AddressType");
+    Property<std::string>& Alias = property<std::string>("Alias");
+    Property<std::string>& Name = property<std::string>("Name");
+    Property<std::vector<std::string>>& UUIDs = property<std::vector<std::string>>("UUIDs");
+    Property<bool>& Paired = property<bool>("Paired");
+    Property<bool>& Bonded = property<bool>("Bonded");
+    Property<bool>& Trusted = property<bool>("Trusted");
+    Property<bool>& Connected = property<bool>("Connected");
+    Property<bool>& ServicesResolved = property<bool>("ServicesResolved");
+};
+
+class BenchGattService1 : public Interface {
+  public:
+    BenchGattService1(std::shared_ptr<Connection> conn, std::shared_ptr<Proxy> proxy)
+        : Interface(conn, proxy, "bench.GattService1") {}
+
+    Property<std::string>& UUID = property<std::string>("UUID");
+    Property<bool>& Primary = property<bool>("Primary");
+};
+
+class BenchGattCharacteristic1 : public Interface {
+  public:
+    BenchGattCharacteristic1(std::shared_ptr<Connection> conn, std::shared_ptr<Proxy> proxy)
+        : Interface(conn, proxy, "bench.GattCharacteristic1") {}
+
+    Property<std::string>& UUID = property<std::string>("UUID");
+    Property<std::vector<uint8_t>>& Value = property<std::vector<uint8_t>>("Value");
+    Property<std::vector<std::string>>& Flags = property<std::vector<std::string>>("Flags");
+    Property<bool>& Notifying = property<bool>("Notifying");
+};
+
+template <typename T>
+const AutoRegisterInterface<T> register_interface(const std::string& name) {
+    return AutoRegisterInterface<T>(name, [](std::shared_ptr<Connection> conn, std::shared_ptr<Proxy> proxy) {
+        return std::static_pointer_cast<Interface>(std::make_shared<T>(conn, proxy));
+    });
+}
+
+const auto registry_device = register_interface<BenchDevice1>("bench.Device1");
+const auto registry_service = register_interface<BenchGattService1>("bench.GattService1");
+const auto registry_characteristic = register_interface<BenchGattCharacteristic1>("bench.GattCharacteristic1");
+
+using Properties = std::map<std::string, Holder>;
+using Interfaces = std::map<std::string, Properties>;
+
+Holder strings(const std::vector<std::string>& values) {
+    Holder result = Holder::create<std::vector<Holder>>();
+    for (auto& value : values) result.array_append(Holder::create<std::string>(value));
+    return result;
+}
+
+std::string device_path(int d) {
+    char buffer[64];
+    std::snprintf(buffer, sizeof(buffer), "/org/bluez/hci0/dev_00_11_22_%02X_%02X_%02X", d >> 16, (d >> 8) & 0xFF,
+                  d & 0xFF);
+    return buffer;
+}
+
+Message managed_objects_reply() {
+    std::map<ObjectPath, Interfaces> objects;
+    objects[ObjectPath("/org/bluez")] = {};
+    objects[ObjectPath("/org/bluez/hci0")] = {};
+
+    char buffer[128];
+    for (int d = 0; d < NUM_DEVICES; d++) {
+        std::string device = device_path(d);
+        objects[ObjectPath(device)] = {{"bench.Device1",
+                                        {{"Address", Holder::create<std::string>(device.substr(20))},
+                                         {"AddressType", Holder::create<std::string>("public")},
+                                         {"Alias", Holder::create<std::string>("Bench device")},
+                                         {"Name", Holder::create<std::string>("Bench device")},
+                                         {"RSSI", Holder::create<int16_t>(-60)},
+                                         {"Appearance", Holder::create<uint16_t>(0)},
+                                         {"UUIDs", strings({"0000180f-0000-1000-8000-00805f9b34fb"})},
+                                         {"Paired", Holder::create<bool>(true)},
+                                         {"Bonded", Holder::create<bool>(true)},
+                                         {"Trusted", Holder::create<bool>(false)},
+                                         {"Connected", Holder::create<bool>(false)},
+                                         {"ServicesResolved", Holder::create<bool>(false)}}}};
+
+        for (int s = 0; s < NUM_SERVICES; s++) {
+            std::snprintf(buffer, sizeof(buffer), "%s/service%04x", device.c_str(), s);
+            std::string service = buffer;
+            objects[ObjectPath(service)] = {
+                {"bench.GattService1",
+                 {{"UUID", Holder::create<std::string>("0000180f-0000-1000-8000-00805f9b34fb")},
+                  {"Primary", Holder::create<bool>(true)}}}};
+
+            for (int c = 0; c < NUM_CHARACTERISTICS; c++) {
+                std::snprintf(buffer, sizeof(buffer), "%s/char%04x", service.c_str(), c);
+                objects[ObjectPath(buffer)] = {
+                    {"bench.GattCharacteristic1",
+                     {{"UUID", Holder::create<std::string>("00002a19-0000-1000-8000-00805f9b34fb")},
+                      {"Flags", strings({"read", "notify"})},
+                      {"Notifying", Holder::create<bool>(false)}}}};
+            }
+        }
+    }
+
+    Message msg = Message::create_method_call("org.bluez", "/", "org.freedesktop.DBus.ObjectManager",
+                                              "GetManagedObjects");
+    msg.append(objects);
+    return msg;
+}
+
+double resident_mb() {
+    size_t pages = 0;
+    size_t resident = 0;
+    std::ifstream("/proc/self/statm") >> pages >> resident;
+    return static_cast<double>(resident) * sysconf(_SC_PAGESIZE) / (1024.0 * 1024.0);
+}
+
+// Access pattern of the SimpleBLE backend right after startup: the adapter, then a single device.
+void first_access(const std::shared_ptr<Proxy>& root) {
+    auto adapter = root->path_get("/org")->path_get("/org/bluez")->path_get("/org/bluez/hci0");
+    adapter->path_get(device_path(NUM_DEVICES / 2))->children();
+}
+
+}  // namespace
+
+void Bench::proxy_tree() {
+    const size_t num_objects = 2 + NUM_DEVICES * (1 + NUM_SERVICES * (1 + NUM_CHARACTERISTICS));
+
+    double deferred_ms = 0;
+    double deferred_access_ms = 0;
+    double deferred_mb = 0;
+    {
+        Message reply = managed_objects_reply();
+        malloc_trim(0);
+        double before_mb = resident_mb();
+        auto root = std::make_shared<Proxy>(nullptr, "", "/");
+        deferred_ms = time_ms([&]() {
+            for (auto& [path, managed_interfaces] : reply.extract<std::map<ObjectPath, RawValue>>()) {
+                root->path_add_deferred(path, managed_interfaces);
+            }
+        });
+        deferred_mb = resident_mb() - before_mb;
+        deferred_access_ms = time_ms([&]() { first_access(root); });
+    }
+    malloc_trim(0);
+
+    double reply_mb = 0;
+    {
+        malloc_trim(0);
+        double before_mb = resident_mb();
+        Message reply = managed_objects_reply();
+        malloc_trim(0);
+        reply_mb = resident_mb() - before_mb;
+    }
+    malloc_trim(0);
+
+    double eager_ms = 0;
+    double eager_mb = 0;
+    {
+        Message reply = managed_objects_reply();
+        malloc_trim(0);
+        double before_mb = resident_mb();
+        auto root = std::make_shared<Proxy>(nullptr, "", "/");
+        eager_ms = time_ms([&]() {
+            Holder managed_objects = reply.extract();
+            for (auto& [path, managed_interfaces] : managed_objects.get<std::map<ObjectPath, Holder>>()) {
+                root->path_add(path, managed_interfaces);
+            }
+        });
+        eager_mb = resident_mb() - before_mb;
+    }
+
+    report("proxy_tree", "objects", num_objects);
+    report("proxy_tree", "reply_mb", reply_mb);
+    report("proxy_tree", "eager_ms", eager_ms);
+    report("proxy_tree", "eager_mb", eager_mb);
+    report("proxy_tree", "deferred_ms", deferred_ms);
+    report("proxy_tree", "deferred_mb", deferred_mb);
+    report("proxy_tree", "deferred_first_access_ms", deferred_access_ms);
+
+    std::cout << "proxy_tree: devices=" << NUM_DEVICES << " objects=" << num_objects << " reply=" << reply_mb
+              << "MB eager=" << eager_ms
+              << "ms/" << eager_mb << "MB deferred=" << deferred_ms << "ms/" << deferred_mb
+              << "MB first_access=" << deferred_access_ms << "ms" << std::endl;
+}
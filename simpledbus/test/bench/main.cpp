@@ -0,0 +1,70 @@
+#include "Bench.h"
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::map<std::string, std::map<std::string, double>> results;
+
+void write_json(std::ostream& out) {
+    out << "{";
+    for (auto bench = results.begin(); bench != results.end(); bench++) {
+        if (bench != results.begin()) out << ",";
+        out << "\n  \"" << bench->first << "\": {";
+        for (auto metric = bench->second.begin(); metric != bench->second.end(); metric++) {
+            if (metric != bench->second.begin()) out << ",";
+            out << "\n    \"" << metric->first << "\": " << metric->second;
+        }
+        out << "\n  }";
+    }
+    out << "\n}" << std::endl;
+}
+
+}  // namespace
+
+void Bench::report(const std::string& bench, const std::string& metric, double value) {
+    results[bench][metric] = value;
+}
+
+int main(int argc, char** argv) {
+    std::string json_path;
+    std::vector<std::string> names;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            json_path = argv[++i];
+        } else {
+            names.push_back(argv[i]);
+        }
+    }
+
+    // Run everything unless specific benchmarks are requested on the command line.
+    auto selected = [&names](const char* name) {
+        if (names.empty()) return true;
+        for (auto& n : names) {
+            if (n == name) return true;
+        }
+        return false;
+    };
+
+    if (selected("holder")) Bench::holder();
+    if (selected("marshal")) Bench::marshal();
+    if (selected("path_index")) Bench::path_index();
+    if (selected("proxy_tree")) Bench::proxy_tree();
+    if (selected("event_loop")) Bench::event_loop();
+    if (selected("fixture")) Bench::fixture();
+
+    if (!json_path.empty()) {
+        std::ofstream out(json_path);
+        if (!out) {
+            std::cerr << "Could not write " << json_path << std::endl;
+            return 1;
+        }
+        write_json(out);
+    }
+    return 0;
+}
@@ -1,4 +1,5 @@
 from interfaces.general import Emulator
 from interfaces.unit_message import MessageUnit
+from interfaces.unit_bench import BenchUnit
 
-__all__ = ["Emulator", "MessageUnit"]
+__all__ = ["Emulator", "MessageUnit", "BenchUnit"]
@@ -0,0 +1,33 @@
+from dbus_next.service import ServiceInterface, method, signal
+import asyncio
+
+
+class BenchUnit(ServiceInterface):
+    def __init__(self, bus):
+        self.bus = bus
+        super().__init__("simpledbus.tester.bench")
+
+    def export(self):
+        self.bus.export("/bench", self)
+
+    @method()
+    def Ping(self, value: "u") -> "u":
+        return value
+
+    @method()
+    def EmitTicks(self, count: "u"):
+        """
+        Emits the requested number of Tick signals as fast as the bus accepts them.
+        """
+        asyncio.ensure_future(self._emit_ticks(count))
+
+    @signal()
+    def Tick(self, value) -> "u":
+        return value
+
+    async def _emit_ticks(self, count):
+        for i in range(count):
+            self.Tick(i)
+            # Let the event loop flush the outgoing queue every now and then.
+            if i % 100 == 99:
+                await asyncio.sleep(0)
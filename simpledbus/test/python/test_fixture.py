@@ -2,7 +2,7 @@ import signal
 import asyncio
 import dbus_next
 from dbus_next.aio import MessageBus
-from interfaces import Emulator, MessageUnit
+from interfaces import Emulator, MessageUnit, BenchUnit
 
 active = True
 bus = None
@@ -22,10 +22,12 @@ async def setup():
     # Create object instances
     emulator = Emulator(bus)
     unit_message = MessageUnit(bus)
+    unit_bench = BenchUnit(bus)
 
     # Register object instances
     emulator.export()
     unit_message.export()
+    unit_bench.export()
     await bus.request_name("simpledbus.tester.python")
 
 
@@ -0,0 +1,350 @@
+#include <gtest/gtest.h>
+
+#include <simpledbus/Config.h>
+#include <simpledbus/base/Connection.h>
+#include <simpledbus/base/Exceptions.h>
+
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using namespace SimpleDBus;
+using namespace std::chrono_literals;
+
+// The connection calls methods on its own unique name, with a handler that answers them locally.
+class ConnectionTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        conn = new Connection(DBUS_BUS_SESSION);
+        conn->init();
+
+        conn->register_object_path("/simpledbus/echo", [this](Message& msg) {
+            if (msg.get_type() != Message::Type::METHOD_CALL) return;
+            if (msg.get_member() == "Ignore") return;
+
+            if (msg.get_member() == "Fail") {
+                Message error = Message::create_error(msg, "simpledbus.Error.Failed", "Requested failure");
+                conn->send(error);
+                return;
+            }
+
+            Message reply = Message::create_method_return(msg);
+            reply.append_argument(msg.extract(), "u");
+            conn->send(reply);
+        });
+
+        active = true;
+        loop = std::thread([this]() {
+            while (active) {
+                conn->event_loop_iterate(100ms);
+            }
+        });
+    }
+
+    void TearDown() override {
+        active = false;
+        conn->event_loop_wakeup();
+        loop.join();
+
+        conn->unregister_object_path("/simpledbus/echo");
+        conn->uninit();
+        delete conn;
+        conn = nullptr;
+    }
+
+    Message echo_call(const std::string& method, uint32_t value) {
+        Message msg = Message::create_method_call(conn->unique_name(), "/simpledbus/echo", "simpledbus.echo", method);
+        msg.append_argument(Holder::create<uint32_t>(value), "u");
+        return msg;
+    }
+
+    Connection* conn;
+    std::atomic_bool active;
+    std::thread loop;
+};
+
+TEST_F(ConnectionTest, SendAsyncPipelined) {
+    std::vector<std::shared_ptr<PendingCall>> calls;
+    for (uint32_t i = 0; i < 20; i++) {
+        Message msg = echo_call("Echo", i);
+        calls.push_back(conn->send_async(msg));
+    }
+
+    for (uint32_t i = 0; i < 20; i++) {
+        Message reply = calls[i]->get();
+        EXPECT_EQ(reply.extract().get<uint32_t>(), i);
+    }
+}
+
+TEST_F(ConnectionTest, SendAsyncCallback) {
+    std::atomic_int completed = 0;
+    Message msg = echo_call("Echo", 7);
+    auto call = conn->send_async(msg, [&completed](PendingCall& call) {
+        EXPECT_EQ(call.get().extract().get<uint32_t>(), 7);
+        completed++;
+    });
+
+    EXPECT_TRUE(call->wait_for(5s));
+    EXPECT_EQ(completed, 1);
+}
+
+TEST_F(ConnectionTest, SendAsyncErrorReply) {
+    Message msg = echo_call("Fail", 0);
+    auto call = conn->send_async(msg);
+    EXPECT_THROW(call->get(), Exception::SendFailed);
+}
+
+TEST_F(ConnectionTest, SendAsyncTimeout) {
+    std::atomic_int completed = 0;
+    Message msg = echo_call("Ignore", 0);
+    auto call = conn->send_async(msg, [&completed](PendingCall& call) { completed++; }, 50ms);
+
+    // The dispatch loop expires the call even though nobody is waiting on it.
+    std::this_thread::sleep_for(300ms);
+    EXPECT_FALSE(call->is_pending());
+    EXPECT_EQ(completed, 1);
+    EXPECT_THROW(call->get(), std::runtime_error);
+}
+
+TEST_F(ConnectionTest, SendAsyncCancel) {
+    Message msg = echo_call("Ignore", 0);
+    auto call = conn->send_async(msg);
+    call->cancel();
+
+    EXPECT_FALSE(call->is_pending());
+    EXPECT_THROW(call->get(), std::runtime_error);
+}
+
+TEST_F(ConnectionTest, FallbackReceivesDescendants) {
+    conn->register_fallback("/simpledbus/tree", [this](Message& msg) {
+        if (msg.get_type() != Message::Type::METHOD_CALL) return;
+
+        Message reply = Message::create_method_return(msg);
+        reply.append(msg.get_path());
+        conn->send(reply);
+    });
+
+    for (const std::string path : {"/simpledbus/tree", "/simpledbus/tree/a/b"}) {
+        Message msg = Message::create_method_call(conn->unique_name(), path, "simpledbus.tree", "Path");
+        EXPECT_EQ(conn->send_async(msg)->get().extract<std::string>(), path);
+    }
+
+    // An object with a handler of its own is not routed to the fallback.
+    Message msg = echo_call("Echo", 3);
+    EXPECT_EQ(conn->send_async(msg)->get().extract<uint32_t>(), 3);
+
+    conn->unregister_object_path("/simpledbus/tree");
+}
+
+TEST_F(ConnectionTest, EventLoopWatchesFd) {
+    int fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    ASSERT_GE(fd, 0);
+
+    std::atomic_int calls = 0;
+    std::atomic<eventfd_t> total = 0;
+    ASSERT_TRUE(conn->event_loop_add_fd(fd, [&]() {
+        eventfd_t value;
+        if (eventfd_read(fd, &value) == 0) total += value;
+        calls++;
+    }));
+    EXPECT_FALSE(conn->event_loop_add_fd(fd, []() {}));
+
+    eventfd_write(fd, 3);
+    auto timeout = std::chrono::steady_clock::now() + 2s;
+    while (total != 3 && std::chrono::steady_clock::now() < timeout) {
+        std::this_thread::sleep_for(1ms);
+    }
+    EXPECT_EQ(3, total);
+
+    // Once removed the handler is not invoked anymore, even though the descriptor is readable.
+    conn->event_loop_remove_fd(fd);
+    int calls_before = calls;
+    eventfd_write(fd, 1);
+    std::this_thread::sleep_for(200ms);
+    EXPECT_EQ(calls_before, calls);
+
+    close(fd);
+}
+
+TEST_F(ConnectionTest, EventLoopWatchesWritableFd) {
+    int fds[2];
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_NONBLOCK | SOCK_CLOEXEC, 0, fds), 0);
+
+    std::atomic_int calls = 0;
+    ASSERT_TRUE(conn->event_loop_add_fd(fds[0], [&]() { calls++; }));
+
+    // Nothing to read, so the handler only runs while writability is watched.
+    std::this_thread::sleep_for(200ms);
+    EXPECT_EQ(0, calls);
+
+    conn->event_loop_watch_writable(fds[0], true);
+    auto timeout = std::chrono::steady_clock::now() + 2s;
+    while (calls == 0 && std::chrono::steady_clock::now() < timeout) {
+        std::this_thread::sleep_for(1ms);
+    }
+    EXPECT_GT(calls, 0);
+
+    conn->event_loop_watch_writable(fds[0], false);
+    std::this_thread::sleep_for(200ms);
+    int calls_before = calls;
+    std::this_thread::sleep_for(200ms);
+    EXPECT_EQ(calls_before, calls);
+
+    conn->event_loop_remove_fd(fds[0]);
+    close(fds[0]);
+    close(fds[1]);
+}
+
+TEST_F(ConnectionTest, SendWithReply) {
+    Message msg = echo_call("Echo", 42);
+    Message reply = conn->send_with_reply(msg);
+    EXPECT_EQ(reply.extract().get<uint32_t>(), 42);
+}
+
+// Same as above, with handlers running on a worker pool instead of the event loop thread.
+class ConnectionWorkersTest : public ConnectionTest {
+  protected:
+    void SetUp() override {
+        Config::Connection::dispatch_workers = 4;
+        ConnectionTest::SetUp();
+
+        conn->register_object_path("/simpledbus/slow", [this](Message& msg) {
+            if (msg.get_type() != Message::Type::METHOD_CALL) return;
+            slow_calls++;
+            released.wait();
+
+            Message reply = Message::create_method_return(msg);
+            conn->send(reply);
+        });
+
+        conn->register_object_path("/simpledbus/order", [this](Message& msg) {
+            if (msg.get_type() != Message::Type::METHOD_CALL) return;
+            order.push_back(msg.extract().get<uint32_t>());
+
+            Message reply = Message::create_method_return(msg);
+            conn->send(reply);
+        });
+    }
+
+    void TearDown() override {
+        release.set_value();
+        conn->unregister_object_path("/simpledbus/slow");
+        conn->unregister_object_path("/simpledbus/order");
+        ConnectionTest::TearDown();
+        Config::Connection::reset();
+    }
+
+    Message call(const std::string& path, uint32_t value) {
+        Message msg = Message::create_method_call(conn->unique_name(), path, "simpledbus.echo", "Echo");
+        msg.append_argument(Holder::create<uint32_t>(value), "u");
+        return msg;
+    }
+
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::atomic_int slow_calls = 0;
+    std::vector<uint32_t> order;
+};
+
+TEST_F(ConnectionWorkersTest, SlowHandlerDoesNotStallOthers) {
+    Message slow_msg = call("/simpledbus/slow", 0);
+    auto slow_call = conn->send_async(slow_msg);
+
+    Message msg = echo_call("Echo", 5);
+    auto echo = conn->send_async(msg);
+    ASSERT_TRUE(echo->wait_for(2s));
+    EXPECT_EQ(echo->get().extract().get<uint32_t>(), 5);
+    EXPECT_TRUE(slow_call->is_pending());
+}
+
+TEST_F(ConnectionWorkersTest, HandlersKeepPerObjectOrder) {
+    std::vector<std::shared_ptr<PendingCall>> calls;
+    for (uint32_t i = 0; i < 100; i++) {
+        Message msg = call("/simpledbus/order", i);
+        calls.push_back(conn->send_async(msg));
+    }
+    for (auto& pending : calls) {
+        pending->get();
+    }
+
+    ASSERT_EQ(100, order.size());
+    for (uint32_t i = 0; i < 100; i++) {
+        EXPECT_EQ(i, order[i]);
+    }
+}
+
+TEST_F(ConnectionWorkersTest, UnregisterWaitsForRunningHandler) {
+    Message slow_msg = call("/simpledbus/slow", 0);
+    auto slow_call = conn->send_async(slow_msg);
+    while (slow_calls == 0) {
+        std::this_thread::sleep_for(1ms);
+    }
+
+    auto unregistered = std::async(std::launch::async, [this]() { conn->unregister_object_path("/simpledbus/slow"); });
+    EXPECT_EQ(std::future_status::timeout, unregistered.wait_for(100ms));
+
+    release.set_value();
+    EXPECT_EQ(std::future_status::ready, unregistered.wait_for(2s));
+    EXPECT_NO_THROW(slow_call->get());
+
+    // The path is gone, so further calls are not delivered to the handler.
+    Message late_msg = call("/simpledbus/slow", 1);
+    conn->send_async(late_msg, nullptr, 200ms)->wait_for(1s);
+    EXPECT_EQ(1, slow_calls);
+
+    release = std::promise<void>();
+}
+
+TEST_F(ConnectionWorkersTest, ObjectManagerSignalsFollowTheirObject) {
+    // An object whose own messages land on another worker than the object manager's.
+    const std::string manager = "/simpledbus/manager";
+    std::string object;
+    for (int i = 0; object.empty(); i++) {
+        std::string candidate = manager + "/object" + std::to_string(i);
+        if (std::hash<std::string_view>{}(candidate) % Config::Connection::dispatch_workers !=
+            std::hash<std::string_view>{}(manager) % Config::Connection::dispatch_workers) {
+            object = candidate;
+        }
+    }
+
+    std::mutex mutex;
+    std::vector<std::string> events;
+    conn->register_object_path(manager, [&](Message& msg) {
+        if (!msg.is_signal("org.freedesktop.DBus.ObjectManager", "InterfacesAdded")) return;
+        // Slow enough for the object's own message to overtake it on another worker.
+        std::this_thread::sleep_for(100ms);
+        std::scoped_lock lock(mutex);
+        events.push_back("added");
+    });
+    conn->register_object_path(object, [&](Message& msg) {
+        if (msg.get_type() != Message::Type::METHOD_CALL) return;
+        {
+            std::scoped_lock lock(mutex);
+            events.push_back("called");
+        }
+        Message reply = Message::create_method_return(msg);
+        conn->send(reply);
+    });
+    conn->add_match("type='signal',interface='org.freedesktop.DBus.ObjectManager',path='" + manager + "'");
+
+    Message added = Message::create_signal(manager, "org.freedesktop.DBus.ObjectManager", "InterfacesAdded");
+    added.append(ObjectPath(object), std::map<std::string, std::map<std::string, Holder>>());
+    conn->send(added);
+
+    Message msg = call(object, 0);
+    conn->send_async(msg)->get();
+
+    conn->unregister_object_path(manager);
+    conn->unregister_object_path(object);
+    EXPECT_EQ(events, (std::vector<std::string>{"added", "called"}));
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include <simpledbus/base/DispatchPool.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace SimpleDBus;
+using namespace std::chrono_literals;
+
+TEST(DispatchPool, KeepsOrderPerKey) {
+    std::mutex mutex;
+    std::vector<int> order_a;
+    std::vector<int> order_b;
+
+    {
+        DispatchPool pool(4);
+        for (int i = 0; i < 200; i++) {
+            pool.post("/a", [&, i]() {
+                std::lock_guard<std::mutex> lock(mutex);
+                order_a.push_back(i);
+            });
+            pool.post("/b", [&, i]() {
+                std::lock_guard<std::mutex> lock(mutex);
+                order_b.push_back(i);
+            });
+        }
+    }
+
+    ASSERT_EQ(200, order_a.size());
+    ASSERT_EQ(200, order_b.size());
+    for (int i = 0; i < 200; i++) {
+        EXPECT_EQ(i, order_a[i]);
+        EXPECT_EQ(i, order_b[i]);
+    }
+}
+
+TEST(DispatchPool, BlockedKeyDoesNotStallOthers) {
+    DispatchPool pool(8);
+
+    // Find a key that doesn't share a worker with the blocked one.
+    std::string blocked_key = "/blocked";
+    std::string other_key;
+    for (int i = 0; other_key.empty(); i++) {
+        std::string candidate = "/other" + std::to_string(i);
+        if (std::hash<std::string_view>{}(candidate) % pool.size() !=
+            std::hash<std::string_view>{}(blocked_key) % pool.size()) {
+            other_key = candidate;
+        }
+    }
+
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    pool.post(blocked_key, [released]() { released.wait(); });
+
+    std::promise<void> done;
+    pool.post(other_key, [&done]() { done.set_value(); });
+    EXPECT_EQ(std::future_status::ready, done.get_future().wait_for(2s));
+
+    release.set_value();
+}
+
+TEST(DispatchPool, StopRunsQueuedTasks) {
+    std::atomic_int count = 0;
+    DispatchPool pool(2);
+    for (int i = 0; i < 100; i++) {
+        pool.post(std::to_string(i), [&count]() { count++; });
+    }
+    pool.stop();
+    EXPECT_EQ(100, count);
+
+    // Nothing runs once the pool is stopped.
+    pool.post("/late", [&count]() { count++; });
+    EXPECT_EQ(100, count);
+}
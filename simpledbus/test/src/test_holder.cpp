@@ -181,3 +181,79 @@ TEST(Holder, DictionaryHeterogeneous) {
 }
 
 // TODO: Add tests for equality comparison of Holders.
+
+TEST(Holder, ByteArray) {
+    kvn::bytearray bytes = {0x01, 0x02, 0xAB};
+    Holder h = Holder::create<kvn::bytearray>(bytes);
+
+    EXPECT_EQ(h.type(), Holder::Type::BYTE_ARRAY);
+    EXPECT_EQ(h.signature(), "ay");
+    EXPECT_EQ(h.represent(), "Array:\n  01 02 ab \n");
+
+    kvn::bytearray output = h.get<kvn::bytearray>();
+    EXPECT_EQ(std::vector<uint8_t>(output), std::vector<uint8_t>({0x01, 0x02, 0xAB}));
+    EXPECT_EQ(h.get<std::vector<uint8_t>>(), std::vector<uint8_t>({0x01, 0x02, 0xAB}));
+
+    std::vector<Holder> expanded = h.get<std::vector<Holder>>();
+    EXPECT_EQ(expanded.size(), 3);
+    EXPECT_EQ(expanded[2].get<uint8_t>(), 0xAB);
+}
+
+TEST(Holder, ByteArrayMatchesArrayOfBytes) {
+    Holder h_bytes = Holder::create_byte_array(reinterpret_cast<const uint8_t*>("\x01\x02"), 2);
+
+    Holder h_array = Holder::create<std::vector<Holder>>();
+    h_array.array_append(Holder::create<uint8_t>(0x01));
+    h_array.array_append(Holder::create<uint8_t>(0x02));
+
+    EXPECT_EQ(h_bytes, h_array);
+    EXPECT_EQ(h_array, h_bytes);
+    EXPECT_EQ(h_array.get<kvn::bytearray>().size(), 2);
+
+    h_bytes.array_append(Holder::create<uint8_t>(0x03));
+    EXPECT_EQ(h_bytes.type(), Holder::Type::BYTE_ARRAY);
+    EXPECT_NE(h_bytes, h_array);
+    EXPECT_EQ(h_bytes.get<std::vector<uint8_t>>(), std::vector<uint8_t>({0x01, 0x02, 0x03}));
+}
+
+TEST(Holder, ByteArrayAppendKeepsCopies) {
+    Holder h = Holder::create<kvn::bytearray>();
+    for (int i = 0; i < 1000; i++) {
+        h.array_append(Holder::create<uint8_t>(static_cast<uint8_t>(i)));
+    }
+    ASSERT_NE(h.byte_array(), nullptr);
+    EXPECT_EQ(h.byte_array()->size(), 1000);
+
+    // Copies share the buffer until one of them is appended to.
+    Holder copy = h;
+    EXPECT_EQ(copy.byte_array(), h.byte_array());
+    copy.array_append(Holder::create<uint8_t>(0xFF));
+    EXPECT_NE(copy.byte_array(), h.byte_array());
+    EXPECT_EQ(h.byte_array()->size(), 1000);
+    EXPECT_EQ(copy.byte_array()->size(), 1001);
+
+    EXPECT_EQ(Holder::create<std::string>("bytes").byte_array(), nullptr);
+}
+
+TEST(Holder, DictionaryNumericKeys) {
+    Holder h = Holder::create<std::map<uint16_t, Holder>>();
+    h.dict_append(Holder::UINT16, static_cast<uint16_t>(0x004C), Holder::create<std::string>("apple"));
+    h.dict_append(Holder::UINT16, std::any(static_cast<uint16_t>(0x0006)), Holder::create<std::string>("microsoft"));
+
+    auto output = h.get<std::map<uint16_t, std::string>>();
+    EXPECT_EQ(output.size(), 2);
+    EXPECT_EQ(output[0x004C], "apple");
+    EXPECT_EQ(output[0x0006], "microsoft");
+
+    EXPECT_EQ(h.signature(), "a{qs}");
+}
+
+TEST(Holder, DictionaryStringKeyWithMismatchedType) {
+    // String keys are kept as strings even when tagged with the type of their value.
+    Holder h = Holder::create<std::map<std::string, Holder>>();
+    h.dict_append(Holder::INT16, "RSSI", Holder::create<int16_t>(-60));
+
+    auto output = h.get<std::map<std::string, Holder>>();
+    EXPECT_EQ(output.size(), 1);
+    EXPECT_EQ(output["RSSI"].get<int16_t>(), -60);
+}
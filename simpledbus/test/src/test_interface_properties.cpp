@@ -0,0 +1,232 @@
+#include <gtest/gtest.h>
+
+#include <simpledbus/advanced/Interface.h>
+#include <simpledbus/advanced/Proxy.h>
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace SimpleDBus;
+
+class CachedInterface : public Interface {
+  public:
+    CachedInterface(std::shared_ptr<Proxy> proxy) : Interface(nullptr, proxy, "i.cached") {}
+
+    Property<int32_t>& Value = property<int32_t>("Value");
+    Property<bool>& Flag = property<bool>("Flag", true);
+    Property<bool>& Feature = property<bool>("Feature").optional();
+};
+
+static Holder changed_value(int32_t value) {
+    Holder changed = Holder::create<std::map<std::string, Holder>>();
+    changed.dict_append(Holder::STRING, "Value", Holder::create<int32_t>(value));
+    return changed;
+}
+
+TEST(InterfaceProperties, PlaceholderIsStale) {
+    auto proxy = std::make_shared<Proxy>(nullptr, "", "/");
+    CachedInterface i(proxy);
+    i.property_cache_enable();
+
+    EXPECT_FALSE(i.Value.valid());
+    EXPECT_TRUE(i.Value.stale());
+
+    // Properties with an explicit default are considered known.
+    EXPECT_TRUE(i.Flag.valid());
+    EXPECT_FALSE(i.Flag.stale());
+}
+
+TEST(InterfaceProperties, SignalKeepsCacheFresh) {
+    auto proxy = std::make_shared<Proxy>(nullptr, "", "/");
+    CachedInterface i(proxy);
+
+    i.handle_properties_changed(changed_value(42), Holder::create<std::vector<Holder>>());
+    EXPECT_EQ(i.Value(), 42);
+
+    // Without caching every refresh goes to the bus.
+    EXPECT_TRUE(i.Value.stale());
+
+    i.property_cache_enable();
+    EXPECT_FALSE(i.Value.stale());
+
+    i.property_cache_disable();
+    EXPECT_TRUE(i.Value.stale());
+}
+
+TEST(InterfaceProperties, InvalidationMakesStale) {
+    auto proxy = std::make_shared<Proxy>(nullptr, "", "/");
+    CachedInterface i(proxy);
+    i.property_cache_enable();
+
+    i.handle_properties_changed(changed_value(7), Holder::create<std::vector<Holder>>());
+    EXPECT_FALSE(i.Value.stale());
+
+    Holder invalidated = Holder::create<std::vector<Holder>>();
+    invalidated.array_append(Holder::create<std::string>("Value"));
+    i.handle_properties_changed(Holder::create<std::map<std::string, Holder>>(), invalidated);
+    EXPECT_TRUE(i.Value.stale());
+}
+
+TEST(InterfaceProperties, OptionalIsExportedOnceSet) {
+    auto proxy = std::make_shared<Proxy>(nullptr, "", "/");
+    CachedInterface i(proxy);
+
+    auto exported = [&i]() {
+        std::vector<std::string> names;
+        for (auto& [name, value] : i.handle_property_get_all().get<std::map<std::string, Holder>>()) {
+            names.push_back(name);
+        }
+        return names;
+    };
+
+    // Placeholders of regular properties are exported as they are.
+    EXPECT_EQ(exported(), std::vector<std::string>({"Flag", "Value"}));
+    EXPECT_FALSE(i.property_exported("Feature"));
+
+    i.Feature.set(false);
+    EXPECT_EQ(exported(), std::vector<std::string>({"Feature", "Flag", "Value"}));
+    EXPECT_TRUE(i.property_exported("Feature"));
+
+    i.Feature.invalidate();
+    EXPECT_FALSE(i.property_exported("Feature"));
+}
+
+TEST(InterfaceProperties, MaxAgeExpires) {
+    auto proxy = std::make_shared<Proxy>(nullptr, "", "/");
+    CachedInterface i(proxy);
+    i.Value.cache(std::chrono::milliseconds(20));
+
+    i.handle_properties_changed(changed_value(1), Holder::create<std::vector<Holder>>());
+    EXPECT_FALSE(i.Value.stale());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+    EXPECT_TRUE(i.Value.stale());
+}
+
+// The connection serves GetAll on its own unique name, so that refreshes go through the bus.
+class InterfaceRefreshTest : public ::testing::Test {
+  protected:
+    class RemoteInterface : public Interface {
+      public:
+        RemoteInterface(std::shared_ptr<Connection> conn, std::shared_ptr<Proxy> proxy)
+            : Interface(conn, proxy, "i.remote") {}
+
+        Property<int32_t>& Value = property<int32_t>("Value");
+        Property<std::string>& Name = property<std::string>("Name");
+    };
+
+    void SetUp() override {
+        conn = std::make_shared<Connection>(DBUS_BUS_SESSION);
+        conn->init();
+
+        conn->register_object_path("/simpledbus/props", [this](Message& msg) {
+            if (!msg.is_method_call("org.freedesktop.DBus.Properties", "GetAll")) return;
+            get_all_count++;
+
+            Message reply = Message::create_method_return(msg);
+            {
+                std::scoped_lock lock(remote_mutex);
+                reply.append(remote);
+            }
+            conn->send(reply);
+        });
+
+        active = true;
+        loop = std::thread([this]() {
+            while (active) {
+                conn->event_loop_iterate(std::chrono::milliseconds(100));
+            }
+        });
+    }
+
+    void TearDown() override {
+        active = false;
+        conn->event_loop_wakeup();
+        loop.join();
+
+        conn->unregister_object_path("/simpledbus/props");
+        conn->uninit();
+    }
+
+    void remote_set(int32_t value, const std::string& name) {
+        std::scoped_lock lock(remote_mutex);
+        remote["Value"] = Holder::create<int32_t>(value);
+        remote["Name"] = Holder::create<std::string>(name);
+    }
+
+    std::shared_ptr<Connection> conn;
+    std::atomic_bool active;
+    std::thread loop;
+
+    std::mutex remote_mutex;
+    std::map<std::string, Holder> remote;
+    std::atomic_int get_all_count{0};
+};
+
+TEST_F(InterfaceRefreshTest, RefreshAllNotifiesOnlyChanged) {
+    auto proxy = std::make_shared<Proxy>(conn, conn->unique_name(), "/simpledbus/props");
+    RemoteInterface i(conn, proxy);
+
+    std::vector<int32_t> values;
+    std::vector<std::string> names;
+    i.Value.on_changed.load([&values](int32_t value) { values.push_back(value); });
+    i.Name.on_changed.load([&names](std::string name) { names.push_back(name); });
+
+    remote_set(5, "first");
+    i.refresh_all();
+    EXPECT_EQ(i.Value(), 5);
+    EXPECT_EQ(i.Name(), "first");
+    EXPECT_TRUE(i.Value.valid());
+
+    remote_set(6, "first");
+    i.refresh_all();
+    EXPECT_EQ(get_all_count, 2);
+    EXPECT_EQ(values, (std::vector<int32_t>{5, 6}));
+    EXPECT_EQ(names, (std::vector<std::string>{"first"}));
+}
+
+TEST_F(InterfaceRefreshTest, RefreshChildrenSkipsFreshCache) {
+    class RemoteProxy : public Proxy {
+      public:
+        RemoteProxy(std::shared_ptr<Connection> conn, const std::string& bus_name, const std::string& path)
+            : Proxy(conn, bus_name, path) {}
+
+        std::shared_ptr<RemoteInterface> remote() {
+            auto interface = std::make_shared<RemoteInterface>(_conn, shared_from_this());
+            _interfaces.emplace("i.remote", interface);
+            return interface;
+        }
+    };
+
+    auto parent = std::make_shared<Proxy>(conn, conn->unique_name(), "/simpledbus");
+    auto child = std::make_shared<RemoteProxy>(conn, conn->unique_name(), "/simpledbus/props");
+    parent->path_append_child("/simpledbus/props", child);
+    auto i = child->remote();
+
+    remote_set(1, "one");
+    parent->refresh_children_interfaces();
+    EXPECT_EQ(get_all_count, 1);
+    EXPECT_EQ(i->Value(), 1);
+
+    // Once cached, up to date values are not fetched again.
+    i->property_cache_enable();
+    remote_set(2, "two");
+    parent->refresh_children_interfaces();
+    EXPECT_EQ(get_all_count, 1);
+    EXPECT_EQ(i->Value(), 1);
+
+    i->Value.cache(std::chrono::milliseconds(10));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    parent->refresh_children_interfaces({"i.other"});
+    EXPECT_EQ(get_all_count, 1);
+
+    parent->refresh_children_interfaces({"i.remote"});
+    EXPECT_EQ(get_all_count, 2);
+    EXPECT_EQ(i->Value(), 2);
+    EXPECT_EQ(i->Name(), "two");
+}
@@ -3,7 +3,14 @@
 #include <simpledbus/base/Connection.h>
 #include <simpledbus/base/Message.h>
 
+#include <sys/socket.h>
+#include <unistd.h>
+
 #include <chrono>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
 
 using namespace SimpleDBus;
 
@@ -398,4 +405,188 @@ TEST_F(MessageTest, MoveAssignment) {
     EXPECT_EQ(move_assigned.get_path(), "/org/example/Path");
     EXPECT_EQ(move_assigned.get_interface(), "org.example.Interface");
     EXPECT_EQ(move_assigned.get_member(), "ExampleMethod");
-}
\ No newline at end of file
+}
+TEST(Message, ByteArrayRoundTrip) {
+    Message msg = Message::create_method_call("simpledbus.tester.python", "/", "simpledbus.tester.message",
+                                              "SendReceiveByteArray");
+
+    kvn::bytearray bytes(512);
+    for (size_t i = 0; i < bytes.size(); i++) {
+        bytes[i] = static_cast<uint8_t>(i);
+    }
+    msg.append_argument(Holder::create<kvn::bytearray>(bytes), "ay");
+
+    Holder h = msg.extract();
+    EXPECT_EQ(h.type(), Holder::Type::BYTE_ARRAY);
+    EXPECT_EQ(std::vector<uint8_t>(h.get<kvn::bytearray>()), std::vector<uint8_t>(bytes));
+}
+
+TEST(Message, EmptyByteArrayRoundTrip) {
+    Message msg = Message::create_method_call("simpledbus.tester.python", "/", "simpledbus.tester.message",
+                                              "SendReceiveByteArray");
+
+    msg.append_argument(Holder::create<kvn::bytearray>(), "ay");
+
+    Holder h = msg.extract();
+    EXPECT_EQ(h.type(), Holder::Type::BYTE_ARRAY);
+    EXPECT_TRUE(h.get<kvn::bytearray>().empty());
+}
+
+TEST(Message, TypeSignatures) {
+    static_assert(std::string_view(signature_v<bool>) == "b");
+    static_assert(std::string_view(signature_v<uint8_t, int16_t, uint16_t>) == "ynq");
+    static_assert(std::string_view(signature_v<int32_t, uint32_t, int64_t, uint64_t, double>) == "iuxtd");
+    static_assert(std::string_view(signature_v<std::string, ObjectPath, Signature>) == "sog");
+    static_assert(std::string_view(signature_v<std::vector<uint8_t>, kvn::bytearray>) == "ayay");
+    static_assert(std::string_view(signature_v<std::map<std::string, Holder>>) == "a{sv}");
+    static_assert(std::string_view(signature_v<std::map<std::string, Variant<kvn::bytearray>>>) == "a{sv}");
+    static_assert(std::string_view(signature_v<std::map<ObjectPath, std::map<std::string, std::map<std::string, Holder>>>>) ==
+                  "a{oa{sa{sv}}}");
+    static_assert(std::string_view(signature_v<std::vector<std::string>, std::map<uint16_t, std::vector<uint8_t>>>) ==
+                  "asa{qay}");
+    SUCCEED();
+}
+
+TEST(Message, TypedAppendMatchesHolderAppend) {
+    kvn::bytearray bytes = {0x01, 0x02, 0x03};
+    std::map<std::string, Holder> options = {{"type", Holder::create<std::string>("request")}};
+
+    Message typed = Message::create_method_call("org.bluez", "/", "org.bluez.GattCharacteristic1", "WriteValue");
+    typed.append(bytes, options);
+
+    Message untyped = Message::create_method_call("org.bluez", "/", "org.bluez.GattCharacteristic1", "WriteValue");
+    Holder h_options = Holder::create<std::map<std::string, Holder>>();
+    h_options.dict_append(Holder::STRING, "type", Holder::create<std::string>("request"));
+    untyped.append_argument(Holder::create<kvn::bytearray>(bytes), "ay");
+    untyped.append_argument(h_options, "a{sv}");
+
+    EXPECT_STREQ(dbus_message_get_signature(typed), "aya{sv}");
+    EXPECT_STREQ(dbus_message_get_signature(typed), dbus_message_get_signature(untyped));
+
+    EXPECT_EQ(untyped.extract(), typed.extract());
+    typed.extract_next();
+    untyped.extract_next();
+    EXPECT_EQ(untyped.extract(), typed.extract());
+}
+
+TEST(Message, TypedRoundTrip) {
+    Message msg = Message::create_method_call("simpledbus.tester.python", "/", "simpledbus.tester.message", "Typed");
+    msg.append(true, static_cast<uint8_t>(7), static_cast<int16_t>(-2), static_cast<uint32_t>(42), 1.5,
+               std::string("text"), ObjectPath("/a/b"), std::vector<std::string>{"x", "y"},
+               std::map<uint16_t, std::vector<uint8_t>>{{0x004C, {0xAA, 0xBB}}});
+
+    auto [flag, byte, int16, uint32, dbl, text, path, strings, manufacturer_data] =
+        msg.extract<bool, uint8_t, int16_t, uint32_t, double, std::string, ObjectPath, std::vector<std::string>,
+                    std::map<uint16_t, std::vector<uint8_t>>>();
+
+    EXPECT_TRUE(flag);
+    EXPECT_EQ(7, byte);
+    EXPECT_EQ(-2, int16);
+    EXPECT_EQ(42u, uint32);
+    EXPECT_DOUBLE_EQ(1.5, dbl);
+    EXPECT_EQ("text", text);
+    EXPECT_EQ(ObjectPath("/a/b"), path);
+    EXPECT_EQ((std::vector<std::string>{"x", "y"}), strings);
+    EXPECT_EQ((std::vector<uint8_t>{0xAA, 0xBB}), manufacturer_data[0x004C]);
+
+    // Typed extraction does not consume the argument cursor used by extract().
+    EXPECT_TRUE(msg.extract().get<bool>());
+}
+
+TEST(Message, TypedExtractFromHolderAppend) {
+    Message msg = Message::create_method_call("simpledbus.tester.python", "/", "simpledbus.tester.message", "Typed");
+    msg.append_argument(Holder::create<kvn::bytearray>(kvn::bytearray({0x10, 0x20})), "ay");
+    msg.append_argument(Holder::create<int32_t>(5), "v");
+
+    auto [bytes, value] = msg.extract<kvn::bytearray, int32_t>();
+    EXPECT_EQ((std::vector<uint8_t>{0x10, 0x20}), std::vector<uint8_t>(bytes));
+
+    // Variants are unwrapped when a concrete type is requested.
+    EXPECT_EQ(5, value);
+
+    auto [raw, variant] = msg.extract<std::vector<uint8_t>, Holder>();
+    EXPECT_EQ(2, raw.size());
+    EXPECT_EQ(5, variant.get<int32_t>());
+}
+
+TEST(Message, TypedExtractMismatch) {
+    Message msg = Message::create_method_call("simpledbus.tester.python", "/", "simpledbus.tester.message", "Typed");
+    msg.append(std::vector<std::string>{"x"});
+
+    EXPECT_THROW(msg.extract<std::string>(), Exception::SignatureMismatch);
+    EXPECT_THROW(msg.extract<std::vector<uint8_t>>(), Exception::SignatureMismatch);
+    EXPECT_THROW((msg.extract<std::vector<std::string>, std::string>()), Exception::SignatureMismatch);
+    EXPECT_NO_THROW(msg.extract<std::vector<std::string>>());
+
+    Message empty;
+    EXPECT_THROW(empty.extract<std::string>(), Exception::SignatureMismatch);
+}
+
+TEST(Message, TypedUnixFd) {
+    int sockets[2];
+    ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_SEQPACKET, 0, sockets));
+    UnixFd local(sockets[0]);
+    UnixFd remote(sockets[1]);
+
+    Message msg = Message::create_method_call("org.bluez", "/", "org.bluez.GattCharacteristic1", "AcquireNotify");
+    msg.append(remote, static_cast<uint16_t>(23));
+    EXPECT_STREQ(dbus_message_get_signature(msg), "hq");
+
+    auto [fd, mtu] = msg.extract<UnixFd, uint16_t>();
+    ASSERT_TRUE(fd.is_valid());
+    EXPECT_NE(remote.get(), fd.get());
+    EXPECT_EQ(23, mtu);
+
+    // The extracted descriptor is a duplicate that still refers to the same socket.
+    remote.reset();
+    const char payload[] = {0x01, 0x02, 0x03};
+    ASSERT_EQ(3, write(fd.get(), payload, sizeof(payload)));
+    char received[8];
+    EXPECT_EQ(3, read(local.get(), received, sizeof(received)));
+}
+
+TEST(Message, TypedRawValue) {
+    using Properties = std::map<std::string, Holder>;
+    using Interfaces = std::map<std::string, Properties>;
+
+    std::map<ObjectPath, RawValue> objects;
+    {
+        Message msg = Message::create_method_call("org.bluez", "/", "org.freedesktop.DBus.ObjectManager",
+                                                  "GetManagedObjects");
+        msg.append(std::map<ObjectPath, Interfaces>{
+            {ObjectPath("/a"), {{"i.1", {{"Value", Holder::create<int32_t>(1)}}}}},
+            {ObjectPath("/a/b"), {{"i.1", {{"Value", Holder::create<int32_t>(2)}}}, {"i.2", {}}}},
+        });
+        objects = msg.extract<std::map<ObjectPath, RawValue>>();
+    }
+
+    // The values keep the message alive on their own and can be decoded more than once.
+    ASSERT_EQ(2, objects.size());
+    for (int i = 0; i < 2; i++) {
+        auto interfaces = objects.at(ObjectPath("/a/b")).decode().get<std::map<std::string, Holder>>();
+        ASSERT_EQ(2, interfaces.size());
+        auto properties = interfaces.at("i.1").get<std::map<std::string, Holder>>();
+        EXPECT_EQ(2, properties.at("Value").get<int32_t>());
+    }
+    EXPECT_FALSE(RawValue().is_valid());
+}
+
+TEST(Message, TypedVariantCopy) {
+    Message prepared = Message::create_signal("/a", "org.freedesktop.DBus.Properties", "PropertiesChanged");
+
+    for (uint8_t i = 0; i < 2; i++) {
+        Message msg = prepared.copy();
+        msg.append(std::string("i.1"), std::map<std::string, Variant<kvn::bytearray>>{{"Value", {{i, 0x02}}}},
+                   std::vector<std::string>{});
+        EXPECT_STREQ(dbus_message_get_signature(msg), "sa{sv}as");
+        EXPECT_EQ("/a", msg.get_path());
+        EXPECT_TRUE(msg.is_signal("org.freedesktop.DBus.Properties", "PropertiesChanged"));
+
+        // Typed variants read back as either the variant or its contents.
+        auto changed = msg.extract<std::string, std::map<std::string, Variant<kvn::bytearray>>>();
+        EXPECT_EQ((std::vector<uint8_t>{i, 0x02}), std::vector<uint8_t>(std::get<1>(changed).at("Value").value));
+        Holder value = std::get<1>(msg.extract<std::string, std::map<std::string, Holder>>()).at("Value");
+        EXPECT_EQ(2, value.get<kvn::bytearray>().size());
+    }
+    EXPECT_STREQ(dbus_message_get_signature(prepared), "");
+}
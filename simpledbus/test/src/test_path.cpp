@@ -74,3 +74,10 @@ TEST(Path, GenerateNextChild) {
     EXPECT_EQ("/a/b/c", PathUtils::next_child("/a/b", "/a/b/c/d/e"));
     EXPECT_EQ("/a/b/c/d", PathUtils::next_child("/a/b/c", "/a/b/c/d/e"));
 }
+
+TEST(Path, DescendantRequiresSegmentBoundary) {
+    EXPECT_FALSE(PathUtils::is_descendant("/a/b", "/a/bc"));
+    EXPECT_FALSE(PathUtils::is_descendant("/a/b", "/a/bc/d"));
+    EXPECT_FALSE(PathUtils::is_child("/a/b", "/a/bc"));
+    EXPECT_TRUE(PathUtils::is_descendant("/a/b", "/a/b/c"));
+}
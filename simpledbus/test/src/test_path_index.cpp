@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <simpledbus/base/PathIndex.h>
+
+#include <string>
+#include <vector>
+
+using namespace SimpleDBus;
+
+TEST(PathIndex, InsertAndFind) {
+    PathIndex<int> index;
+
+    EXPECT_TRUE(index.insert("/a/b", 1));
+    EXPECT_TRUE(index.insert("/a/b/c", 2));
+    EXPECT_EQ(2, index.size());
+
+    ASSERT_NE(nullptr, index.find("/a/b"));
+    EXPECT_EQ(1, *index.find("/a/b"));
+    ASSERT_NE(nullptr, index.find("/a/b/c"));
+    EXPECT_EQ(2, *index.find("/a/b/c"));
+
+    // Intermediate nodes do not hold a value unless one was inserted.
+    EXPECT_EQ(nullptr, index.find("/a"));
+    EXPECT_EQ(nullptr, index.find("/a/b/c/d"));
+    EXPECT_EQ(nullptr, index.find("/a/bc"));
+}
+
+TEST(PathIndex, InsertExistingKeepsValue) {
+    PathIndex<int> index;
+
+    EXPECT_TRUE(index.insert("/a", 1));
+    EXPECT_FALSE(index.insert("/a", 2));
+    EXPECT_EQ(1, *index.find("/a"));
+    EXPECT_EQ(1, index.size());
+}
+
+TEST(PathIndex, Root) {
+    PathIndex<int> index;
+
+    EXPECT_FALSE(index.contains("/"));
+    EXPECT_TRUE(index.insert("/", 1));
+    EXPECT_TRUE(index.contains("/"));
+    EXPECT_FALSE(index.contains("/a"));
+
+    EXPECT_TRUE(index.erase("/"));
+    EXPECT_TRUE(index.empty());
+}
+
+TEST(PathIndex, EraseKeepsDescendants) {
+    PathIndex<int> index;
+    index.insert("/a/b", 1);
+    index.insert("/a/b/c", 2);
+
+    EXPECT_TRUE(index.erase("/a/b"));
+    EXPECT_FALSE(index.erase("/a/b"));
+    EXPECT_FALSE(index.contains("/a/b"));
+    EXPECT_TRUE(index.contains("/a/b/c"));
+
+    EXPECT_TRUE(index.erase("/a/b/c"));
+    EXPECT_TRUE(index.empty());
+
+    // Pruned branches can be repopulated.
+    EXPECT_TRUE(index.insert("/a/b/c", 3));
+    EXPECT_EQ(3, *index.find("/a/b/c"));
+}
+
+TEST(PathIndex, ManySiblings) {
+    PathIndex<std::string> index;
+    for (int i = 0; i < 1000; i++) {
+        std::string path = "/org/bluez/hci0/dev_" + std::to_string(i);
+        index.insert(path, path);
+    }
+
+    EXPECT_EQ(1000, index.size());
+    for (int i = 0; i < 1000; i++) {
+        std::string path = "/org/bluez/hci0/dev_" + std::to_string(i);
+        ASSERT_NE(nullptr, index.find(path));
+        EXPECT_EQ(path, *index.find(path));
+    }
+}
+
+TEST(PathIndex, SplitSegments) {
+    std::vector<std::string> segments;
+    PathIndex<int>::for_each_segment("/org/bluez/hci0", [&segments](std::string_view segment) {
+        segments.emplace_back(segment);
+        return true;
+    });
+    EXPECT_EQ((std::vector<std::string>{"org", "bluez", "hci0"}), segments);
+
+    EXPECT_TRUE(PathIndex<int>::for_each_segment("/", [](std::string_view) { return false; }));
+}
@@ -1,9 +1,65 @@
 #include <gtest/gtest.h>
 
 #include <simpledbus/advanced/Proxy.h>
+#include <simpledbus/base/Exceptions.h>
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
 
 using namespace SimpleDBus;
 
+namespace {
+
+class CountingProxy : public Proxy {
+  public:
+    using Proxy::Proxy;
+
+    std::shared_ptr<Proxy> path_create(const std::string& path) override {
+        created.push_back(path);
+        return std::make_shared<CountingProxy>(_conn, _bus_name, path);
+    }
+
+    static std::vector<std::string> created;
+};
+
+std::vector<std::string> CountingProxy::created;
+
+class WatchingProxy : public Proxy {
+  public:
+    using Proxy::Proxy;
+
+    std::shared_ptr<Proxy> path_create(const std::string& path) override {
+        return std::make_shared<WatchingProxy>(_conn, _bus_name, path);
+    }
+
+    void on_descendant_changed(const std::string& path) override { changes.insert({_path, path}); }
+
+    // Pairs of the proxy notified and the path that changed below it.
+    static std::set<std::pair<std::string, std::string>> changes;
+};
+
+std::set<std::pair<std::string, std::string>> WatchingProxy::changes;
+
+// "i.1" and "i.2" are registered by test_proxy_interfaces.cpp.
+std::map<ObjectPath, RawValue> managed_objects(const std::vector<std::string>& paths) {
+    std::map<ObjectPath, std::map<std::string, std::map<std::string, Holder>>> objects;
+    for (auto& path : paths) {
+        objects[ObjectPath(path)]["i.1"] = {};
+    }
+
+    Message msg =
+        Message::create_method_call("org.bluez", "/", "org.freedesktop.DBus.ObjectManager", "GetManagedObjects");
+    msg.append(objects);
+    return msg.extract<std::map<ObjectPath, RawValue>>();
+}
+
+}  // namespace
+
 TEST(ProxyChildren, AppendChild) {
     Proxy p = Proxy(nullptr, "", "/a/b");
 
@@ -107,3 +163,121 @@ TEST(ProxyChildren, RemoveChildWithInterfaces) {
     p.path_remove("/a", removed_interfaces);
     ASSERT_EQ(0, p.children().size());
 }
+
+TEST(ProxyChildren, AppendSiblingsSharingPrefix) {
+    Proxy p = Proxy(nullptr, "", "/");
+    p.path_add("/hci1", Holder());
+    p.path_add("/hci10/dev_a", Holder());
+
+    // A path under /hci10 must not be routed to /hci1 just because the names share a prefix.
+    ASSERT_EQ(2, p.children().size());
+    EXPECT_EQ(0, p.children().at("/hci1")->children().size());
+    ASSERT_EQ(1, p.children().at("/hci10")->children().size());
+    EXPECT_EQ(1, p.children().at("/hci10")->children().count("/hci10/dev_a"));
+}
+
+TEST(ProxyChildren, DeferredChildrenCreatedOnAccess) {
+    CountingProxy::created.clear();
+    auto p = std::make_shared<CountingProxy>(nullptr, "", "/");
+    for (auto& [path, managed_interfaces] : managed_objects({"/a", "/a/b", "/a/b/c", "/a/d", "/e"})) {
+        p->path_add_deferred(path, managed_interfaces);
+    }
+    EXPECT_TRUE(CountingProxy::created.empty());
+    EXPECT_FALSE(p->path_prune());
+
+    // Only the proxies along the way are created.
+    auto p_a = p->path_get("/a");
+    auto p_a_b = p_a->path_get("/a/b");
+    EXPECT_EQ(CountingProxy::created, std::vector<std::string>({"/a", "/a/b"}));
+    EXPECT_TRUE(p_a_b->interfaces_loaded());
+    EXPECT_FALSE(p->path_exists("/f"));
+
+    EXPECT_EQ(2, p_a->children().size());
+    EXPECT_EQ(1, p_a_b->children().size());
+    EXPECT_EQ(2, p->children().size());
+    EXPECT_EQ(5, CountingProxy::created.size());
+}
+
+TEST(ProxyChildren, PathAddMergesWithDeferredChild) {
+    auto p = std::make_shared<Proxy>(nullptr, "", "/");
+    for (auto& [path, managed_interfaces] : managed_objects({"/a/b"})) {
+        p->path_add_deferred(path, managed_interfaces);
+    }
+
+    Holder managed_interfaces = Holder::create<std::map<std::string, Holder>>();
+    managed_interfaces.dict_append(Holder::STRING, "i.2", Holder());
+    p->path_add("/a/b", managed_interfaces);
+
+    auto p_a_b = p->path_get("/a")->path_get("/a/b");
+    EXPECT_EQ(2, p_a_b->interfaces_count());
+}
+
+TEST(ProxyChildren, DescendantChangesReachAncestors) {
+    WatchingProxy::changes.clear();
+    auto p = std::make_shared<WatchingProxy>(nullptr, "", "/");
+    p->path_add("/a", Holder());
+    p->path_add("/a/b", Holder());
+    EXPECT_EQ(WatchingProxy::changes,
+              (std::set<std::pair<std::string, std::string>>{{"/", "/a"}, {"/", "/a/b"}, {"/a", "/a/b"}}));
+
+    // Interfaces changing on a path that is kept don't add or remove anything.
+    WatchingProxy::changes.clear();
+    p->path_get("/a")->path_get("/a/b")->interfaces_load(Holder());
+    EXPECT_TRUE(WatchingProxy::changes.empty());
+
+    p->path_remove("/a/b", Holder::create<std::vector<Holder>>());
+    EXPECT_EQ(WatchingProxy::changes, (std::set<std::pair<std::string, std::string>>{{"/", "/a/b"}, {"/a", "/a/b"}}));
+}
+
+// The proxy tree is exported on the connection, which calls methods on its own unique name.
+class ProxyMessagesTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        conn = std::make_shared<Connection>(DBUS_BUS_SESSION);
+        conn->init();
+
+        active = true;
+        loop = std::thread([this]() {
+            while (active) {
+                conn->event_loop_iterate(std::chrono::milliseconds(100));
+            }
+        });
+    }
+
+    void TearDown() override {
+        active = false;
+        conn->event_loop_wakeup();
+        loop.join();
+        conn->uninit();
+    }
+
+    // Returns the error the call failed with, or an empty string if it succeeded.
+    std::string call_error(const std::string& path, const std::string& interface) {
+        Message msg = Message::create_method_call(conn->unique_name(), path, interface, "Method");
+        try {
+            conn->send_async(msg, nullptr, std::chrono::seconds(2))->get();
+        } catch (const Exception::SendFailed& e) {
+            return e.what();
+        }
+        return "";
+    }
+
+    std::shared_ptr<Connection> conn;
+    std::atomic_bool active;
+    std::thread loop;
+};
+
+TEST_F(ProxyMessagesTest, UnknownTargetsAreRejected) {
+    auto p = Proxy::create<Proxy>(conn, conn->unique_name(), "/simpledbus/root");
+    for (auto& [path, managed_interfaces] : managed_objects({"/simpledbus/root/a"})) {
+        p->path_add_deferred(path, managed_interfaces);
+    }
+
+    // Callers get an error right away instead of waiting for their call to time out.
+    EXPECT_NE(call_error("/simpledbus/root/b", "simpledbus.test").find("org.freedesktop.DBus.Error.UnknownObject"),
+              std::string::npos);
+    EXPECT_NE(call_error("/simpledbus/root/a/c", "simpledbus.test").find("org.freedesktop.DBus.Error.UnknownObject"),
+              std::string::npos);
+    EXPECT_NE(call_error("/simpledbus/root/a", "simpledbus.test").find("org.freedesktop.DBus.Error.UnknownInterface"),
+              std::string::npos);
+}
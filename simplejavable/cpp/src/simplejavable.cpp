@@ -282,16 +282,16 @@ extern "C" JNIEXPORT jobject JNICALL Java_org_simplejavable_Peripheral_nativePer
         for (auto& characteristic : service.characteristics()) {
             Java::Util::ArrayList<ReleasableLocalRef> descriptors_list;
             for (auto& descriptor : characteristic.descriptors()) {
-                Org::SimpleJavaBLE::Descriptor descriptor_obj(descriptor.uuid());
+                Org::SimpleJavaBLE::Descriptor descriptor_obj(descriptor.uuid().str());
                 descriptors_list.add(descriptor_obj);
             }
             Org::SimpleJavaBLE::Characteristic characteristic_obj(
-                characteristic.uuid(), descriptors_list.to_local(), characteristic.can_read(),
+                characteristic.uuid().str(), descriptors_list.to_local(), characteristic.can_read(),
                 characteristic.can_write_request(), characteristic.can_write_command(), characteristic.can_notify(),
                 characteristic.can_indicate());
             characteristics_list.add(characteristic_obj);
         }
-        Org::SimpleJavaBLE::Service service_obj(service.uuid(), characteristics_list.to_local());
+        Org::SimpleJavaBLE::Service service_obj(service.uuid().str(), characteristics_list.to_local());
         services_list.add(service_obj);
     }
     return services_list.release();
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <pybind11/pybind11.h>
+
+#include "simpleble/BluetoothUUID.h"
+
+namespace pybind11 {
+namespace detail {
+
+// UUIDs cross into Python as plain strings, in their lowercase 128-bit form.
+template <>
+struct type_caster<SimpleBLE::BluetoothUUID> {
+    PYBIND11_TYPE_CASTER(SimpleBLE::BluetoothUUID, const_name("str"));
+
+    bool load(handle src, bool) {
+        if (!isinstance<str>(src)) return false;
+        // Malformed text raises ValueError rather than failing overload resolution.
+        value = SimpleBLE::BluetoothUUID(src.cast<std::string>());
+        return true;
+    }
+
+    static handle cast(const SimpleBLE::BluetoothUUID& src, return_value_policy, handle) {
+        return str(src.str()).release();
+    }
+};
+
+}  // namespace detail
+}  // namespace pybind11
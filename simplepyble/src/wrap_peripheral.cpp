@@ -3,6 +3,7 @@
 #include <pybind11/stl.h>
 
 #include "simpleble/Peripheral.h"
+#include "type_casters.h"
 
 namespace py = pybind11;
 
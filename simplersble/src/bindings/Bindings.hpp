@@ -126,7 +126,7 @@ class RustyService {
     RustyService(SimpleBLE::Service service) : _internal(new SimpleBLE::Service(std::move(service))) {}
 
     bool initialized() const { return _internal->initialized(); }
-    rust::String uuid() const { return rust::String(_internal->uuid()); }
+    rust::String uuid() const { return rust::String(_internal->uuid().str()); }
 
     rust::Vec<uint8_t> data() const;
 
@@ -149,7 +149,7 @@ class RustyCharacteristic {
         : _internal(new SimpleBLE::Characteristic(std::move(characteristic))) {}
 
     bool initialized() const { return _internal->initialized(); }
-    rust::String uuid() const { return rust::String(_internal->uuid()); }
+    rust::String uuid() const { return rust::String(_internal->uuid().str()); }
 
     rust::Vec<Bindings::RustyDescriptorWrapper> descriptors() const;
     rust::Vec<rust::String> capabilities() const;
@@ -176,7 +176,7 @@ class RustyDescriptor {
     RustyDescriptor(SimpleBLE::Descriptor descriptor) : _internal(new SimpleBLE::Descriptor(std::move(descriptor))) {}
 
     bool initialized() const { return _internal->initialized(); }
-    rust::String uuid() const { return rust::String(_internal->uuid()); }
+    rust::String uuid() const { return rust::String(_internal->uuid().str()); }
 
   private:
     // NOTE: All internal properties need to be handled as pointers,